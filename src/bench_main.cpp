@@ -0,0 +1,318 @@
+#include "brain/compiled_network.h"
+#include "brain/innovation_tracker.h"
+#include "brain/mutation.h"
+#include "io/boid_spec.h"
+#include "io/data_path.h"
+#include "simulation/alloc_counter.h"
+#include "simulation/world.h"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Throughput benchmark: steps scripted worlds and reports ticks per second
+// and nanoseconds per boid per tick, as a table on stderr and as JSON for
+// comparing builds. Builds with WILDBOIDS_PROFILING also break the time
+// down by World::step phase.
+
+enum class EyeLayout { Legacy, Compound };
+enum class FoodMode { Uniform, Patch };
+
+struct Scenario {
+    std::string name;
+    int boids = 1000;
+    int food = 500;
+    FoodMode food_mode = FoodMode::Uniform;
+    EyeLayout eyes = EyeLayout::Compound;
+    int hidden_nodes = 0;   // added to the minimal genome by node splits
+    bool toroidal = true;
+};
+
+// One dimension varied at a time around a 1000-boid baseline, plus the
+// boid-count sweep
+static std::vector<Scenario> standard_scenarios() {
+    std::vector<Scenario> list;
+    for (int n : {100, 1000, 10000, 100000}) {
+        Scenario s;
+        s.name = "boids_" + std::to_string(n);
+        s.boids = n;
+        s.food = n / 2;
+        list.push_back(s);
+    }
+    auto variant = [&](const std::string& name, auto&& change) {
+        Scenario s;
+        s.name = name;
+        change(s);
+        list.push_back(s);
+    };
+    variant("food_50", [](Scenario& s) { s.food = 50; });
+    variant("food_5000", [](Scenario& s) { s.food = 5000; });
+    variant("food_patch", [](Scenario& s) { s.food_mode = FoodMode::Patch; });
+    variant("eyes_legacy", [](Scenario& s) { s.eyes = EyeLayout::Legacy; });
+    variant("hidden_10", [](Scenario& s) { s.hidden_nodes = 10; });
+    variant("hidden_50", [](Scenario& s) { s.hidden_nodes = 50; });
+    variant("bounded", [](Scenario& s) { s.toroidal = false; });
+    return list;
+}
+
+struct BenchOptions {
+    int threads = 1;
+    int warmup_ticks = 10;
+    int min_ticks = 5;
+    double min_seconds = 1.0;
+    bool fast_eyes = false;
+    unsigned seed = 42;
+};
+
+struct BenchResult {
+    int ticks = 0;
+    double seconds = 0.0;
+    double setup_seconds = 0.0;
+    uint64_t allocations = 0;
+    StepProfile profile;  // measured ticks only
+};
+
+// Everyone lives for the whole run (no metabolism or thrust cost), so the
+// load stays constant. The world grows with the boid count to hold density
+// at the default config's 150 boids per 2000x2000.
+static WorldConfig scenario_world(const Scenario& s, const BenchOptions& opt) {
+    WorldConfig cfg;
+    float side = 2000.0f * std::sqrt(static_cast<float>(s.boids) / 150.0f);
+    cfg.width = side;
+    cfg.height = side;
+    cfg.toroidal = s.toroidal;
+    cfg.threads = opt.threads;
+    cfg.metabolism_rate = 0.0f;
+    cfg.thrust_cost = 0.0f;
+    cfg.fast_eye_kernel = opt.fast_eyes;
+    cfg.prey_shoaling.radius = 40.0f;
+    cfg.prey_shoaling.max_reduction = 0.3f;
+    if (s.food_mode == FoodMode::Patch) {
+        PatchFoodConfig patch;
+        patch.food_per_patch = 30;
+        patch.num_patches = std::max(1, s.food / patch.food_per_patch);
+        cfg.food_source_config = patch;
+    } else {
+        cfg.food_max = s.food;
+        cfg.food_spawn_rate = s.food / 10.0f;
+    }
+    return cfg;
+}
+
+static BenchResult run_scenario(const Scenario& s, const BenchOptions& opt) {
+    using clock = std::chrono::steady_clock;
+    auto setup_start = clock::now();
+
+    std::mt19937 rng(opt.seed);
+    WorldConfig cfg = scenario_world(s, opt);
+    World world(cfg);
+    world.pre_seed_food(rng);
+
+    BoidSpec spec = load_boid_spec(data_path(
+        s.eyes == EyeLayout::Compound ? "simple_boid.json" : "4thruster_foodonly_simple_boid.json"));
+
+    // One grown genome; every boid gets its own copy with fresh weights
+    int next_innov = 1;
+    NeatGenome base = NeatGenome::minimal(sensor_input_count(spec),
+                                          static_cast<int>(spec.thrusters.size()), next_innov);
+    InnovationTracker tracker(next_innov);
+    for (int h = 0; h < s.hidden_nodes; ++h) mutate_add_node(base, rng, tracker);
+
+    std::uniform_real_distribution<float> x_dist(0.0f, cfg.width);
+    std::uniform_real_distribution<float> y_dist(0.0f, cfg.height);
+    std::uniform_real_distribution<float> angle_dist(0.0f, 6.2831853f);
+    std::uniform_real_distribution<float> weight_dist(-2.0f, 2.0f);
+    for (int i = 0; i < s.boids; ++i) {
+        NeatGenome genome = base;
+        for (size_t c = 0; c < genome.connections().size(); ++c) {
+            genome.set_weight(c, weight_dist(rng));
+        }
+        Boid b = create_boid_from_spec(spec);
+        b.brain = std::make_unique<CompiledNetwork>(genome);
+        b.body.position = {x_dist(rng), y_dist(rng)};
+        b.body.angle = angle_dist(rng);
+        world.add_boid(std::move(b));
+    }
+
+    const float dt = 1.0f / 120.0f;
+    for (int t = 0; t < opt.warmup_ticks; ++t) world.step(dt, &rng);
+
+    BenchResult result;
+    result.setup_seconds = std::chrono::duration<double>(clock::now() - setup_start).count();
+    world.reset_profile();
+    AllocationCounter allocations;
+    auto start = clock::now();
+    while (result.ticks < opt.min_ticks || result.seconds < opt.min_seconds) {
+        world.step(dt, &rng);
+        ++result.ticks;
+        result.seconds = std::chrono::duration<double>(clock::now() - start).count();
+    }
+    result.allocations = allocations.count();
+    result.profile = world.profile();
+    return result;
+}
+
+static void print_usage(const char* prog) {
+    std::cerr << "Usage: " << prog << " [options]\n"
+              << "  --output PATH      Write results as JSON to PATH (default: stdout)\n"
+              << "  --filter TEXT      Only run scenarios whose name contains TEXT\n"
+              << "  --max-boids N      Skip scenarios with more than N boids\n"
+              << "  --list             List scenarios and exit\n"
+              << "  --threads N        Worker threads per world step (0 = all cores, default: 1)\n"
+              << "  --seconds F        Minimum measured time per scenario (default: 1)\n"
+              << "  --min-ticks N      Minimum measured ticks per scenario (default: 5)\n"
+              << "  --warmup N         Ticks run before measuring (default: 10)\n"
+              << "  --fast-eyes        Use the trig-free compound eye kernel\n"
+              << "  --seed N           RNG seed (default: 42)\n"
+              << "  --help             Show this help\n";
+}
+
+int main(int argc, char* argv[]) {
+    BenchOptions opt;
+    std::string output;
+    std::string filter;
+    int max_boids = 0;
+    bool list_only = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--help") == 0) {
+            print_usage(argv[0]);
+            return 0;
+        } else if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--max-boids") == 0 && i + 1 < argc) {
+            max_boids = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--list") == 0) {
+            list_only = true;
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            opt.threads = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            opt.min_seconds = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--min-ticks") == 0 && i + 1 < argc) {
+            opt.min_ticks = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) {
+            opt.warmup_ticks = std::max(0, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--fast-eyes") == 0) {
+            opt.fast_eyes = true;
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            opt.seed = static_cast<unsigned>(std::atoi(argv[++i]));
+        } else {
+            std::cerr << "Unknown option: " << argv[i] << "\n";
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<Scenario> scenarios;
+    for (const auto& s : standard_scenarios()) {
+        if (!filter.empty() && s.name.find(filter) == std::string::npos) continue;
+        if (max_boids > 0 && s.boids > max_boids) continue;
+        scenarios.push_back(s);
+    }
+    if (list_only) {
+        for (const auto& s : scenarios) std::cout << s.name << "\n";
+        return 0;
+    }
+    if (scenarios.empty()) {
+        std::cerr << "No scenarios match\n";
+        return 1;
+    }
+
+    int threads = opt.threads > 0 ? opt.threads
+                                  : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    nlohmann::json report;
+    report["threads"] = threads;
+    report["fast_eyes"] = opt.fast_eyes;
+    report["seed"] = opt.seed;
+    report["profiling"] = StepProfile::enabled;
+#ifdef NDEBUG
+    report["assertions"] = false;
+#else
+    report["assertions"] = true;
+#endif
+    report["scenarios"] = nlohmann::json::array();
+
+    std::cerr << std::left << std::setw(14) << "scenario" << std::right
+              << std::setw(8) << "boids" << std::setw(8) << "ticks"
+              << std::setw(12) << "ticks/s" << std::setw(14) << "ns/boid/tick"
+              << std::setw(12) << "allocs/tick" << "\n";
+
+    for (const auto& s : scenarios) {
+        BenchResult r;
+        try {
+            r = run_scenario(s, opt);
+        } catch (const std::exception& e) {
+            std::cerr << s.name << ": " << e.what() << "\n";
+            return 1;
+        }
+        double ticks_per_second = r.ticks / r.seconds;
+        double ns_per_boid_tick = r.seconds * 1e9 / (static_cast<double>(r.ticks) * s.boids);
+        double allocs_per_tick = static_cast<double>(r.allocations) / r.ticks;
+
+        std::cerr << std::left << std::setw(14) << s.name << std::right
+                  << std::setw(8) << s.boids << std::setw(8) << r.ticks
+                  << std::setw(12) << std::fixed << std::setprecision(1) << ticks_per_second
+                  << std::setw(14) << ns_per_boid_tick
+                  << std::setw(12) << allocs_per_tick << "\n" << std::defaultfloat;
+
+        nlohmann::json phases = nlohmann::json::object();
+        const StepProfile& p = r.profile;
+        double boid_steps = static_cast<double>(std::max<int64_t>(1, p.boid_steps));
+        if (StepProfile::enabled) {
+            std::cerr << "    ns/boid/tick:";
+            for (int ph = 0; ph < STEP_PHASE_COUNT; ++ph) {
+                const char* name = step_phase_name(static_cast<StepPhase>(ph));
+                double ns = p.phase_ns[ph] / boid_steps;
+                phases[name] = ns;
+                std::cerr << " " << name << " " << std::fixed << std::setprecision(0) << ns;
+            }
+            std::cerr << "\n" << std::defaultfloat;
+        }
+
+        report["scenarios"].push_back({
+            {"name", s.name},
+            {"boids", s.boids},
+            {"food", s.food},
+            {"food_mode", s.food_mode == FoodMode::Patch ? "patch" : "uniform"},
+            {"eyes", s.eyes == EyeLayout::Compound ? "compound" : "legacy"},
+            {"hidden_nodes", s.hidden_nodes},
+            {"toroidal", s.toroidal},
+            {"ticks", r.ticks},
+            {"seconds", r.seconds},
+            {"setup_seconds", r.setup_seconds},
+            {"ticks_per_second", ticks_per_second},
+            {"ns_per_boid_tick", ns_per_boid_tick},
+            {"allocations_per_tick", allocs_per_tick},
+        });
+        if (StepProfile::enabled) {
+            auto& entry = report["scenarios"].back();
+            entry["phase_ns_per_boid_tick"] = phases;
+            entry["grid_candidates_per_boid_tick"] = p.grid_candidates / boid_steps;
+            entry["eye_hits_per_boid_tick"] = p.eye_hits / boid_steps;
+        }
+    }
+
+    if (output.empty()) {
+        std::cout << report.dump(2) << "\n";
+    } else {
+        std::ofstream file(output);
+        if (!file.is_open()) {
+            std::cerr << "Could not write " << output << "\n";
+            return 1;
+        }
+        file << report.dump(2) << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,88 @@
+#include "brain/activation.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+namespace {
+
+constexpr float LOG2E = 1.44269504088896341f;
+
+// exp(x) as 2^k * p(f): k = round(x * log2 e), f in [-0.5, 0.5], p a
+// Chebyshev fit of 2^f. Inputs are clamped to about +-87 so 2^k stays a
+// normal float.
+template <int Degree>
+inline float exp_poly(float x) {
+    float t = std::clamp(x * LOG2E, -126.0f, 126.0f);
+    int k = static_cast<int>(t + 127.5f);  // round(t) + 127, always positive
+    float f = t - static_cast<float>(k - 127);
+    float p;
+    if constexpr (Degree == 5) {
+        p = 1.339086336e-03f;
+        p = p * f + 9.676031918e-03f;
+        p = p * f + 5.550357114e-02f;
+        p = p * f + 2.402210749e-01f;
+        p = p * f + 6.931471880e-01f;
+        p = p * f + 1.000000075e+00f;
+    } else {
+        p = 5.583828295e-02f;
+        p = p * f + 2.426394785e-01f;
+        p = p * f + 6.931367339e-01f;
+        p = p * f + 9.999245570e-01f;
+    }
+    return p * std::bit_cast<float>(static_cast<uint32_t>(k) << 23);
+}
+
+template <int Degree>
+void sigmoid_poly(float* v, int count) {
+    for (int i = 0; i < count; ++i) v[i] = 1.0f / (1.0f + exp_poly<Degree>(-v[i]));
+}
+
+// tanh(x) = 1 - 2 / (exp(2x) + 1); |x| > 9 is 1 to float precision
+template <int Degree>
+void tanh_poly(float* v, int count) {
+    for (int i = 0; i < count; ++i) {
+        float x = std::clamp(v[i], -9.0f, 9.0f);
+        v[i] = 1.0f - 2.0f / (exp_poly<Degree>(2.0f * x) + 1.0f);
+    }
+}
+
+} // namespace
+
+ActivationPrecision parse_activation_precision(const std::string& name) {
+    if (name == "exact") return ActivationPrecision::Exact;
+    if (name == "fast") return ActivationPrecision::Fast;
+    if (name == "fastest") return ActivationPrecision::Fastest;
+    throw std::invalid_argument("Unknown activation precision: " + name +
+                                " (expected exact, fast or fastest)");
+}
+
+const char* activation_precision_name(ActivationPrecision precision) {
+    switch (precision) {
+        case ActivationPrecision::Exact: return "exact";
+        case ActivationPrecision::Fast: return "fast";
+        case ActivationPrecision::Fastest: return "fastest";
+    }
+    return "exact";
+}
+
+void apply_activation(ActivationFn fn, float* v, int count, ActivationPrecision precision) {
+    switch (fn) {
+        case ActivationFn::Sigmoid:
+            if (precision == ActivationPrecision::Fast) sigmoid_poly<5>(v, count);
+            else if (precision == ActivationPrecision::Fastest) sigmoid_poly<3>(v, count);
+            else for (int i = 0; i < count; ++i) v[i] = 1.0f / (1.0f + std::exp(-v[i]));
+            break;
+        case ActivationFn::Tanh:
+            if (precision == ActivationPrecision::Fast) tanh_poly<5>(v, count);
+            else if (precision == ActivationPrecision::Fastest) tanh_poly<3>(v, count);
+            else for (int i = 0; i < count; ++i) v[i] = std::tanh(v[i]);
+            break;
+        case ActivationFn::ReLU:
+            for (int i = 0; i < count; ++i) v[i] = std::max(0.0f, v[i]);
+            break;
+        case ActivationFn::Linear:
+            break;
+    }
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "brain/neat_genome.h"
+#include <string>
+
+// Accuracy tiers for node activation functions.
+//   Exact:   std::exp / std::tanh, bit-identical to NeatNetwork
+//   Fast:    degree-5 polynomial exp, |error| <= 1e-6 (Sigmoid, Tanh)
+//   Fastest: degree-3 polynomial exp, |error| <= 2e-4 (Sigmoid, Tanh)
+// ReLU and Linear are exact in every tier. The approximate tiers are
+// branch-free loops over arrays, so they vectorise.
+enum class ActivationPrecision { Exact, Fast, Fastest };
+
+// "exact", "fast" or "fastest". Throws std::invalid_argument otherwise.
+ActivationPrecision parse_activation_precision(const std::string& name);
+const char* activation_precision_name(ActivationPrecision precision);
+
+// Apply fn in place to v[0, count).
+void apply_activation(ActivationFn fn, float* v, int count,
+                      ActivationPrecision precision = ActivationPrecision::Exact);
+
+// Single-value convenience over the array form.
+inline float activate(ActivationFn fn, float x,
+                      ActivationPrecision precision = ActivationPrecision::Exact) {
+    apply_activation(fn, &x, 1, precision);
+    return x;
+}
@@ -0,0 +1,265 @@
+#include "brain/compiled_network.h"
+#include "brain/activation.h"
+#include <algorithm>
+#include <queue>
+#include <unordered_map>
+
+namespace {
+
+struct Edge {
+    int source;  // genome node index
+    int target;
+    float weight;
+    bool recurrent;
+};
+
+// Evaluation order exactly as NeatNetwork::build_eval_order computes it:
+// Kahn's algorithm over feed-forward edges, seeded with the inputs.
+std::vector<int> topological_order(int n, const std::vector<bool>& is_input,
+                                   const std::vector<int>& input_nodes,
+                                   const std::vector<Edge>& edges) {
+    std::vector<int> in_degree(n, 0);
+    std::vector<std::vector<int>> dependents(n);
+    for (const auto& e : edges) {
+        if (e.recurrent) continue;
+        if (!is_input[e.target]) in_degree[e.target]++;
+        dependents[e.source].push_back(e.target);
+    }
+
+    std::queue<int> ready;
+    for (int idx : input_nodes) ready.push(idx);
+    for (int i = 0; i < n; ++i) {
+        if (!is_input[i] && in_degree[i] == 0) ready.push(i);
+    }
+
+    std::vector<int> order;
+    std::vector<bool> visited(n, false);
+    while (!ready.empty()) {
+        int curr = ready.front();
+        ready.pop();
+        if (visited[curr]) continue;
+        visited[curr] = true;
+        if (!is_input[curr]) order.push_back(curr);
+        for (int dep : dependents[curr]) {
+            in_degree[dep]--;
+            if (in_degree[dep] <= 0 && !visited[dep]) ready.push(dep);
+        }
+    }
+    return order;
+}
+
+} // namespace
+
+NetworkTape::NetworkTape(const NeatGenome& genome, ActivationPrecision precision)
+    : precision_(precision)
+{
+    int n = static_cast<int>(genome.nodes().size());
+
+    // Node id -> genome index (later duplicates win, as in NeatNetwork)
+    std::unordered_map<int, int> id_to_index;
+    std::vector<bool> is_input(n, false);
+    std::vector<int> input_nodes;
+    std::vector<int> output_nodes;
+    for (int i = 0; i < n; ++i) {
+        const auto& ng = genome.nodes()[i];
+        id_to_index[ng.id] = i;
+        if (ng.type == NodeType::Input) {
+            is_input[i] = true;
+            input_nodes.push_back(i);
+        } else if (ng.type == NodeType::Output) {
+            output_nodes.push_back(i);
+        }
+    }
+
+    std::vector<Edge> edges;
+    for (const auto& cg : genome.connections()) {
+        if (!cg.enabled) continue;
+        auto src_it = id_to_index.find(cg.source);
+        auto tgt_it = id_to_index.find(cg.target);
+        if (src_it == id_to_index.end() || tgt_it == id_to_index.end()) continue;
+        edges.push_back({src_it->second, tgt_it->second, cg.weight, cg.recurrent});
+    }
+
+    std::vector<int> order = topological_order(n, is_input, input_nodes, edges);
+
+    // Per-node incoming edges, in genome order
+    std::vector<std::vector<int>> incoming(n);
+    for (int k = 0; k < static_cast<int>(edges.size()); ++k) {
+        incoming[edges[k].target].push_back(k);
+    }
+
+    // Level = longest feed-forward path from the inputs. Every feed-forward
+    // source precedes its target in `order`, so one pass suffices.
+    std::vector<int> level(n, 0);
+    for (int idx : order) {
+        int lv = 1;
+        for (int k : incoming[idx]) {
+            if (!edges[k].recurrent) lv = std::max(lv, level[edges[k].source] + 1);
+        }
+        level[idx] = lv;
+    }
+
+    // Evaluated nodes sorted by level, then activation; ties keep eval order
+    std::vector<int> evaluated = order;
+    std::stable_sort(evaluated.begin(), evaluated.end(), [&](int a, int b) {
+        if (level[a] != level[b]) return level[a] < level[b];
+        return genome.nodes()[a].activation < genome.nodes()[b].activation;
+    });
+
+    // Slot assignment: inputs, evaluated nodes, then nodes that are never
+    // evaluated (they stay at zero, as in NeatNetwork)
+    std::vector<int> slot(n, -1);
+    int next_slot = 0;
+    for (int idx : input_nodes) slot[idx] = next_slot++;
+    for (int idx : evaluated) slot[idx] = next_slot++;
+    for (int i = 0; i < n; ++i) {
+        if (slot[i] < 0) slot[i] = next_slot++;
+    }
+    n_inputs_ = static_cast<int>(input_nodes.size());
+    n_slots_ = next_slot;
+
+    // Tape: bias and terms per slot, recurrent sources redirected to prev slots
+    std::vector<int> prev_slot(n, -1);
+    bias_.assign(n_slots_, 0.0f);
+    term_begin_.assign(n_slots_ + 1, 0);
+    int first_eval = n_inputs_;
+    for (int e = 0; e < static_cast<int>(evaluated.size()); ++e) {
+        int idx = evaluated[e];
+        int s = first_eval + e;
+        bias_[s] = genome.nodes()[idx].bias;
+        term_begin_[s] = static_cast<int>(terms_.size());
+        for (int k : incoming[idx]) {
+            const auto& edge = edges[k];
+            int src = slot[edge.source];
+            if (edge.recurrent) {
+                if (prev_slot[edge.source] < 0) {
+                    prev_slot[edge.source] = n_slots_ + static_cast<int>(prev_src_.size());
+                    prev_src_.push_back(src);
+                }
+                src = prev_slot[edge.source];
+            }
+            terms_.push_back({src, edge.weight});
+        }
+        term_begin_[s + 1] = static_cast<int>(terms_.size());
+    }
+
+    // Levels and their activation runs
+    for (int e = 0; e < static_cast<int>(evaluated.size());) {
+        int lv = level[evaluated[e]];
+        Level L{first_eval + e, 0, static_cast<int>(runs_.size()), 0};
+        while (e < static_cast<int>(evaluated.size()) && level[evaluated[e]] == lv) {
+            ActivationFn fn = genome.nodes()[evaluated[e]].activation;
+            int begin = first_eval + e;
+            while (e < static_cast<int>(evaluated.size()) && level[evaluated[e]] == lv &&
+                   genome.nodes()[evaluated[e]].activation == fn) {
+                ++e;
+            }
+            runs_.push_back({fn, begin, first_eval + e});
+        }
+        L.node_end = first_eval + e;
+        L.run_end = static_cast<int>(runs_.size());
+        levels_.push_back(L);
+    }
+
+    for (int idx : output_nodes) output_slots_.push_back(slot[idx]);
+}
+
+void NetworkTape::activate(float* v, const float* inputs, int n_in,
+                           float* outputs, int n_out) const {
+    // Snapshot last tick's values for recurrent reads
+    for (int k = 0; k < static_cast<int>(prev_src_.size()); ++k) {
+        v[n_slots_ + k] = v[prev_src_[k]];
+    }
+
+    int actual_in = std::min(n_in, n_inputs_);
+    for (int i = 0; i < actual_in; ++i) v[i] = inputs[i];
+    for (int i = actual_in; i < n_inputs_; ++i) v[i] = 0.0f;
+
+    const Term* terms = terms_.data();
+    for (const auto& level : levels_) {
+        for (int s = level.node_begin; s < level.node_end; ++s) {
+            float sum = bias_[s];
+            for (int t = term_begin_[s]; t < term_begin_[s + 1]; ++t) {
+                sum += v[terms[t].src] * terms[t].weight;
+            }
+            v[s] = sum;
+        }
+        for (int r = level.run_begin; r < level.run_end; ++r) {
+            const auto& run = runs_[r];
+            apply_activation(run.fn, v + run.begin, run.end - run.begin, precision_);
+        }
+    }
+
+    int actual_out = std::min(n_out, output_count());
+    for (int i = 0; i < actual_out; ++i) outputs[i] = v[output_slots_[i]];
+    for (int i = actual_out; i < n_out; ++i) outputs[i] = 0.0f;
+}
+
+void NetworkTape::activate_batch(const BatchItem* items, int count,
+                                 std::vector<float>& scratch) const {
+    if (count <= 0) return;
+    const int b_n = count;
+    scratch.resize(static_cast<size_t>(state_size()) * b_n);
+    float* m = scratch.data();  // m[slot * b_n + b]
+
+    // Gather: node values from last tick, then snapshot the prev slots
+    for (int s = 0; s < n_slots_; ++s) {
+        float* row = m + s * b_n;
+        for (int b = 0; b < b_n; ++b) row[b] = items[b].state[s];
+    }
+    for (int k = 0; k < static_cast<int>(prev_src_.size()); ++k) {
+        float* row = m + (n_slots_ + k) * b_n;
+        const float* src = m + prev_src_[k] * b_n;
+        std::copy(src, src + b_n, row);
+    }
+
+    for (int b = 0; b < b_n; ++b) {
+        int actual_in = std::min(items[b].n_in, n_inputs_);
+        for (int i = 0; i < actual_in; ++i) m[i * b_n + b] = items[b].inputs[i];
+        for (int i = actual_in; i < n_inputs_; ++i) m[i * b_n + b] = 0.0f;
+    }
+
+    // Same per-instance summation order as activate(), one weight at a time
+    // across the batch
+    const Term* terms = terms_.data();
+    for (const auto& level : levels_) {
+        for (int s = level.node_begin; s < level.node_end; ++s) {
+            float* row = m + s * b_n;
+            std::fill(row, row + b_n, bias_[s]);
+            for (int t = term_begin_[s]; t < term_begin_[s + 1]; ++t) {
+                const float* src = m + terms[t].src * b_n;
+                float w = terms[t].weight;
+                for (int b = 0; b < b_n; ++b) row[b] += src[b] * w;
+            }
+        }
+        for (int r = level.run_begin; r < level.run_end; ++r) {
+            const auto& run = runs_[r];
+            apply_activation(run.fn, m + run.begin * b_n, (run.end - run.begin) * b_n, precision_);
+        }
+    }
+
+    // Scatter state and outputs back to each instance
+    for (int b = 0; b < b_n; ++b) {
+        float* state = items[b].state;
+        for (int s = 0; s < state_size(); ++s) state[s] = m[s * b_n + b];
+        int actual_out = std::min(items[b].n_out, output_count());
+        for (int i = 0; i < actual_out; ++i) items[b].outputs[i] = m[output_slots_[i] * b_n + b];
+        for (int i = actual_out; i < items[b].n_out; ++i) items[b].outputs[i] = 0.0f;
+    }
+}
+
+CompiledNetwork::CompiledNetwork(const NeatGenome& genome, ActivationPrecision precision)
+    : CompiledNetwork(std::make_shared<const NetworkTape>(genome, precision)) {}
+
+CompiledNetwork::CompiledNetwork(std::shared_ptr<const NetworkTape> tape)
+    : tape_(std::move(tape))
+    , values_(tape_->state_size(), 0.0f) {}
+
+void CompiledNetwork::activate(const float* inputs, int n_in,
+                               float* outputs, int n_out) {
+    tape_->activate(values_.data(), inputs, n_in, outputs, n_out);
+}
+
+void CompiledNetwork::reset() {
+    std::fill(values_.begin(), values_.end(), 0.0f);
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "brain/activation.h"
+#include "brain/processing_network.h"
+#include "brain/neat_genome.h"
+#include <memory>
+#include <vector>
+
+// NEAT genome compiled into a flat instruction tape.
+//
+// Produces bit-identical outputs to NeatNetwork (kept as the reference
+// implementation) but lays everything out for a tight evaluation loop:
+//   - every node lives in a dense value slot: inputs first, then evaluated
+//     nodes grouped by topological level, sorted by activation within a level
+//   - feed-forward weights are packed contiguously by target node, in genome
+//     order, so each node's sum adds terms in the same order as NeatNetwork
+//   - recurrent connections read dedicated "previous value" slots; only nodes
+//     that are actually read recurrently get one, and only those are copied
+//     at the start of a tick
+//   - nodes in a level never depend on each other, so each level sums all of
+//     its nodes and then applies one activation per run of same-type nodes
+// Bit-identity holds for ActivationPrecision::Exact; the approximate tiers
+// stay within the bounds documented in activation.h.
+class NetworkTape {
+public:
+    explicit NetworkTape(const NeatGenome& genome,
+                         ActivationPrecision precision = ActivationPrecision::Exact);
+
+    int input_count() const { return n_inputs_; }
+    int output_count() const { return static_cast<int>(output_slots_.size()); }
+
+    // Floats of per-instance state (node values plus prev slots)
+    int state_size() const { return n_slots_ + static_cast<int>(prev_src_.size()); }
+
+    // One tick for a single instance whose state is `v` (state_size() floats)
+    void activate(float* v, const float* inputs, int n_in,
+                  float* outputs, int n_out) const;
+
+    // One network instance in a batched evaluation
+    struct BatchItem {
+        float* state;          // state_size() floats, updated in place
+        const float* inputs;
+        int n_in;
+        float* outputs;
+        int n_out;
+    };
+
+    // One tick for `count` instances at once. State is gathered into a
+    // slot-major matrix (one row per slot, one column per instance) so each
+    // weight is applied across the whole batch in a single inner loop.
+    // Per-instance results are bit-identical to activate().
+    void activate_batch(const BatchItem* items, int count,
+                        std::vector<float>& scratch) const;
+
+private:
+    struct Term {
+        int src;       // value slot (a prev slot for recurrent connections)
+        float weight;
+    };
+
+    struct ActivationRun {
+        ActivationFn fn;
+        int begin;     // value slots [begin, end)
+        int end;
+    };
+
+    struct Level {
+        int node_begin;  // value slots [node_begin, node_end)
+        int node_end;
+        int run_begin;   // runs_ [run_begin, run_end)
+        int run_end;
+    };
+
+    ActivationPrecision precision_;
+    int n_inputs_ = 0;
+    int n_slots_ = 0;                 // node slots; prev slots follow
+    std::vector<float> bias_;         // per node slot (0 for inputs/unevaluated)
+    std::vector<int> term_begin_;     // per node slot + 1: CSR into terms_
+    std::vector<Term> terms_;
+    std::vector<ActivationRun> runs_;
+    std::vector<Level> levels_;
+    std::vector<int> prev_src_;       // node slot copied into prev slot n_slots_ + k
+    std::vector<int> output_slots_;
+};
+
+// ProcessingNetwork over a (possibly shared) NetworkTape. Boids cloned from
+// one genome can share a tape and keep only their own node values; World
+// evaluates such boids together through NetworkTape::activate_batch.
+class CompiledNetwork : public ProcessingNetwork {
+public:
+    explicit CompiledNetwork(const NeatGenome& genome,
+                             ActivationPrecision precision = ActivationPrecision::Exact);
+    explicit CompiledNetwork(std::shared_ptr<const NetworkTape> tape);
+
+    void activate(const float* inputs, int n_in,
+                  float* outputs, int n_out) override;
+    void reset() override;
+
+    int input_count() const { return tape_->input_count(); }
+    int output_count() const { return tape_->output_count(); }
+
+    const NetworkTape& tape() const { return *tape_; }
+    float* state() { return values_.data(); }
+
+private:
+    std::shared_ptr<const NetworkTape> tape_;
+    std::vector<float> values_;
+};
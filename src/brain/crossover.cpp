@@ -3,76 +3,138 @@
 #include <unordered_map>
 #include <unordered_set>
 
+namespace {
+
+// Ids of the nodes a child with these connections needs, ascending: every
+// endpoint, plus the fitter parent's inputs and outputs (always present)
+std::vector<int> needed_node_ids(const GeneView<ConnectionGene>& connections,
+                                 const NeatGenome& fitter_parent) {
+    std::unordered_set<int> needed;
+    for (const auto& c : connections) {
+        needed.insert(c.source);
+        needed.insert(c.target);
+    }
+    for (const auto& n : fitter_parent.nodes()) {
+        if (n.type == NodeType::Input || n.type == NodeType::Output) {
+            needed.insert(n.id);
+        }
+    }
+    std::vector<int> ids(needed.begin(), needed.end());
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+// The genome's nodes are exactly these ids, in this order
+bool has_node_ids(const NeatGenome& genome, const std::vector<int>& ids) {
+    if (genome.nodes().size() != ids.size()) return false;
+    for (size_t i = 0; i < ids.size(); ++i) {
+        if (genome.node(i).id != ids[i]) return false;
+    }
+    return true;
+}
+
+} // namespace
+
 NeatGenome crossover(const NeatGenome& fitter_parent,
                      const NeatGenome& other_parent,
                      std::mt19937& rng,
                      float disable_prob) {
+    NeatGenome offspring;
+    crossover(fitter_parent, other_parent, rng, offspring, disable_prob);
+    return offspring;
+}
+
+void crossover(const NeatGenome& fitter_parent,
+               const NeatGenome& other_parent,
+               std::mt19937& rng,
+               NeatGenome& offspring,
+               float disable_prob) {
     std::uniform_real_distribution<float> coin(0.0f, 1.0f);
+    const auto fitter_conns = fitter_parent.connections();
+    const auto other_conns = other_parent.connections();
 
     // Index other parent's connections by innovation number
-    std::unordered_map<int, const ConnectionGene*> other_conns;
-    for (const auto& c : other_parent.connections) {
-        other_conns[c.innovation] = &c;
+    std::unordered_map<int, size_t> other_index;
+    for (size_t i = 0; i < other_conns.size(); ++i) {
+        other_index[other_conns[i].innovation] = i;
     }
 
-    NeatGenome offspring;
+    // The child inherits the fitter parent's structure unless a matching
+    // gene is wired differently in the other parent. When the node list it
+    // would get is also the fitter parent's, the child shares that topology
+    // and only its weights and enabled flags are filled in.
+    bool wired_alike = true;
+    for (const auto& fc : fitter_conns) {
+        auto it = other_index.find(fc.innovation);
+        if (it == other_index.end()) continue;
+        ConnectionGene oc = other_conns[it->second];
+        if (oc.source != fc.source || oc.target != fc.target || oc.recurrent != fc.recurrent) {
+            wired_alike = false;
+            break;
+        }
+    }
+    if (wired_alike && has_node_ids(fitter_parent, needed_node_ids(fitter_conns, fitter_parent))) {
+        offspring = fitter_parent;
+        offspring.index.reset();
+        for (size_t i = 0; i < fitter_conns.size(); ++i) {
+            ConnectionGene fc = fitter_conns[i];
+            auto it = other_index.find(fc.innovation);
+            if (it == other_index.end()) continue;  // disjoint/excess: fitter parent's gene
+
+            // Matching gene: randomly pick from either parent
+            ConnectionGene oc = other_conns[it->second];
+            const ConnectionGene& chosen = (coin(rng) < 0.5f) ? fc : oc;
+            bool enabled = chosen.enabled;
+
+            // If disabled in either parent, disable_prob chance of being disabled
+            if (!fc.enabled || !oc.enabled) {
+                enabled = (coin(rng) >= disable_prob);
+            }
+
+            offspring.set_weight(i, chosen.weight);
+            offspring.set_enabled(i, enabled);
+        }
+        return;
+    }
+
+    offspring.clear();
 
     // Inherit connections
-    for (const auto& fc : fitter_parent.connections) {
-        auto it = other_conns.find(fc.innovation);
+    for (const auto& fc : fitter_conns) {
+        auto it = other_index.find(fc.innovation);
 
-        if (it != other_conns.end()) {
+        if (it != other_index.end()) {
             // Matching gene: randomly pick from either parent
-            const ConnectionGene& chosen = (coin(rng) < 0.5f) ? fc : *(it->second);
-            ConnectionGene gene = chosen;
+            ConnectionGene oc = other_conns[it->second];
+            ConnectionGene gene = (coin(rng) < 0.5f) ? fc : oc;
 
             // If disabled in either parent, disable_prob chance of being disabled
-            bool disabled_in_either = !fc.enabled || !it->second->enabled;
+            bool disabled_in_either = !fc.enabled || !oc.enabled;
             if (disabled_in_either) {
                 gene.enabled = (coin(rng) >= disable_prob);
             }
 
-            offspring.connections.push_back(gene);
+            offspring.add_connection(gene);
         } else {
             // Disjoint/excess gene from fitter parent — always inherit
-            offspring.connections.push_back(fc);
-        }
-    }
-
-    // Collect all node IDs referenced by offspring connections
-    std::unordered_set<int> needed_nodes;
-    for (const auto& c : offspring.connections) {
-        needed_nodes.insert(c.source);
-        needed_nodes.insert(c.target);
-    }
-
-    // Also include all input and output nodes (they must always be present)
-    for (const auto& n : fitter_parent.nodes) {
-        if (n.type == NodeType::Input || n.type == NodeType::Output) {
-            needed_nodes.insert(n.id);
+            offspring.add_connection(fc);
         }
     }
 
     // Build node map from both parents (fitter parent takes priority)
-    std::unordered_map<int, const NodeGene*> node_map;
-    for (const auto& n : other_parent.nodes) {
-        node_map[n.id] = &n;
+    std::unordered_map<int, NodeGene> node_map;
+    for (const auto& n : other_parent.nodes()) {
+        node_map[n.id] = n;
     }
-    for (const auto& n : fitter_parent.nodes) {
-        node_map[n.id] = &n;  // overwrite with fitter parent's version
+    for (const auto& n : fitter_parent.nodes()) {
+        node_map[n.id] = n;  // overwrite with fitter parent's version
     }
 
-    // Add needed nodes to offspring
-    for (int id : needed_nodes) {
+    // Add the needed nodes to offspring, by id for consistent ordering
+    for (int id : needed_node_ids(offspring.connections(), fitter_parent)) {
         auto it = node_map.find(id);
         if (it != node_map.end()) {
-            offspring.nodes.push_back(*(it->second));
+            offspring.add_node(it->second);
         }
     }
-
-    // Sort nodes by id for consistent ordering
-    std::sort(offspring.nodes.begin(), offspring.nodes.end(),
-              [](const NodeGene& a, const NodeGene& b) { return a.id < b.id; });
-
-    return offspring;
 }
@@ -12,3 +12,10 @@ NeatGenome crossover(const NeatGenome& fitter_parent,
                      const NeatGenome& other_parent,
                      std::mt19937& rng,
                      float disable_prob = 0.75f);
+
+// Same, writing into `offspring` so its existing capacity is reused.
+void crossover(const NeatGenome& fitter_parent,
+               const NeatGenome& other_parent,
+               std::mt19937& rng,
+               NeatGenome& offspring,
+               float disable_prob = 0.75f);
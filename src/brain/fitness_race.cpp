@@ -0,0 +1,55 @@
+#include "brain/fitness_race.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace {
+
+// Two-sided 95% critical values of Student's t for 1..30 degrees of freedom
+constexpr double T_95[] = {
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
+};
+
+double t_critical_95(int dof) {
+    constexpr int table = static_cast<int>(sizeof(T_95) / sizeof(T_95[0]));
+    return dof <= table ? T_95[dof - 1] : 1.960;
+}
+
+} // namespace
+
+FitnessRace::FitnessRace(int candidates)
+    : sum_(candidates, 0.0), sum_sq_(candidates, 0.0), count_(candidates, 0),
+      contenders_(candidates) {
+    std::iota(contenders_.begin(), contenders_.end(), 0);
+}
+
+void FitnessRace::add_sample(int idx, float fitness) {
+    sum_[idx] += fitness;
+    sum_sq_[idx] += static_cast<double>(fitness) * fitness;
+    ++count_[idx];
+}
+
+void FitnessRace::cut(float keep_fraction) {
+    int n = static_cast<int>(contenders_.size());
+    int keep = static_cast<int>(std::ceil(std::clamp(keep_fraction, 0.0f, 1.0f) * n));
+    keep = std::clamp(keep, std::min(n, 1), n);
+
+    std::stable_sort(contenders_.begin(), contenders_.end(),
+                     [this](int a, int b) { return mean(a) > mean(b); });
+    contenders_.resize(keep);
+    std::sort(contenders_.begin(), contenders_.end());
+}
+
+float FitnessRace::mean(int idx) const {
+    return count_[idx] > 0 ? static_cast<float>(sum_[idx] / count_[idx]) : 0.0f;
+}
+
+float FitnessRace::confidence(int idx) const {
+    int n = count_[idx];
+    if (n < 2) return std::nanf("");
+    double m = sum_[idx] / n;
+    double var = std::max(0.0, (sum_sq_[idx] - n * m * m) / (n - 1));
+    return static_cast<float>(t_critical_95(n - 1) * std::sqrt(var / n));
+}
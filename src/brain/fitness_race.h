@@ -0,0 +1,37 @@
+#pragma once
+
+#include <vector>
+
+// Successive-halving bookkeeping for noisy fitness evaluation.
+//
+// Every candidate starts in the race. Episodes add fitness samples for the
+// contenders; cut() then drops all but the best fraction, so later
+// episodes only re-evaluate the promising ones. A candidate's score is the
+// mean of the samples it collected before being cut.
+class FitnessRace {
+public:
+    explicit FitnessRace(int candidates);
+
+    // Indices still racing, ascending
+    const std::vector<int>& contenders() const { return contenders_; }
+
+    // Record one fitness sample for candidate idx
+    void add_sample(int idx, float fitness);
+
+    // Keep the top ceil(keep_fraction * contenders) by mean (at least one);
+    // ties go to the lower index.
+    void cut(float keep_fraction);
+
+    float mean(int idx) const;
+    int samples(int idx) const { return count_[idx]; }
+
+    // Half-width of the 95% confidence interval of mean(idx), from the
+    // Student t distribution. NaN with fewer than two samples.
+    float confidence(int idx) const;
+
+private:
+    std::vector<double> sum_;
+    std::vector<double> sum_sq_;
+    std::vector<int> count_;
+    std::vector<int> contenders_;
+};
@@ -0,0 +1,237 @@
+#include "brain/genome_index.h"
+#include "brain/neat_genome.h"
+#include <algorithm>
+#include <climits>
+
+GenomeIndex::GenomeIndex(const NeatGenome& genome) {
+    for (const auto& node : genome.nodes()) add_node(node);
+    for (const auto& c : genome.connections()) {
+        ensure(std::max(c.source, c.target));
+        ++edges_[key(c.source, c.target)];
+        change_degree(c.source, +1);
+        change_degree(c.target, +1);
+        if (c.enabled && !c.recurrent) {
+            out_[c.source].push_back(c.target);
+            in_[c.target].push_back(c.source);
+        }
+    }
+    rebuild_order();
+}
+
+bool GenomeIndex::has_connection(int source, int target) const {
+    return edges_.count(key(source, target)) > 0;
+}
+
+bool GenomeIndex::reaches(int from, int to) const {
+    if (from == to) return true;
+    int n = static_cast<int>(out_.size());
+    if (from < 0 || from >= n || to < 0 || to >= n) return false;
+
+    // Every feed-forward path climbs the order, so nothing past `to` can lead to it
+    if (ordered_ && ord_[from] > ord_[to]) return false;
+    int bound = ordered_ ? ord_[to] : INT_MAX;
+
+    int stamp = next_stamp();
+    stack_.clear();
+    stack_.push_back(from);
+    mark_[from] = stamp;
+    while (!stack_.empty()) {
+        int current = stack_.back();
+        stack_.pop_back();
+        for (int next : out_[current]) {
+            if (next == to) return true;
+            if (mark_[next] == stamp || ord_[next] > bound) continue;
+            mark_[next] = stamp;
+            stack_.push_back(next);
+        }
+    }
+    return false;
+}
+
+int GenomeIndex::max_node_id() const {
+    for (int id = static_cast<int>(kind_.size()) - 1; id > 0; --id) {
+        if (kind_[id] != Absent) return id;
+    }
+    return 0;
+}
+
+bool GenomeIndex::is_orphan(int id) const {
+    return id >= 0 && id < static_cast<int>(kind_.size()) &&
+           kind_[id] == Hidden && degree_[id] == 0;
+}
+
+void GenomeIndex::add_node(const NodeGene& node) {
+    ensure(node.id);
+    bool was_orphan = is_orphan(node.id);
+    kind_[node.id] = node.type == NodeType::Hidden ? Hidden : Fixed;
+    orphans_ += static_cast<int>(is_orphan(node.id)) - static_cast<int>(was_orphan);
+}
+
+void GenomeIndex::remove_node(int id) {
+    if (id < 0 || id >= static_cast<int>(kind_.size())) return;
+    if (is_orphan(id)) --orphans_;
+    kind_[id] = Absent;
+}
+
+void GenomeIndex::add_connection(const ConnectionGene& c) {
+    ensure(std::max(c.source, c.target));
+    ++edges_[key(c.source, c.target)];
+    change_degree(c.source, +1);
+    change_degree(c.target, +1);
+    if (c.enabled && !c.recurrent) link(c.source, c.target);
+}
+
+void GenomeIndex::remove_connection(const ConnectionGene& c) {
+    auto it = edges_.find(key(c.source, c.target));
+    if (it == edges_.end()) return;
+    if (--it->second == 0) edges_.erase(it);
+    change_degree(c.source, -1);
+    change_degree(c.target, -1);
+    if (c.enabled && !c.recurrent) unlink(c.source, c.target);
+}
+
+void GenomeIndex::connection_toggled(const ConnectionGene& c) {
+    if (c.recurrent) return;
+    if (c.enabled) {
+        link(c.source, c.target);
+    } else {
+        unlink(c.source, c.target);
+    }
+}
+
+void GenomeIndex::ensure(int id) {
+    int n = static_cast<int>(out_.size());
+    if (id < n) return;
+    out_.resize(id + 1);
+    in_.resize(id + 1);
+    degree_.resize(id + 1, 0);
+    kind_.resize(id + 1, Absent);
+    mark_.resize(id + 1, 0);
+    // New ids have no edges yet, so they can go anywhere; put them last
+    for (int i = n; i <= id; ++i) ord_.push_back(next_ord_++);
+}
+
+int GenomeIndex::next_stamp() const {
+    if (stamp_ == INT_MAX) {
+        std::fill(mark_.begin(), mark_.end(), 0);
+        stamp_ = 0;
+    }
+    return ++stamp_;
+}
+
+void GenomeIndex::change_degree(int id, int delta) {
+    bool was_orphan = is_orphan(id);
+    degree_[id] += delta;
+    orphans_ += static_cast<int>(is_orphan(id)) - static_cast<int>(was_orphan);
+}
+
+void GenomeIndex::link(int source, int target) {
+    ensure(std::max(source, target));
+    out_[source].push_back(target);
+    in_[target].push_back(source);
+    if (!ordered_ || ord_[source] < ord_[target]) return;
+    if (source == target) {
+        ordered_ = false;
+        return;
+    }
+
+    // Pearce-Kelly: only nodes whose position lies between target and source
+    // can be out of order. Collect those reachable forward from target and
+    // backward from source, then give the backward set the lower positions.
+    int lower = ord_[target];
+    int upper = ord_[source];
+
+    std::vector<int> forward;
+    int stamp = next_stamp();
+    stack_.clear();
+    stack_.push_back(target);
+    mark_[target] = stamp;
+    while (!stack_.empty()) {
+        int current = stack_.back();
+        stack_.pop_back();
+        forward.push_back(current);
+        for (int next : out_[current]) {
+            if (next == source) {
+                ordered_ = false;  // the new edge closes a cycle
+                return;
+            }
+            if (mark_[next] == stamp || ord_[next] > upper) continue;
+            mark_[next] = stamp;
+            stack_.push_back(next);
+        }
+    }
+
+    std::vector<int> backward;
+    stamp = next_stamp();
+    stack_.push_back(source);
+    mark_[source] = stamp;
+    while (!stack_.empty()) {
+        int current = stack_.back();
+        stack_.pop_back();
+        backward.push_back(current);
+        for (int prev : in_[current]) {
+            if (mark_[prev] == stamp || ord_[prev] < lower) continue;
+            mark_[prev] = stamp;
+            stack_.push_back(prev);
+        }
+    }
+
+    auto by_order = [&](int a, int b) { return ord_[a] < ord_[b]; };
+    std::sort(forward.begin(), forward.end(), by_order);
+    std::sort(backward.begin(), backward.end(), by_order);
+
+    std::vector<int> pool;
+    pool.reserve(forward.size() + backward.size());
+    for (int id : backward) pool.push_back(ord_[id]);
+    for (int id : forward) pool.push_back(ord_[id]);
+    std::sort(pool.begin(), pool.end());
+
+    size_t k = 0;
+    for (int id : backward) ord_[id] = pool[k++];
+    for (int id : forward) ord_[id] = pool[k++];
+}
+
+void GenomeIndex::unlink(int source, int target) {
+    int n = static_cast<int>(out_.size());
+    if (source < 0 || source >= n || target < 0 || target >= n) return;
+
+    auto drop_one = [](std::vector<int>& list, int value) {
+        auto it = std::find(list.begin(), list.end(), value);
+        if (it == list.end()) return false;
+        *it = list.back();
+        list.pop_back();
+        return true;
+    };
+    if (!drop_one(out_[source], target)) return;
+    drop_one(in_[target], source);
+
+    // Removing an edge keeps a valid order valid, but may break a cycle
+    if (!ordered_) rebuild_order();
+}
+
+void GenomeIndex::rebuild_order() {
+    // Kahn's algorithm over the feed-forward graph
+    int n = static_cast<int>(out_.size());
+    std::vector<int> pending(n);
+    std::vector<int> ready;
+    for (int id = 0; id < n; ++id) {
+        pending[id] = static_cast<int>(in_[id].size());
+        if (pending[id] == 0) ready.push_back(id);
+    }
+
+    std::vector<int> order;
+    order.reserve(n);
+    while (!ready.empty()) {
+        int current = ready.back();
+        ready.pop_back();
+        order.push_back(current);
+        for (int next : out_[current]) {
+            if (--pending[next] == 0) ready.push_back(next);
+        }
+    }
+
+    ordered_ = static_cast<int>(order.size()) == n;
+    if (!ordered_) return;
+    for (int k = 0; k < n; ++k) ord_[order[k]] = k;
+    next_ord_ = n;
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+struct NodeGene;
+struct ConnectionGene;
+struct NeatGenome;
+
+// Structural index over a NeatGenome, kept current by the structural
+// mutations instead of rescanning the connection list:
+//   - the set of (source, target) pairs, enabled or not
+//   - feed-forward adjacency (enabled, non-recurrent connections) both ways
+//   - per-node connection counts, so orphaned hidden nodes are found directly
+//   - a topological order of the feed-forward graph, maintained with the
+//     Pearce-Kelly insertion algorithm. Reachability searches only visit
+//     nodes between the two endpoints in that order.
+// A feed-forward-only genome can still pick up a cycle (mutate_add_connection
+// does not check for them when recurrence is off). The order is then dropped
+// and searches fall back to a plain DFS until a removal breaks the cycle.
+//
+// Node ids index the arrays directly; NEAT hands them out densely.
+// Queries reuse internal scratch, so one index must not be queried from two
+// threads at once.
+class GenomeIndex {
+public:
+    GenomeIndex() = default;
+    explicit GenomeIndex(const NeatGenome& genome);
+
+    // Any connection source -> target exists (enabled or not)
+    bool has_connection(int source, int target) const;
+
+    // `to` is reachable from `from` over enabled feed-forward connections
+    // (every node reaches itself). Adding from -> to would close a cycle
+    // exactly when reaches(to, from).
+    bool reaches(int from, int to) const;
+
+    // Largest node id in the genome, or 0 if there is none
+    int max_node_id() const;
+
+    // Hidden nodes with no connections left
+    int orphan_count() const { return orphans_; }
+    bool is_orphan(int id) const;
+
+    // True while the feed-forward graph is acyclic and the order is in use
+    bool ordered() const { return ordered_; }
+
+    // Updates, to be called alongside the matching edit of the genome.
+    void add_node(const NodeGene& node);
+    void remove_node(int id);
+    void add_connection(const ConnectionGene& c);
+    void remove_connection(const ConnectionGene& c);
+    void connection_toggled(const ConnectionGene& c);  // after c.enabled flipped
+
+private:
+    enum : uint8_t { Absent = 0, Hidden = 1, Fixed = 2 };
+
+    std::unordered_map<uint64_t, int> edges_;  // (source, target) -> connection count
+    std::vector<std::vector<int>> out_;        // feed-forward successors per id
+    std::vector<std::vector<int>> in_;         // feed-forward predecessors per id
+    std::vector<int> degree_;                  // connection endpoints per id
+    std::vector<uint8_t> kind_;
+    std::vector<int> ord_;                     // topological position per id
+    int next_ord_ = 0;
+    bool ordered_ = true;
+    int orphans_ = 0;
+
+    mutable std::vector<int> mark_;
+    mutable int stamp_ = 0;
+    mutable std::vector<int> stack_;
+
+    static uint64_t key(int source, int target) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(source)) << 32) |
+               static_cast<uint32_t>(target);
+    }
+
+    void ensure(int id);
+    int next_stamp() const;
+    void change_degree(int id, int delta);
+    void link(int source, int target);
+    void unlink(int source, int target);
+    void rebuild_order();
+};
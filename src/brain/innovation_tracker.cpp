@@ -1,16 +1,26 @@
 #include "brain/innovation_tracker.h"
 
+InnovationTracker::InnovationTracker(int start_innovation, int classes, int class_index)
+    : classes_(classes), class_index_(class_index),
+      next_innovation_(next_in_class(start_innovation)) {}
+
+int InnovationTracker::next_in_class(int value) const {
+    int offset = ((class_index_ - value) % classes_ + classes_) % classes_;
+    return value + offset;
+}
+
 int InnovationTracker::get_or_create(int source_node, int target_node) {
-    auto key = std::make_pair(source_node, target_node);
-    auto it = this_gen_cache_.find(key);
-    if (it != this_gen_cache_.end()) {
-        return it->second;
+    uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(source_node)) << 32) |
+                   static_cast<uint32_t>(target_node);
+    auto [it, inserted] = this_gen_cache_.try_emplace(key, next_innovation_);
+    if (inserted) {
+        next_innovation_ += classes_;
+        created_.emplace_back(source_node, target_node);
     }
-    int innov = next_innovation_++;
-    this_gen_cache_[key] = innov;
-    return innov;
+    return it->second;
 }
 
 void InnovationTracker::new_generation() {
     this_gen_cache_.clear();
+    created_.clear();
 }
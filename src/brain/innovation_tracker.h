@@ -1,15 +1,23 @@
 #pragma once
 
-#include <map>
+#include <cstdint>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 // Tracks innovation numbers for structural mutations within a generation.
 // Same source→target mutation in the same generation gets the same innovation number.
 // Call new_generation() between generations to reset the cache.
+//
+// Populations that evolve apart and exchange genomes (islands) number in
+// disjoint classes: with `classes` of them, tracker `class_index` hands out
+// only innovation numbers and hidden node ids congruent to class_index
+// modulo classes, so neither ever names two different genes across islands.
+// A single class (the default) numbers densely.
 class InnovationTracker {
 public:
-    explicit InnovationTracker(int start_innovation = 1)
-        : next_innovation_(start_innovation) {}
+    // Numbering starts at the first value >= start_innovation in the class
+    explicit InnovationTracker(int start_innovation = 1, int classes = 1, int class_index = 0);
 
     // Get an existing innovation number for this source→target pair (if seen this
     // generation), or assign a new one.
@@ -19,8 +27,23 @@ public:
     void new_generation();
 
     int next_innovation() const { return next_innovation_; }
+    int classes() const { return classes_; }
+    int class_index() const { return class_index_; }
+
+    // Id for a new hidden node in a genome whose largest node id is
+    // max_node_id: the next id above it in this tracker's class.
+    int new_node_id(int max_node_id) const { return next_in_class(max_node_id + 1); }
+
+    // Pairs numbered this generation, in the order their numbers were assigned
+    // (pair k got the k-th number handed out since the last new_generation()).
+    const std::vector<std::pair<int,int>>& created() const { return created_; }
 
 private:
+    int next_in_class(int value) const;
+
+    int classes_;
+    int class_index_;
     int next_innovation_;
-    std::map<std::pair<int,int>, int> this_gen_cache_;
+    std::unordered_map<uint64_t, int> this_gen_cache_;
+    std::vector<std::pair<int,int>> created_;
 };
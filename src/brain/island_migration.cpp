@@ -0,0 +1,60 @@
+#include "brain/island_migration.h"
+
+Emigrants collect_emigrants(const Population& pop, int count) {
+    Emigrants out;
+    for (int idx : pop.top_indices(count)) {
+        out.genomes.push_back(pop.genome(idx));
+        out.fitness.push_back(pop.fitness(idx));
+        if (pop.has_morphology()) out.morphologies.push_back(pop.morphology(idx));
+    }
+    return out;
+}
+
+std::vector<int> migration_sources(int island, int island_count, MigrationTopology topology) {
+    std::vector<int> sources;
+    if (island_count < 2) return sources;
+    if (topology == MigrationTopology::Ring) {
+        sources.push_back((island + island_count - 1) % island_count);
+    } else {
+        for (int i = 0; i < island_count; ++i) {
+            if (i != island) sources.push_back(i);
+        }
+    }
+    return sources;
+}
+
+bool migration_due(const IslandConfig& cfg, int generation) {
+    return cfg.count > 1 && cfg.migration_interval > 0 &&
+           (generation + 1) % cfg.migration_interval == 0;
+}
+
+static void receive(Population& pop, const std::vector<Emigrants>& out,
+                    const std::vector<int>& sources) {
+    Emigrants in;
+    for (int i : sources) {
+        const Emigrants& e = out[i];
+        in.genomes.insert(in.genomes.end(), e.genomes.begin(), e.genomes.end());
+        in.fitness.insert(in.fitness.end(), e.fitness.begin(), e.fitness.end());
+        in.morphologies.insert(in.morphologies.end(), e.morphologies.begin(), e.morphologies.end());
+    }
+    pop.immigrate(in.genomes, in.fitness, &in.morphologies);
+}
+
+void migrate(const std::vector<Population*>& prey, const std::vector<Population*>& predators,
+             const IslandConfig& cfg) {
+    const int n = static_cast<int>(prey.size());
+    const bool has_predators = !predators.empty();
+    std::vector<Emigrants> prey_out(n), pred_out(n);
+    for (int i = 0; i < n; ++i) {
+        prey_out[i] = collect_emigrants(*prey[i], cfg.migrants);
+        if (has_predators && predators[i]) {
+            pred_out[i] = collect_emigrants(*predators[i], cfg.migrants);
+        }
+    }
+
+    for (int j = 0; j < n; ++j) {
+        std::vector<int> sources = migration_sources(j, n, cfg.topology);
+        receive(*prey[j], prey_out, sources);
+        if (has_predators && predators[j]) receive(*predators[j], pred_out, sources);
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "brain/population.h"
+#include <vector>
+
+// Which islands send their champions to which (headless island mode)
+enum class MigrationTopology {
+    Ring,  // island i sends to island i+1 (wrapping)
+    Full   // every island sends to every other
+};
+
+struct IslandConfig {
+    int count = 1;                // independent populations evolved side by side
+    int migration_interval = 10;  // generations between migrations (0 = never)
+    int migrants = 1;             // champions each island sends per migration
+    MigrationTopology topology = MigrationTopology::Ring;
+};
+
+// Champions leaving one population during a migration
+struct Emigrants {
+    std::vector<NeatGenome> genomes;
+    std::vector<float> fitness;
+    std::vector<MorphologyGenome> morphologies;
+};
+
+// The `count` fittest genomes of pop, best first, with their fitness and morphology.
+Emigrants collect_emigrants(const Population& pop, int count);
+
+// Islands whose champions island `island` receives, in ascending order.
+std::vector<int> migration_sources(int island, int island_count, MigrationTopology topology);
+
+// True when migration should happen after evaluating `generation`.
+bool migration_due(const IslandConfig& cfg, int generation);
+
+// Send each island's champions to its neighbours under the topology, replacing
+// the receivers' weakest genomes. Every island's champions are collected
+// before any island receives, so the result doesn't depend on visiting order.
+// `predators` is empty or has one entry per island; null entries are skipped.
+void migrate(const std::vector<Population*>& prey, const std::vector<Population*>& predators,
+             const IslandConfig& cfg);
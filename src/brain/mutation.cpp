@@ -1,7 +1,6 @@
 #include "brain/mutation.h"
-#include <algorithm>
-#include <set>
-#include <unordered_set>
+#include "brain/genome_index.h"
+#include <optional>
 
 void mutate_weights(NeatGenome& genome, std::mt19937& rng,
                     float perturb_prob, float sigma, float replace_prob) {
@@ -9,67 +8,46 @@ void mutate_weights(NeatGenome& genome, std::mt19937& rng,
     std::normal_distribution<float> perturb(0.0f, sigma);
     std::uniform_real_distribution<float> fresh(-2.0f, 2.0f);
 
-    for (auto& c : genome.connections) {
+    for (size_t i = 0; i < genome.connections().size(); ++i) {
         float r = coin(rng);
         if (r < replace_prob) {
-            c.weight = fresh(rng);
+            genome.set_weight(i, fresh(rng));
         } else if (r < replace_prob + perturb_prob) {
-            c.weight += perturb(rng);
+            genome.set_weight(i, genome.connection(i).weight + perturb(rng));
         }
         // else: leave unchanged
     }
 }
 
-// Check if 'target_id' can reach 'source_id' through existing feed-forward connections.
-// If so, adding source→target would create a cycle, meaning it must be recurrent.
-static bool creates_cycle(const NeatGenome& genome, int source_id, int target_id) {
-    // DFS from target through non-recurrent connections to see if we reach source
-    std::unordered_set<int> visited;
-    std::vector<int> stack = {target_id};
-
-    while (!stack.empty()) {
-        int current = stack.back();
-        stack.pop_back();
-        if (current == source_id) return true;
-        if (visited.count(current)) continue;
-        visited.insert(current);
-
-        for (const auto& c : genome.connections) {
-            if (!c.enabled || c.recurrent) continue;
-            if (c.source == current) {
-                stack.push_back(c.target);
-            }
-        }
-    }
-    return false;
+// The genome's own index if it carries one, otherwise one built for this call
+static GenomeIndex& index_for(NeatGenome& genome, std::optional<GenomeIndex>& temp) {
+    if (GenomeIndex* own = genome.own_index()) return *own;
+    return temp.emplace(genome);
 }
 
 bool mutate_add_connection(NeatGenome& genome, std::mt19937& rng,
                            InnovationTracker& tracker,
                            int max_attempts,
                            bool allow_recurrent) {
-    if (genome.nodes.size() < 2) return false;
+    if (genome.nodes().size() < 2) return false;
 
-    // Build set of existing connections for quick lookup
-    std::set<std::pair<int,int>> existing;
-    for (const auto& c : genome.connections) {
-        existing.insert({c.source, c.target});
-    }
+    std::optional<GenomeIndex> temp;
+    GenomeIndex& index = index_for(genome, temp);
 
-    std::uniform_int_distribution<int> node_dist(0, static_cast<int>(genome.nodes.size()) - 1);
+    std::uniform_int_distribution<int> node_dist(0, static_cast<int>(genome.nodes().size()) - 1);
 
     for (int attempt = 0; attempt < max_attempts; ++attempt) {
         int si = node_dist(rng);
         int ti = node_dist(rng);
 
-        const auto& src = genome.nodes[si];
-        const auto& tgt = genome.nodes[ti];
+        const NodeGene src = genome.node(si);
+        const NodeGene tgt = genome.node(ti);
 
         // Never connect TO an input node (inputs only receive external sensor data)
         if (tgt.type == NodeType::Input) continue;
 
         // Check for existing connection
-        if (existing.count({src.id, tgt.id})) continue;
+        if (index.has_connection(src.id, tgt.id)) continue;
 
         if (allow_recurrent) {
             // Allow self-connections on hidden nodes (always recurrent)
@@ -79,14 +57,15 @@ bool mutate_add_connection(NeatGenome& genome, std::mt19937& rng,
             // Don't allow output→output (not useful)
             if (src.type == NodeType::Output && tgt.type == NodeType::Output) continue;
 
-            // Determine if this connection is recurrent
-            bool is_recurrent = is_self || creates_cycle(genome, src.id, tgt.id);
+            // Recurrent if the target can already reach the source feed-forward
+            bool is_recurrent = is_self || index.reaches(tgt.id, src.id);
 
             // Output nodes can only be sources of recurrent connections
             if (src.type == NodeType::Output && !is_recurrent) continue;
 
             int innov = tracker.get_or_create(src.id, tgt.id);
-            genome.connections.push_back({innov, src.id, tgt.id, 0.0f, true, is_recurrent});
+            genome.add_connection({innov, src.id, tgt.id, 0.0f, true, is_recurrent});
+            index.add_connection(genome.connections().back());
             return true;
         } else {
             // Feed-forward only: original constraints
@@ -95,7 +74,8 @@ bool mutate_add_connection(NeatGenome& genome, std::mt19937& rng,
             if (src.type == NodeType::Output) continue;
 
             int innov = tracker.get_or_create(src.id, tgt.id);
-            genome.connections.push_back({innov, src.id, tgt.id, 0.0f, true, false});
+            genome.add_connection({innov, src.id, tgt.id, 0.0f, true, false});
+            index.add_connection(genome.connections().back());
             return true;
         }
     }
@@ -107,8 +87,8 @@ bool mutate_add_node(NeatGenome& genome, std::mt19937& rng,
                      InnovationTracker& tracker) {
     // Collect indices of enabled connections
     std::vector<int> enabled_indices;
-    for (int i = 0; i < static_cast<int>(genome.connections.size()); ++i) {
-        if (genome.connections[i].enabled) {
+    for (int i = 0; i < static_cast<int>(genome.connections().size()); ++i) {
+        if (genome.connection(i).enabled) {
             enabled_indices.push_back(i);
         }
     }
@@ -118,76 +98,74 @@ bool mutate_add_node(NeatGenome& genome, std::mt19937& rng,
     std::uniform_int_distribution<int> dist(0, static_cast<int>(enabled_indices.size()) - 1);
     int ci = enabled_indices[dist(rng)];
 
-    // Copy values before modifying the vector (push_back can reallocate and
-    // invalidate references into genome.connections)
-    int src_id = genome.connections[ci].source;
-    int tgt_id = genome.connections[ci].target;
-    float orig_weight = genome.connections[ci].weight;
-    bool orig_recurrent = genome.connections[ci].recurrent;
+    std::optional<GenomeIndex> temp;
+    GenomeIndex& index = index_for(genome, temp);
+
+    const ConnectionGene split = genome.connection(ci);
+    int src_id = split.source;
+    int tgt_id = split.target;
+    float orig_weight = split.weight;
+    bool orig_recurrent = split.recurrent;
 
     // Disable the original connection
-    genome.connections[ci].enabled = false;
+    genome.set_enabled(ci, false);
+    index.connection_toggled(genome.connection(ci));
 
-    // Create a new hidden node with the next available id
-    int max_id = 0;
-    for (const auto& n : genome.nodes) {
-        max_id = std::max(max_id, n.id);
-    }
-    int new_id = max_id + 1;
+    // Create a new hidden node with the next available id in the tracker's class
+    int new_id = tracker.new_node_id(index.max_node_id());
+    genome.add_node({new_id, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
+    index.add_node(genome.nodes().back());
 
-    genome.nodes.push_back({new_id, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
+    // If the original connection was recurrent, source → new_node closes a
+    // cycle exactly when target already reaches source feed-forward (the new
+    // node's only way back to source is through target). It is then marked
+    // recurrent; new_node → target never closes one, since new_node's only
+    // input is the connection from source.
+    bool first_recurrent = orig_recurrent && index.reaches(tgt_id, src_id);
 
     // source → new_node with weight 1.0 (preserves signal magnitude)
     int innov1 = tracker.get_or_create(src_id, new_id);
-    genome.connections.push_back({innov1, src_id, new_id, 1.0f, true, false});
+    genome.add_connection({innov1, src_id, new_id, 1.0f, true, first_recurrent});
+    index.add_connection(genome.connections().back());
 
     // new_node → target with original weight (preserves existing behaviour)
     int innov2 = tracker.get_or_create(new_id, tgt_id);
-    genome.connections.push_back({innov2, new_id, tgt_id, orig_weight, true, false});
-
-    // If the original connection was recurrent, check whether either new
-    // connection creates a cycle in the feed-forward subgraph and mark it
-    // recurrent accordingly. Must mark sequentially: once the first is
-    // marked recurrent, it's excluded from the DFS for the second check.
-    if (orig_recurrent) {
-        if (creates_cycle(genome, src_id, new_id)) {
-            genome.connections[genome.connections.size() - 2].recurrent = true;
-        }
-        if (creates_cycle(genome, new_id, tgt_id)) {
-            genome.connections[genome.connections.size() - 1].recurrent = true;
-        }
-    }
+    genome.add_connection({innov2, new_id, tgt_id, orig_weight, true, false});
+    index.add_connection(genome.connections().back());
 
     return true;
 }
 
 void mutate_toggle_connection(NeatGenome& genome, std::mt19937& rng) {
-    if (genome.connections.empty()) return;
-    std::uniform_int_distribution<int> dist(0, static_cast<int>(genome.connections.size()) - 1);
-    auto& c = genome.connections[dist(rng)];
-    c.enabled = !c.enabled;
+    if (genome.connections().empty()) return;
+    std::uniform_int_distribution<int> dist(0, static_cast<int>(genome.connections().size()) - 1);
+    int ci = dist(rng);
+    genome.set_enabled(ci, !genome.connection(ci).enabled);
+    if (GenomeIndex* own = genome.own_index()) own->connection_toggled(genome.connection(ci));
 }
 
 bool mutate_delete_connection(NeatGenome& genome, std::mt19937& rng) {
-    if (genome.connections.empty()) return false;
+    if (genome.connections().empty()) return false;
 
-    std::uniform_int_distribution<int> dist(0, static_cast<int>(genome.connections.size()) - 1);
+    std::uniform_int_distribution<int> dist(0, static_cast<int>(genome.connections().size()) - 1);
     int ci = dist(rng);
-    genome.connections.erase(genome.connections.begin() + ci);
+
+    std::optional<GenomeIndex> temp;
+    GenomeIndex& index = index_for(genome, temp);
+    index.remove_connection(genome.connection(ci));
+    genome.remove_connection(ci);
 
     // Clean up orphaned hidden nodes (nodes with no remaining connections)
-    std::unordered_set<int> connected_nodes;
-    for (const auto& c : genome.connections) {
-        connected_nodes.insert(c.source);
-        connected_nodes.insert(c.target);
+    if (index.orphan_count() > 0) {
+        std::vector<int> orphans;
+        for (size_t i = genome.nodes().size(); i-- > 0;) {
+            int id = genome.node(i).id;
+            if (!index.is_orphan(id)) continue;
+            orphans.push_back(id);
+            genome.remove_node(i);
+        }
+        for (int id : orphans) index.remove_node(id);
     }
 
-    genome.nodes.erase(
-        std::remove_if(genome.nodes.begin(), genome.nodes.end(),
-            [&](const NodeGene& n) {
-                return n.type == NodeType::Hidden && !connected_nodes.count(n.id);
-            }),
-        genome.nodes.end());
-
     return true;
 }
@@ -1,23 +1,30 @@
 #include "brain/neat_genome.h"
+#include "brain/genome_index.h"
+
+NeatGenome::NeatGenome(const std::vector<NodeGene>& nodes,
+                       const std::vector<ConnectionGene>& connections) {
+    for (const auto& n : nodes) add_node(n);
+    for (const auto& c : connections) add_connection(c);
+}
 
 NeatGenome NeatGenome::minimal(int n_inputs, int n_outputs, int& next_innovation) {
     NeatGenome genome;
 
     // Input nodes: ids [0, n_inputs)
     for (int i = 0; i < n_inputs; ++i) {
-        genome.nodes.push_back({i, NodeType::Input, ActivationFn::Linear, 0.0f});
+        genome.add_node({i, NodeType::Input, ActivationFn::Linear, 0.0f});
     }
 
     // Output nodes: ids [n_inputs, n_inputs + n_outputs)
     // Sigmoid activation so outputs are naturally [0, 1] for thruster commands
     for (int i = 0; i < n_outputs; ++i) {
-        genome.nodes.push_back({n_inputs + i, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
+        genome.add_node({n_inputs + i, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
     }
 
     // Fully connected: every input → every output
     for (int i = 0; i < n_inputs; ++i) {
         for (int o = 0; o < n_outputs; ++o) {
-            genome.connections.push_back({
+            genome.add_connection({
                 next_innovation++,
                 i,                  // source (input node id)
                 n_inputs + o,       // target (output node id)
@@ -29,3 +36,66 @@ NeatGenome NeatGenome::minimal(int n_inputs, int n_outputs, int& next_innovation
 
     return genome;
 }
+
+void NeatGenome::add_node(const NodeGene& node) {
+    own_topology().nodes.push_back({node.id, node.type, node.activation});
+    bias_.push_back(node.bias);
+}
+
+void NeatGenome::add_connection(const ConnectionGene& connection) {
+    own_topology().connections.push_back(
+        {connection.innovation, connection.source, connection.target, connection.recurrent});
+    weight_.push_back(connection.weight);
+    enabled_.push_back(connection.enabled);
+}
+
+void NeatGenome::remove_node(size_t i) {
+    auto& nodes = own_topology().nodes;
+    nodes.erase(nodes.begin() + static_cast<std::ptrdiff_t>(i));
+    bias_.erase(bias_.begin() + static_cast<std::ptrdiff_t>(i));
+}
+
+void NeatGenome::remove_connection(size_t i) {
+    auto& connections = own_topology().connections;
+    auto at = static_cast<std::ptrdiff_t>(i);
+    connections.erase(connections.begin() + at);
+    weight_.erase(weight_.begin() + at);
+    enabled_.erase(enabled_.begin() + at);
+}
+
+void NeatGenome::set_innovation(size_t connection, int innovation) {
+    own_topology().connections[connection].innovation = innovation;
+}
+
+void NeatGenome::clear() {
+    if (topology_ && topology_.use_count() == 1) {
+        topology_->nodes.clear();
+        topology_->connections.clear();
+    } else {
+        topology_.reset();
+    }
+    bias_.clear();
+    weight_.clear();
+    enabled_.clear();
+    index.reset();
+}
+
+GenomeTopology& NeatGenome::own_topology() {
+    if (!topology_) {
+        topology_ = std::make_shared<GenomeTopology>();
+    } else if (topology_.use_count() > 1) {
+        topology_ = std::make_shared<GenomeTopology>(*topology_);
+    }
+    return *topology_;
+}
+
+void NeatGenome::build_index() {
+    index = std::make_shared<GenomeIndex>(*this);
+}
+
+GenomeIndex* NeatGenome::own_index() {
+    if (index && index.use_count() > 1) {
+        index = std::make_shared<GenomeIndex>(*index);
+    }
+    return index.get();
+}
@@ -1,10 +1,20 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
 #include <vector>
 
+class GenomeIndex;
+
 enum class NodeType { Input, Output, Hidden };
 enum class ActivationFn { Sigmoid, Tanh, ReLU, Linear };
 
+// A whole node or connection gene. NeatGenome stores the structural fields
+// and the per-individual values separately; these are what its accessors
+// return and what its structural edits take.
 struct NodeGene {
     int id;
     NodeType type;
@@ -21,12 +31,155 @@ struct ConnectionGene {
     bool recurrent = false;  // true if this is a backward/self connection (reads prev tick)
 };
 
+// The structural half of a genome: which nodes exist and how they are wired.
+// Copies of a genome share one topology until one of them changes structure,
+// so a clone, or a crossover child that keeps its fitter parent's structure,
+// costs only its own biases, weights and enabled flags.
+struct GenomeTopology {
+    struct Node {
+        int id;
+        NodeType type;
+        ActivationFn activation;
+    };
+    struct Connection {
+        int innovation;
+        int source;
+        int target;
+        bool recurrent;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<Connection> connections;
+};
+
+template <typename Gene> class GeneView;
+
 struct NeatGenome {
-    std::vector<NodeGene> nodes;
-    std::vector<ConnectionGene> connections;
+    NeatGenome() = default;
+    NeatGenome(const std::vector<NodeGene>& nodes,
+               const std::vector<ConnectionGene>& connections);
+
+    // Read access. Genes are assembled from the topology and this genome's
+    // values, so they are returned by value; change them with the setters below.
+    GeneView<NodeGene> nodes() const;
+    GeneView<ConnectionGene> connections() const;
+    NodeGene node(size_t i) const;
+    ConnectionGene connection(size_t i) const;
+
+    // Per-individual values. These never touch the shared topology.
+    void set_bias(size_t node, float bias) { bias_[node] = bias; }
+    void set_weight(size_t connection, float weight) { weight_[connection] = weight; }
+    void set_enabled(size_t connection, bool enabled) { enabled_[connection] = enabled; }
+
+    // Structural edits. Each one first copies the topology if another genome
+    // still shares it. Like other edits outside the structural mutate_*
+    // functions, they leave `index` for the caller to keep current or reset.
+    void add_node(const NodeGene& node);
+    void add_connection(const ConnectionGene& connection);
+    void remove_node(size_t i);
+    void remove_connection(size_t i);
+    void set_innovation(size_t connection, int innovation);
+
+    // Empty the genome, keeping its buffers when nothing else shares them
+    void clear();
+
+    // True when both genomes use the same topology object
+    bool shares_topology(const NeatGenome& other) const {
+        return topology_ && topology_ == other.topology_;
+    }
+
+    // Optional structural index (see genome_index.h). When present, the
+    // structural mutate_* functions use it and keep it current; anything else
+    // that edits nodes or connections must reset it. Copies of a genome share
+    // the index until one of them changes structure (copy-on-write).
+    std::shared_ptr<GenomeIndex> index;
+
+    // Build the index from the current nodes and connections.
+    void build_index();
+
+    // The index for modification, unshared first if a copy still uses it.
+    // Null when the genome has no index.
+    GenomeIndex* own_index();
 
     // Create minimal topology: all inputs connected to all outputs, no hidden nodes.
     // Input nodes get ids [0, n_inputs), output nodes get ids [n_inputs, n_inputs+n_outputs).
     // next_innovation is incremented for each connection created.
     static NeatGenome minimal(int n_inputs, int n_outputs, int& next_innovation);
+
+private:
+    // The topology for modification, unshared first if a copy still uses it
+    GenomeTopology& own_topology();
+
+    std::shared_ptr<GenomeTopology> topology_;  // null while the genome is empty
+    std::vector<float> bias_;                   // per node
+    std::vector<float> weight_;                 // per connection
+    std::vector<uint8_t> enabled_;              // per connection
+};
+
+// Read-only range over a genome's nodes or connections, in genome order.
+// Iterators yield genes by value and stay valid while the genome is unchanged.
+template <typename Gene>
+class GeneView {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Gene;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Gene;
+
+        iterator() = default;
+        iterator(const NeatGenome* genome, size_t i) : genome_(genome), i_(i) {}
+
+        Gene operator*() const { return GeneView::at(*genome_, i_); }
+        iterator& operator++() { ++i_; return *this; }
+        iterator operator++(int) { iterator old = *this; ++i_; return old; }
+        bool operator==(const iterator& other) const { return i_ == other.i_; }
+        bool operator!=(const iterator& other) const { return i_ != other.i_; }
+
+    private:
+        const NeatGenome* genome_ = nullptr;
+        size_t i_ = 0;
+    };
+
+    GeneView(const NeatGenome& genome, size_t size) : genome_(&genome), size_(size) {}
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    Gene operator[](size_t i) const { return at(*genome_, i); }
+    Gene front() const { return at(*genome_, 0); }
+    Gene back() const { return at(*genome_, size_ - 1); }
+    iterator begin() const { return {genome_, 0}; }
+    iterator end() const { return {genome_, size_}; }
+
+private:
+    static Gene at(const NeatGenome& genome, size_t i) {
+        if constexpr (std::is_same_v<Gene, NodeGene>) {
+            return genome.node(i);
+        } else {
+            return genome.connection(i);
+        }
+    }
+
+    const NeatGenome* genome_;
+    size_t size_;
 };
+
+inline NodeGene NeatGenome::node(size_t i) const {
+    const auto& n = topology_->nodes[i];
+    return {n.id, n.type, n.activation, bias_[i]};
+}
+
+inline ConnectionGene NeatGenome::connection(size_t i) const {
+    const auto& c = topology_->connections[i];
+    return {c.innovation, c.source, c.target, weight_[i], enabled_[i] != 0, c.recurrent};
+}
+
+inline GeneView<NodeGene> NeatGenome::nodes() const {
+    return {*this, bias_.size()};
+}
+
+inline GeneView<ConnectionGene> NeatGenome::connections() const {
+    return {*this, weight_.size()};
+}
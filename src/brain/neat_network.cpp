@@ -6,8 +6,8 @@
 
 NeatNetwork::NeatNetwork(const NeatGenome& genome) {
     // Build node array and id-to-index mapping
-    for (int i = 0; i < static_cast<int>(genome.nodes.size()); ++i) {
-        const auto& ng = genome.nodes[i];
+    for (int i = 0; i < static_cast<int>(genome.nodes().size()); ++i) {
+        const auto& ng = genome.nodes()[i];
         RuntimeNode rn;
         rn.bias = ng.bias;
         rn.activation = ng.activation;
@@ -24,7 +24,7 @@ NeatNetwork::NeatNetwork(const NeatGenome& genome) {
     }
 
     // Build connection array (enabled only), preserving recurrent flag
-    for (const auto& cg : genome.connections) {
+    for (const auto& cg : genome.connections()) {
         if (!cg.enabled) continue;
 
         auto src_it = id_to_index_.find(cg.source);
@@ -8,6 +8,7 @@
 // NEAT network built from a NeatGenome.
 // Feed-forward connections are evaluated in topological order within a tick.
 // Recurrent connections read the previous tick's node values (one-tick delay).
+// Kept as the reference evaluator; boids run the equivalent CompiledNetwork.
 class NeatNetwork : public ProcessingNetwork {
 public:
     explicit NeatNetwork(const NeatGenome& genome);
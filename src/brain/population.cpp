@@ -1,20 +1,42 @@
 #include "brain/population.h"
 #include "brain/mutation.h"
 #include "brain/crossover.h"
+#include "simulation/rng_stream.h"
+#include "simulation/thread_pool.h"
+#include "simulation/trace.h"
 #include <algorithm>
 #include <numeric>
+#include <limits>
 #include <cassert>
 
+namespace {
+
+// Offspring number innovations in a private tracker starting here, far below
+// any real innovation number, and are renumbered once breeding is done.
+constexpr int PROVISIONAL_INNOVATION = std::numeric_limits<int>::min() / 2;
+
+// Seed of offspring k's private RNG stream, drawn from the generation's base
+// seed so a child's draws don't depend on which thread breeds it.
+uint32_t stream_seed(uint64_t base, uint64_t k) {
+    return static_cast<uint32_t>(stream_bits(base, k));
+}
+
+} // namespace
+
 Population::Population(const NeatGenome& seed, const PopulationParams& params,
                        std::mt19937& rng)
     : params_(params), rng_(rng), tracker_(1) {
     // Find the max innovation in the seed genome so the tracker starts after it
     int max_innov = 0;
-    for (const auto& c : seed.connections) {
+    for (const auto& c : seed.connections()) {
         max_innov = std::max(max_innov, c.innovation);
     }
     tracker_ = InnovationTracker(max_innov + 1);
 
+    if (params_.threads != 1) {
+        pool_ = std::make_shared<ThreadPool>(params_.threads);
+    }
+
     // Create initial population by cloning seed and mutating weights
     genomes_.reserve(params_.population_size);
     for (int i = 0; i < params_.population_size; ++i) {
@@ -30,7 +52,7 @@ Population::Population(const NeatGenome& seed, const PopulationParams& params,
 
     // Initial speciation
     assign_species(species_, genomes_, params_.compat, params_.compat_threshold,
-                   next_species_id_);
+                   next_species_id_, pool_.get());
 }
 
 void Population::enable_morphology(const MorphologyEvolutionConfig& config) {
@@ -63,6 +85,10 @@ void Population::enable_morphology(const MorphologyEvolutionConfig& config,
     }
 }
 
+void Population::set_innovation_class(int index, int count) {
+    tracker_ = InnovationTracker(tracker_.next_innovation(), count, index);
+}
+
 void Population::evaluate(
     std::function<float(int genome_index, const NeatGenome& genome)> fitness_fn) {
     for (int i = 0; i < static_cast<int>(genomes_.size()); ++i) {
@@ -84,13 +110,14 @@ void Population::evaluate(
     }
 }
 
-int Population::tournament_select(const Species& species, int k) {
-    assert(!species.members.empty());
-    std::uniform_int_distribution<int> dist(0, static_cast<int>(species.members.size()) - 1);
+int Population::tournament_select(const std::vector<int>& members, std::mt19937& rng,
+                                  int k) const {
+    assert(!members.empty());
+    std::uniform_int_distribution<int> dist(0, static_cast<int>(members.size()) - 1);
 
-    int best = species.members[dist(rng_)];
+    int best = members[dist(rng)];
     for (int i = 1; i < k; ++i) {
-        int candidate = species.members[dist(rng_)];
+        int candidate = members[dist(rng)];
         if (fitness_[candidate] > fitness_[best]) {
             best = candidate;
         }
@@ -98,79 +125,93 @@ int Population::tournament_select(const Species& species, int k) {
     return best;
 }
 
-NeatGenome Population::reproduce_from_species(const Species& species) {
+void Population::reproduce_from_species(const std::vector<int>& members,
+                                        std::mt19937& rng,
+                                        InnovationTracker& tracker,
+                                        NeatGenome& child,
+                                        MorphologyGenome* morphology) const {
     std::uniform_real_distribution<float> coin(0.0f, 1.0f);
 
-    NeatGenome child;
     int p1_idx = -1, p2_idx = -1;
+    TraceSpan crossover_span("crossover", "evolution");
 
-    if (species.members.size() == 1 || coin(rng_) >= params_.crossover_prob) {
+    if (members.size() == 1 || coin(rng) >= params_.crossover_prob) {
         // Asexual: clone and mutate
-        p1_idx = tournament_select(species);
+        p1_idx = tournament_select(members, rng);
         child = genomes_[p1_idx];
     } else {
         // Sexual: crossover two parents
-        p1_idx = tournament_select(species);
-        p2_idx = tournament_select(species);
+        p1_idx = tournament_select(members, rng);
+        p2_idx = tournament_select(members, rng);
         // Ensure different parents when possible
-        if (species.members.size() > 1) {
+        if (members.size() > 1) {
             int attempts = 0;
             while (p2_idx == p1_idx && attempts < 5) {
-                p2_idx = tournament_select(species);
+                p2_idx = tournament_select(members, rng);
                 ++attempts;
             }
         }
         // Fitter parent goes first
         if (fitness_[p1_idx] >= fitness_[p2_idx]) {
-            child = crossover(genomes_[p1_idx], genomes_[p2_idx], rng_);
+            crossover(genomes_[p1_idx], genomes_[p2_idx], rng, child);
         } else {
-            child = crossover(genomes_[p2_idx], genomes_[p1_idx], rng_);
+            crossover(genomes_[p2_idx], genomes_[p1_idx], rng, child);
             std::swap(p1_idx, p2_idx);  // p1 is now the fitter parent
         }
     }
 
-    mutate(child);
+    crossover_span.end();
+    {
+        TraceSpan span("mutation", "evolution");
+        mutate(child, rng, tracker);
+    }
 
     // Morphology: use same parent selection for body genome
-    if (morphology_config_.has_value()) {
-        MorphologyGenome child_morpho;
+    if (morphology) {
         if (p2_idx >= 0) {
             // Sexual: crossover morphology with same parent order
-            child_morpho = crossover_morphology(
-                morphologies_[p1_idx], morphologies_[p2_idx], rng_);
+            *morphology = crossover_morphology(
+                morphologies_[p1_idx], morphologies_[p2_idx], rng);
         } else {
             // Asexual: clone
-            child_morpho = morphologies_[p1_idx];
+            *morphology = morphologies_[p1_idx];
         }
-        mutate_morphology(child_morpho, *morphology_config_, rng_);
-        pending_morphology_ = std::move(child_morpho);
+        mutate_morphology(*morphology, *morphology_config_, rng);
     }
-
-    return child;
 }
 
-void Population::mutate(NeatGenome& genome) {
+void Population::mutate(NeatGenome& genome, std::mt19937& rng,
+                        InnovationTracker& tracker) const {
     std::uniform_real_distribution<float> coin(0.0f, 1.0f);
 
-    if (coin(rng_) < params_.weight_mutate_prob) {
-        mutate_weights(genome, rng_, params_.weight_perturb_prob,
+    if (coin(rng) < params_.weight_mutate_prob) {
+        mutate_weights(genome, rng, params_.weight_perturb_prob,
                        params_.weight_sigma, params_.weight_replace_prob);
     }
-    if (coin(rng_) < params_.add_connection_prob) {
-        mutate_add_connection(genome, rng_, tracker_, 20, params_.allow_recurrent);
+    // Structural mutations share one incrementally maintained index, which
+    // offspring cloned from this genome inherit. Built only when needed.
+    auto indexed = [&]() -> NeatGenome& {
+        if (!genome.index) genome.build_index();
+        return genome;
+    };
+    if (coin(rng) < params_.add_connection_prob) {
+        mutate_add_connection(indexed(), rng, tracker, 20, params_.allow_recurrent);
     }
-    if (coin(rng_) < params_.add_node_prob) {
-        mutate_add_node(genome, rng_, tracker_);
+    if (coin(rng) < params_.add_node_prob) {
+        mutate_add_node(indexed(), rng, tracker);
     }
-    if (coin(rng_) < params_.toggle_connection_prob) {
-        mutate_toggle_connection(genome, rng_);
+    if (coin(rng) < params_.toggle_connection_prob) {
+        mutate_toggle_connection(genome, rng);
     }
-    if (coin(rng_) < params_.delete_connection_prob) {
-        mutate_delete_connection(genome, rng_);
+    if (coin(rng) < params_.delete_connection_prob) {
+        mutate_delete_connection(indexed(), rng);
     }
 }
 
 void Population::advance_generation() {
+    TraceSpan span("advance_generation", "evolution", "gen", generation_);
+    TraceSpan selection_span("selection", "evolution");
+
     // Remove stagnant species (but keep at least one)
     if (species_.size() > 1) {
         species_.erase(
@@ -250,50 +291,120 @@ void Population::advance_generation() {
                   [&](int a, int b) { return fitness_[a] > fitness_[b]; });
     }
 
-    // Produce next generation
-    std::vector<NeatGenome> new_genomes;
-    new_genomes.reserve(params_.population_size);
+    // Lay out the next generation: each species' elites, then slots for its
+    // offspring, which breed from the top survival_rate of the species.
+    // Slots are the genome buffers of the generation before last, so children
+    // are written into storage that already has capacity.
+    int total = std::accumulate(offspring_counts.begin(), offspring_counts.end(), 0);
+    std::vector<NeatGenome> new_genomes = std::move(spare_genomes_);
+    new_genomes.resize(total);
     std::vector<MorphologyGenome> new_morphologies;
     if (has_morphology()) {
-        new_morphologies.reserve(params_.population_size);
+        new_morphologies = std::move(spare_morphologies_);
+        new_morphologies.resize(total);
     }
 
+    struct Elite {
+        int slot;     // index into new_genomes
+        int source;   // index into genomes_
+    };
+    struct Offspring {
+        int slot;
+        int species;  // breeding pool
+    };
+    std::vector<Elite> elites_kept;
+    std::vector<Offspring> offspring;
+    std::vector<std::vector<int>> breeding_pools(species_.size());
+
+    int next_slot = 0;
     for (size_t si = 0; si < species_.size(); ++si) {
-        auto& s = species_[si];
+        const auto& s = species_[si];
         int count = offspring_counts[si];
 
-        // Elitism: copy top genomes unchanged
+        // Elitism: top genomes survive unchanged
         int elites = std::min(params_.elitism, static_cast<int>(s.members.size()));
         elites = std::min(elites, count);
         for (int e = 0; e < elites; ++e) {
-            new_genomes.push_back(genomes_[s.members[e]]);
-            if (has_morphology()) {
-                new_morphologies.push_back(morphologies_[s.members[e]]);
-            }
+            elites_kept.push_back({next_slot++, s.members[e]});
         }
 
-        // Trim species to survival_rate for breeding pool
         int survivors = std::max(1, static_cast<int>(
             std::ceil(s.members.size() * params_.survival_rate)));
-        std::vector<int> original_members = s.members;
-        s.members.resize(std::min(survivors, static_cast<int>(s.members.size())));
+        survivors = std::min(survivors, static_cast<int>(s.members.size()));
+        breeding_pools[si].assign(s.members.begin(), s.members.begin() + survivors);
 
-        // Fill remaining slots with offspring
         for (int i = elites; i < count; ++i) {
-            new_genomes.push_back(reproduce_from_species(s));
-            if (has_morphology()) {
-                new_morphologies.push_back(std::move(pending_morphology_));
+            offspring.push_back({next_slot++, static_cast<int>(si)});
+        }
+    }
+
+    // Breed. Every child has its own RNG stream and numbers its structural
+    // innovations provisionally, so children are independent of each other
+    // and of the thread count.
+    selection_span.end();
+    TraceSpan reproduction_span("reproduction", "evolution");
+    uint64_t stream_base = static_cast<uint64_t>(rng_()) << 32;
+    stream_base |= rng_();
+    std::vector<std::vector<std::pair<int,int>>> created(offspring.size());
+    const int classes = tracker_.classes();
+    const int provisional_first =
+        InnovationTracker(PROVISIONAL_INNOVATION, classes, tracker_.class_index()).next_innovation();
+    auto breed = [&](int begin, int end, int /*worker*/) {
+        for (int k = begin; k < end; ++k) {
+            const auto& o = offspring[k];
+            std::mt19937 rng(stream_seed(stream_base, k));
+            InnovationTracker provisional(provisional_first, classes, tracker_.class_index());
+            reproduce_from_species(breeding_pools[o.species], rng, provisional,
+                                   new_genomes[o.slot],
+                                   has_morphology() ? &new_morphologies[o.slot] : nullptr);
+            created[k] = provisional.created();
+        }
+    };
+    int n_offspring = static_cast<int>(offspring.size());
+    if (pool_) {
+        pool_->parallel_for(n_offspring, 4, breed);
+    } else {
+        breed(0, n_offspring, 0);
+    }
+
+    // Number the new innovations in offspring order, as a serial pass would:
+    // a pair first seen by an earlier child keeps that child's number.
+    std::vector<int> numbers;
+    for (int k = 0; k < n_offspring; ++k) {
+        if (created[k].empty()) continue;
+        numbers.clear();
+        for (const auto& [source, target] : created[k]) {
+            numbers.push_back(tracker_.get_or_create(source, target));
+        }
+        int provisional_end = provisional_first + static_cast<int>(numbers.size()) * classes;
+        NeatGenome& child = new_genomes[offspring[k].slot];
+        for (size_t i = 0; i < child.connections().size(); ++i) {
+            int innovation = child.connection(i).innovation;
+            if (innovation >= provisional_first && innovation < provisional_end) {
+                child.set_innovation(i, numbers[(innovation - provisional_first) / classes]);
             }
         }
+    }
 
-        // Restore full member list (needed for species representative selection)
-        s.members = original_members;
+    // Elites move across without a copy; their slot's spare buffers take
+    // their place in the outgoing generation
+    for (const auto& e : elites_kept) {
+        std::swap(new_genomes[e.slot], genomes_[e.source]);
+        if (has_morphology()) {
+            std::swap(new_morphologies[e.slot], morphologies_[e.source]);
+        }
     }
 
-    // Replace population
+    // Replace population. The outgoing generation becomes the spare storage
+    // for the next one; it drops its index and topology references so clones
+    // that still share them can modify theirs without copying, and
+    // topologies no survivor uses are freed.
+    for (auto& g : genomes_) g.clear();
+    spare_genomes_ = std::move(genomes_);
     genomes_ = std::move(new_genomes);
     fitness_.assign(genomes_.size(), 0.0f);
     if (has_morphology()) {
+        spare_morphologies_ = std::move(morphologies_);
         morphologies_ = std::move(new_morphologies);
     }
 
@@ -301,9 +412,47 @@ void Population::advance_generation() {
     tracker_.new_generation();
     ++generation_;
 
+    reproduction_span.end();
+
     // Re-speciate
+    TraceSpan speciation_span("speciation", "evolution");
+    assign_species(species_, genomes_, params_.compat, params_.compat_threshold,
+                   next_species_id_, pool_.get());
+}
+
+std::vector<int> Population::top_indices(int count) const {
+    std::vector<int> order(genomes_.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](int a, int b) { return fitness_[a] > fitness_[b]; });
+    order.resize(std::min<size_t>(order.size(), std::max(0, count)));
+    return order;
+}
+
+void Population::immigrate(const std::vector<NeatGenome>& genomes,
+                           const std::vector<float>& fitness,
+                           const std::vector<MorphologyGenome>* morphologies) {
+    int n = std::min(static_cast<int>(genomes.size()), size() - 1);
+    if (n <= 0) return;
+
+    // Weakest first (ties by index)
+    std::vector<int> order(genomes_.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](int a, int b) { return fitness_[a] < fitness_[b]; });
+
+    for (int k = 0; k < n; ++k) {
+        int slot = order[k];
+        genomes_[slot] = genomes[k];
+        genomes_[slot].index.reset();  // don't share structure across populations
+        fitness_[slot] = fitness[k];
+        if (has_morphology() && morphologies && k < static_cast<int>(morphologies->size())) {
+            morphologies_[slot] = (*morphologies)[k];
+        }
+    }
+
     assign_species(species_, genomes_, params_.compat, params_.compat_threshold,
-                   next_species_id_);
+                   next_species_id_, pool_.get());
 }
 
 int Population::best_index() const {
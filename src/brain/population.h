@@ -6,9 +6,13 @@
 #include "simulation/morphology_genome.h"
 #include <vector>
 #include <functional>
+#include <memory>
 #include <random>
 #include <optional>
 
+class BinaryWriter;
+class BinaryReader;
+
 struct PopulationParams {
     int population_size = 150;
 
@@ -41,6 +45,10 @@ struct PopulationParams {
 
     // Recurrent connections
     bool allow_recurrent = false;  // if true, mutations can create backward/self connections
+
+    // Worker threads for speciation and reproduction (0 = all cores).
+    // Results do not depend on it.
+    int threads = 1;
 };
 
 class Population {
@@ -63,6 +71,18 @@ public:
     // Advance to the next generation: speciate, select, reproduce.
     void advance_generation();
 
+    // Indices of the `count` fittest genomes, best first (ties by index).
+    std::vector<int> top_indices(int count) const;
+
+    // Replace the weakest genomes with migrants from another population
+    // (island model) and re-speciate. Call between evaluate() and
+    // advance_generation(); migrants keep the fitness they earned at home.
+    // At most size() - 1 genomes are replaced. Morphologies are copied when
+    // both sides evolve them.
+    void immigrate(const std::vector<NeatGenome>& genomes,
+                   const std::vector<float>& fitness,
+                   const std::vector<MorphologyGenome>* morphologies = nullptr);
+
     // Accessors
     const NeatGenome& genome(int index) const { return genomes_[index]; }
     const std::vector<NeatGenome>& genomes() const { return genomes_; }
@@ -78,6 +98,11 @@ public:
 
     InnovationTracker& innovation_tracker() { return tracker_; }
 
+    // Number new innovations and hidden nodes in class `index` of `count`
+    // (see InnovationTracker), as island `index` of `count` islands that
+    // trade genomes. Call before the first advance_generation().
+    void set_innovation_class(int index, int count);
+
     // Morphology accessors
     bool has_morphology() const { return morphology_config_.has_value(); }
     const MorphologyGenome& morphology(int index) const { return morphologies_[index]; }
@@ -85,11 +110,19 @@ public:
     const MorphologyGenome& best_morphology() const { return morphologies_[best_index()]; }
 
 private:
+    // Checkpointing (io/checkpoint.h) saves and restores the full state
+    friend void write_population(BinaryWriter& out, const Population& population);
+    friend void read_population(BinaryReader& in, Population& population);
+
     PopulationParams params_;
     std::mt19937& rng_;
     InnovationTracker tracker_;
+    std::shared_ptr<ThreadPool> pool_;  // null when single-threaded
 
+    // Clones and same-structure crossover children share their parent's
+    // topology; each genome owns only its biases, weights and enabled flags.
     std::vector<NeatGenome> genomes_;
+    std::vector<NeatGenome> spare_genomes_;  // previous generation's buffers, reused for children
     std::vector<float> fitness_;
     std::vector<Species> species_;
     int generation_ = 0;
@@ -98,15 +131,20 @@ private:
     // Morphology evolution (optional)
     std::optional<MorphologyEvolutionConfig> morphology_config_;
     std::vector<MorphologyGenome> morphologies_;
-    MorphologyGenome pending_morphology_;  // temp storage for reproduce_from_species output
+    std::vector<MorphologyGenome> spare_morphologies_;
 
-    // Select a parent from a species by tournament selection
-    int tournament_select(const Species& species, int k = 2);
+    // Select a parent from a breeding pool by tournament selection
+    int tournament_select(const std::vector<int>& members, std::mt19937& rng,
+                          int k = 2) const;
 
-    // Produce one offspring from a species. If morphology is enabled,
-    // also produces a child morphology using the same parent indices.
-    NeatGenome reproduce_from_species(const Species& species);
+    // Produce one offspring from a species' breeding pool into `child`,
+    // drawing only from `rng` and numbering innovations through `tracker`.
+    // If `morphology` is given, also produces a child morphology from the
+    // same parents.
+    void reproduce_from_species(const std::vector<int>& members,
+                                std::mt19937& rng, InnovationTracker& tracker,
+                                NeatGenome& child, MorphologyGenome* morphology) const;
 
     // Apply mutation to a genome
-    void mutate(NeatGenome& genome);
+    void mutate(NeatGenome& genome, std::mt19937& rng, InnovationTracker& tracker) const;
 };
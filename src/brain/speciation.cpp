@@ -1,61 +1,78 @@
 #include "brain/speciation.h"
+#include "simulation/thread_pool.h"
 #include <algorithm>
 #include <cmath>
-#include <unordered_map>
+#include <numeric>
+
+GeneSignature::GeneSignature(const NeatGenome& genome)
+    : gene_count(static_cast<int>(genome.connections().size()))
+{
+    const auto& conns = genome.connections();
+    std::vector<int> order(conns.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int x, int y) {
+        return conns[x].innovation < conns[y].innovation;
+    });
+
+    innovations.reserve(conns.size());
+    weights.reserve(conns.size());
+    for (int k : order) {
+        // A repeated innovation keeps its last gene, as an id-keyed map would
+        if (!innovations.empty() && innovations.back() == conns[k].innovation) {
+            weights.back() = conns[k].weight;
+            continue;
+        }
+        innovations.push_back(conns[k].innovation);
+        weights.push_back(conns[k].weight);
+    }
+}
 
 float compatibility_distance(const NeatGenome& a, const NeatGenome& b,
                              const CompatibilityParams& params) {
-    if (a.connections.empty() && b.connections.empty()) return 0.0f;
+    if (a.connections().empty() && b.connections().empty()) return 0.0f;
+    return compatibility_distance(GeneSignature(a), GeneSignature(b), params);
+}
 
-    // Index connections by innovation number
-    std::unordered_map<int, const ConnectionGene*> a_conns, b_conns;
-    int a_max_innov = 0, b_max_innov = 0;
+float compatibility_distance(const GeneSignature& a, const GeneSignature& b,
+                             const CompatibilityParams& params) {
+    if (a.innovations.empty() && b.innovations.empty()) return 0.0f;
 
-    for (const auto& c : a.connections) {
-        a_conns[c.innovation] = &c;
-        a_max_innov = std::max(a_max_innov, c.innovation);
-    }
-    for (const auto& c : b.connections) {
-        b_conns[c.innovation] = &c;
-        b_max_innov = std::max(b_max_innov, c.innovation);
-    }
+    int a_max_innov = a.innovations.empty() ? 0 : a.innovations.back();
+    int b_max_innov = b.innovations.empty() ? 0 : b.innovations.back();
+    int min_max_innov = std::min(a_max_innov, b_max_innov);
 
     int excess = 0;
     int disjoint = 0;
     float weight_diff_sum = 0.0f;
     int matching = 0;
 
-    // Scan all innovation numbers present in either genome
-    int max_innov = std::max(a_max_innov, b_max_innov);
-    int min_max_innov = std::min(a_max_innov, b_max_innov);
-
-    for (const auto& [innov, ac] : a_conns) {
-        auto it = b_conns.find(innov);
-        if (it != b_conns.end()) {
+    // Merge-join the two ascending innovation lists
+    const int na = static_cast<int>(a.innovations.size());
+    const int nb = static_cast<int>(b.innovations.size());
+    int ia = 0, ib = 0;
+    while (ia < na || ib < nb) {
+        int innov;
+        if (ib == nb || (ia < na && a.innovations[ia] < b.innovations[ib])) {
+            innov = a.innovations[ia++];
+        } else if (ia == na || b.innovations[ib] < a.innovations[ia]) {
+            innov = b.innovations[ib++];
+        } else {
             // Matching gene
-            weight_diff_sum += std::abs(ac->weight - it->second->weight);
+            weight_diff_sum += std::abs(a.weights[ia] - b.weights[ib]);
             ++matching;
-        } else if (innov > min_max_innov) {
+            ++ia;
+            ++ib;
+            continue;
+        }
+        if (innov > min_max_innov) {
             ++excess;
         } else {
             ++disjoint;
         }
     }
 
-    // Count b's genes not in a
-    for (const auto& [innov, bc] : b_conns) {
-        if (a_conns.find(innov) == a_conns.end()) {
-            if (innov > min_max_innov) {
-                ++excess;
-            } else {
-                ++disjoint;
-            }
-        }
-    }
-
     float mean_weight_diff = (matching > 0) ? (weight_diff_sum / matching) : 0.0f;
-    int N = std::max(static_cast<int>(std::max(a.connections.size(), b.connections.size())),
-                     params.normalise_threshold);
+    int N = std::max(std::max(a.gene_count, b.gene_count), params.normalise_threshold);
 
     return (params.c1 * excess / N) + (params.c2 * disjoint / N) + params.c3 * mean_weight_diff;
 }
@@ -64,19 +81,50 @@ void assign_species(std::vector<Species>& species,
                     const std::vector<NeatGenome>& genomes,
                     const CompatibilityParams& params,
                     float threshold,
-                    int& next_species_id) {
+                    int& next_species_id,
+                    ThreadPool* pool) {
+    const int n = static_cast<int>(genomes.size());
+    const int existing = static_cast<int>(species.size());
+
     // Clear member lists
     for (auto& s : species) {
         s.members.clear();
     }
 
-    // Assign each genome to the first compatible species
-    for (int i = 0; i < static_cast<int>(genomes.size()); ++i) {
+    // Each genome's first compatible species among those that existed before
+    // this pass. Independent per genome, so this part runs across the pool.
+    std::vector<GeneSignature> signatures(n);
+    std::vector<int> first_match(n, -1);
+    auto scan = [&](int begin, int end, int) {
+        for (int i = begin; i < end; ++i) {
+            signatures[i] = GeneSignature(genomes[i]);
+            for (int si = 0; si < existing; ++si) {
+                if (compatibility_distance(signatures[i], species[si].representative, params) < threshold) {
+                    first_match[i] = si;
+                    break;
+                }
+            }
+        }
+    };
+    if (pool) {
+        pool->parallel_for(n, 8, scan);
+    } else {
+        scan(0, n, 0);
+    }
+
+    // Assign in genome order. Existing species come first in the list, so a
+    // genome matched above lands exactly where the serial scan would put it;
+    // only unmatched genomes need checking against species founded this pass.
+    for (int i = 0; i < n; ++i) {
+        if (first_match[i] >= 0) {
+            species[first_match[i]].members.push_back(i);
+            continue;
+        }
+
         bool placed = false;
-        for (auto& s : species) {
-            float dist = compatibility_distance(genomes[i], s.representative, params);
-            if (dist < threshold) {
-                s.members.push_back(i);
+        for (int si = existing; si < static_cast<int>(species.size()); ++si) {
+            if (compatibility_distance(signatures[i], species[si].representative, params) < threshold) {
+                species[si].members.push_back(i);
                 placed = true;
                 break;
             }
@@ -86,7 +134,7 @@ void assign_species(std::vector<Species>& species,
             // Create new species with this genome as representative
             Species new_species;
             new_species.id = next_species_id++;
-            new_species.representative = genomes[i];
+            new_species.representative = signatures[i];
             new_species.members.push_back(i);
             species.push_back(std::move(new_species));
         }
@@ -102,7 +150,7 @@ void assign_species(std::vector<Species>& species,
     // (for simplicity, pick the first member)
     for (auto& s : species) {
         if (!s.members.empty()) {
-            s.representative = genomes[s.members[0]];
+            s.representative = std::move(signatures[s.members[0]]);
         }
     }
 }
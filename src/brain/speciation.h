@@ -3,6 +3,8 @@
 #include "brain/neat_genome.h"
 #include <vector>
 
+class ThreadPool;
+
 // Parameters for compatibility distance calculation
 struct CompatibilityParams {
     float c1 = 1.0f;  // coefficient for excess genes
@@ -11,17 +13,31 @@ struct CompatibilityParams {
     int normalise_threshold = 20;  // N = max(genome_size, this) to avoid penalising small genomes
 };
 
+// A genome's connection genes sorted by innovation number, so distance is a
+// linear merge-join. Built once per genome per speciation pass; also stored
+// as a species' representative instead of a full genome copy.
+struct GeneSignature {
+    std::vector<int> innovations;  // ascending, unique
+    std::vector<float> weights;    // parallel to innovations
+    int gene_count = 0;            // connections in the genome (for N)
+
+    GeneSignature() = default;
+    GeneSignature(const NeatGenome& genome);  // implicit: a genome can stand in
+};
+
 // Compute NEAT compatibility distance between two genomes.
 // δ = (c1 * E / N) + (c2 * D / N) + c3 * W̄
 // E = excess genes, D = disjoint genes, W̄ = mean weight diff of matching genes,
 // N = max(size of larger genome, normalise_threshold).
 float compatibility_distance(const NeatGenome& a, const NeatGenome& b,
                              const CompatibilityParams& params);
+float compatibility_distance(const GeneSignature& a, const GeneSignature& b,
+                             const CompatibilityParams& params);
 
 // A species: a group of genomes with a representative
 struct Species {
     int id;
-    NeatGenome representative;  // from previous generation, used for membership testing
+    GeneSignature representative;  // from previous generation, used for membership testing
     std::vector<int> members;   // indices into the population's genome list
     float best_fitness = 0.0f;
     int stagnation_count = 0;   // generations without improvement
@@ -30,8 +46,11 @@ struct Species {
 // Assign genomes to species based on compatibility distance.
 // Updates species list in-place: clears member lists, assigns each genome,
 // creates new species for unmatched genomes, removes empty species.
+// With a pool, signatures and the scan against existing species run in
+// parallel; the result is identical to the serial pass.
 void assign_species(std::vector<Species>& species,
                     const std::vector<NeatGenome>& genomes,
                     const CompatibilityParams& params,
                     float threshold,
-                    int& next_species_id);
+                    int& next_species_id,
+                    ThreadPool* pool = nullptr);
@@ -0,0 +1,60 @@
+#include "io/boid_spec.h"
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+// Convert boid specs between JSON and the compact binary format (.wbs).
+
+static void print_usage(const char* prog) {
+    std::cerr << "Usage: " << prog << " IN OUT\n"
+              << "       " << prog << " DIR\n"
+              << "\n"
+              << "  IN OUT   Convert one spec. OUT ending in .json is written as JSON,\n"
+              << "           anything else as binary. IN may be either format.\n"
+              << "  DIR      Write a .wbs next to every .json boid spec under DIR\n";
+}
+
+static bool convert(const std::string& in, const std::string& out, bool quiet = false) {
+    try {
+        BoidSpec spec = load_boid_spec(in);
+        if (std::filesystem::path(out).extension() == ".json") {
+            save_boid_spec(spec, out);
+        } else {
+            save_boid_spec_binary(spec, out);
+        }
+        return true;
+    } catch (const std::exception& e) {
+        if (!quiet) std::cerr << in << ": " << e.what() << "\n";
+        return false;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc == 2 && std::strcmp(argv[1], "--help") != 0 &&
+        std::filesystem::is_directory(argv[1])) {
+        // Packages also hold sim configs and the like; skip anything that
+        // doesn't load as a boid spec
+        int converted = 0, skipped = 0;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(argv[1])) {
+            if (!entry.is_regular_file() || entry.path().extension() != ".json") continue;
+            std::filesystem::path out = entry.path();
+            out.replace_extension(".wbs");
+            if (convert(entry.path().string(), out.string(), true)) {
+                ++converted;
+            } else {
+                ++skipped;
+            }
+        }
+        std::cerr << "Converted " << converted << " specs";
+        if (skipped > 0) std::cerr << " (skipped " << skipped << " other .json files)";
+        std::cerr << "\n";
+        return 0;
+    }
+
+    if (argc != 3) {
+        print_usage(argv[0]);
+        return argc == 2 && std::strcmp(argv[1], "--help") == 0 ? 0 : 1;
+    }
+    return convert(argv[1], argv[2]) ? 0 : 1;
+}
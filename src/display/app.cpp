@@ -274,22 +274,24 @@ void App::handle_events() {
 void App::apply_random_wander() {
     std::uniform_real_distribution<float> steer_dist(-0.4f, 0.4f);
 
-    for (auto& boid : world_.get_boids_mut()) {
+    const auto& boids = world_.get_boids();
+    for (int i = 0; i < static_cast<int>(boids.size()); ++i) {
+        const auto& boid = boids[i];
         if (!boid.alive) continue;  // dead boid
         if (boid.brain) continue;  // brain-driven boid
         if (boid.thrusters.size() < 3) continue;
 
         // Constant rear thrust
-        boid.thrusters[0].power = 0.35f;
+        world_.set_thruster_power(i, 0, 0.35f);
 
         // Random steering nudge
         float steer = steer_dist(rng_);
-        boid.thrusters[1].power = std::max(0.0f, steer);   // left-rear
-        boid.thrusters[2].power = std::max(0.0f, -steer);  // right-rear
+        world_.set_thruster_power(i, 1, std::max(0.0f, steer));   // left-rear
+        world_.set_thruster_power(i, 2, std::max(0.0f, -steer));  // right-rear
 
         // Front brake off
         if (boid.thrusters.size() > 3) {
-            boid.thrusters[3].power = 0.0f;
+            world_.set_thruster_power(i, 3, 0.0f);
         }
     }
 }
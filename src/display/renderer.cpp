@@ -159,19 +159,15 @@ void Renderer::draw_neighbour_lines(const World& world) {
 
     SDL_SetRenderDrawColor(renderer_, 60, 120, 200, 120);
 
-    std::vector<int> candidates;
     for (int i = 0; i < static_cast<int>(boids.size()); ++i) {
         Vec2 pos_a = boids[i].body.position;
 
-        candidates.clear();
-        grid.query(pos_a, NEIGHBOUR_RADIUS, candidates);
-
-        for (int j : candidates) {
-            if (j <= i) continue; // draw each pair once
+        grid.for_each(pos_a, NEIGHBOUR_RADIUS, [&](int j) {
+            if (j <= i) return; // draw each pair once
 
             Vec2 delta = toroidal_delta(pos_a, boids[j].body.position,
                                         config.width, config.height);
-            if (delta.length_squared() > radius_sq) continue;
+            if (delta.length_squared() > radius_sq) return;
 
             // Draw line from boid i to (boid i + delta) — correct for toroidal
             Vec2 end = pos_a + delta;
@@ -181,7 +177,7 @@ void Renderer::draw_neighbour_lines(const World& world) {
                 world_to_screen_y(pos_a.y, config),
                 world_to_screen_x(end.x, config),
                 world_to_screen_y(end.y, config));
-        }
+        });
     }
 }
 
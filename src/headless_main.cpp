@@ -1,29 +1,39 @@
 #include "brain/neat_genome.h"
-#include "brain/neat_network.h"
+#include "brain/compiled_network.h"
+#include "brain/fitness_race.h"
+#include "brain/island_migration.h"
 #include "brain/population.h"
 #include "io/boid_spec.h"
+#include "io/checkpoint.h"
 #include "io/sim_config.h"
+#include "io/telemetry.h"
+#include "simulation/episode_batch.h"
 #include "simulation/morphology_genome.h"
+#include "simulation/rank_stability.h"
+#include "simulation/thread_pool.h"
+#include "simulation/trace.h"
 #include "simulation/world.h"
+#include <algorithm>
+#include <cmath>
 #include <cstdlib>
 #include <cstring>
 #include <filesystem>
+#include <iomanip>
 #include <iostream>
+#include <memory>
 #include <random>
-
-struct GenerationResult {
-    std::vector<float> prey_fitness;
-    std::vector<float> predator_fitness;
-    int prey_survivors = 0;
-    int predator_survivors = 0;
-};
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 // Create a boid from spec, optionally applying individual morphology.
 static Boid create_boid_with_morphology(
     const BoidSpec& spec,
     const NeatGenome& genome,
     const MorphologyGenome* morpho,
-    const MorphologyEvolutionConfig* morpho_config)
+    const MorphologyEvolutionConfig* morpho_config,
+    ActivationPrecision activation)
 {
     if (morpho && morpho_config && spec.compound_eyes.has_value()) {
         // Apply this individual's morphology to get custom eye positions
@@ -31,16 +41,18 @@ static Boid create_boid_with_morphology(
         individual_spec.compound_eyes = apply_morphology(
             *spec.compound_eyes, *morpho, *morpho_config);
         Boid boid = create_boid_from_spec(individual_spec);
-        boid.brain = std::make_unique<NeatNetwork>(genome);
+        boid.brain = std::make_unique<CompiledNetwork>(genome, activation);
         return boid;
     }
     Boid boid = create_boid_from_spec(spec);
-    boid.brain = std::make_unique<NeatNetwork>(genome);
+    boid.brain = std::make_unique<CompiledNetwork>(genome, activation);
     return boid;
 }
 
 // Run one generation: create a World, spawn prey and predator boids with
-// genomes as brains, run for N ticks, return fitness for each genome.
+// genomes as brains, run for up to N ticks, return fitness for each genome.
+// Stops early once every prey is dead, or (with early_stop) once fitness
+// rankings have settled.
 // Prey are spawned at indices [0, prey_count), predators at [prey_count, total).
 static GenerationResult run_generation(
     const std::vector<NeatGenome>& prey_genomes,
@@ -49,14 +61,17 @@ static GenerationResult run_generation(
     const BoidSpec& predator_spec,
     const WorldConfig& config,
     int ticks,
+    const EpisodeLengthConfig& length,
     FitnessMode fitness_mode,
     std::mt19937& rng,
+    ThreadPool* world_pool,
     const std::vector<MorphologyGenome>* prey_morphologies = nullptr,
     const MorphologyEvolutionConfig* prey_morpho_config = nullptr,
     const std::vector<MorphologyGenome>* pred_morphologies = nullptr,
     const MorphologyEvolutionConfig* pred_morpho_config = nullptr)
 {
-    World world(config);
+    TraceSpan span("episode", "evolution");
+    World world(config, world_pool);
 
     std::uniform_real_distribution<float> x_dist(0.0f, config.width);
     std::uniform_real_distribution<float> y_dist(0.0f, config.height);
@@ -69,7 +84,8 @@ static GenerationResult run_generation(
     for (int i = 0; i < static_cast<int>(prey_genomes.size()); ++i) {
         const MorphologyGenome* morpho = (prey_morphologies && i < static_cast<int>(prey_morphologies->size()))
             ? &(*prey_morphologies)[i] : nullptr;
-        Boid boid = create_boid_with_morphology(prey_spec, prey_genomes[i], morpho, prey_morpho_config);
+        Boid boid = create_boid_with_morphology(prey_spec, prey_genomes[i], morpho, prey_morpho_config,
+                                                config.brain_activation);
         boid.body.position = Vec2{x_dist(rng), y_dist(rng)};
         boid.body.angle = angle_dist(rng);
         world.add_boid(std::move(boid));
@@ -79,13 +95,33 @@ static GenerationResult run_generation(
     for (int i = 0; i < static_cast<int>(predator_genomes.size()); ++i) {
         const MorphologyGenome* morpho = (pred_morphologies && i < static_cast<int>(pred_morphologies->size()))
             ? &(*pred_morphologies)[i] : nullptr;
-        Boid boid = create_boid_with_morphology(predator_spec, predator_genomes[i], morpho, pred_morpho_config);
+        Boid boid = create_boid_with_morphology(predator_spec, predator_genomes[i], morpho, pred_morpho_config,
+                                                config.brain_activation);
         boid.body.position = Vec2{x_dist(rng), y_dist(rng)};
         boid.body.angle = angle_dist(rng);
         world.add_boid(std::move(boid));
     }
 
     int prey_count = static_cast<int>(prey_genomes.size());
+    int predator_count = static_cast<int>(predator_genomes.size());
+    uint8_t prey_type = prey_count > 0 ? world.boid_store().type_id[0] : TYPE_PREY;
+
+    auto boid_fitness = [fitness_mode](const Boid& b) -> float {
+        if (fitness_mode == FitnessMode::Net)
+            return b.total_energy_gained - b.total_energy_spent;
+        return b.total_energy_gained;
+    };
+
+    // Fitness of boids [begin, begin + count) as things stand
+    std::vector<float> snapshot;
+    auto take_snapshot = [&](int begin, int count) -> const std::vector<float>& {
+        snapshot.resize(count);
+        for (int i = 0; i < count; ++i) snapshot[i] = boid_fitness(world.get_boids()[begin + i]);
+        return snapshot;
+    };
+    RankStability prey_ranks(length.rank_correlation, length.patience);
+    RankStability predator_ranks(length.rank_correlation, length.patience);
+    int check_interval = std::max(1, length.check_interval);
 
     // Run simulation
     float dt = 1.0f / 120.0f;
@@ -93,43 +129,400 @@ static GenerationResult run_generation(
         world.step(dt, &rng);
 
         // Early exit if all prey are dead (predators can't do anything without prey)
-        const auto& boids = world.get_boids();
-        bool any_prey_alive = false;
-        for (int i = 0; i < prey_count; ++i) {
-            if (boids[i].alive) { any_prey_alive = true; break; }
+        if (world.alive_count(prey_type) == 0) break;
+
+        int done = t + 1;
+        if (length.early_stop && done >= length.min_ticks && done % check_interval == 0) {
+            bool settled = prey_ranks.observe(take_snapshot(0, prey_count));
+            if (predator_count > 0) {
+                settled = predator_ranks.observe(take_snapshot(prey_count, predator_count)) && settled;
+            }
+            if (settled) break;
         }
-        if (!any_prey_alive) break;
     }
 
     // Collect fitness and count survivors
     GenerationResult result;
     result.prey_fitness.resize(prey_genomes.size());
     result.predator_fitness.resize(predator_genomes.size());
-
-    auto boid_fitness = [fitness_mode](const Boid& b) -> float {
-        if (fitness_mode == FitnessMode::Net)
-            return b.total_energy_gained - b.total_energy_spent;
-        return b.total_energy_gained;
-    };
+    result.ticks_run = static_cast<float>(world.tick_count());
+    result.profile = world.profile();
 
     const auto& boids = world.get_boids();
+    auto outcome = [&](int b) {
+        return IndividualOutcome{boids[b].total_energy_gained, boids[b].total_energy_spent,
+                                 static_cast<float>(world.survival_ticks(b))};
+    };
     for (int i = 0; i < static_cast<int>(prey_genomes.size()); ++i) {
         result.prey_fitness[i] = boid_fitness(boids[i]);
+        result.prey_outcomes.push_back(outcome(i));
         if (boids[i].alive) ++result.prey_survivors;
     }
     for (int i = 0; i < static_cast<int>(predator_genomes.size()); ++i) {
         result.predator_fitness[i] = boid_fitness(boids[prey_count + i]);
+        result.predator_outcomes.push_back(outcome(prey_count + i));
         if (boids[prey_count + i].alive) ++result.predator_survivors;
     }
 
     return result;
 }
 
+// The genomes (and morphologies) of one population that a racing round runs
+struct RaceEntrants {
+    std::vector<NeatGenome> genomes;
+    std::vector<MorphologyGenome> morphologies;
+};
+
+// Fill every one of the population's slots with a contender, cycling through
+// them, so a later round's world is as crowded as the first. Slot s holds
+// contenders[s % contenders.size()].
+static RaceEntrants race_entrants(const Population& pop, const std::vector<int>& contenders) {
+    RaceEntrants out;
+    const size_t slots = static_cast<size_t>(pop.size());
+    out.genomes.reserve(slots);
+    for (size_t s = 0; s < slots; ++s) {
+        int idx = contenders[s % contenders.size()];
+        out.genomes.push_back(pop.genome(idx));
+        if (pop.has_morphology()) out.morphologies.push_back(pop.morphology(idx));
+    }
+    return out;
+}
+
+// Successive halving. The first round scores the whole population over
+// `episodes` worlds; each later round keeps the best keep_fraction of the
+// contenders (prey and predators separately) and scores them again. Later
+// worlds keep the full population sizes and food supply: every slot is
+// filled with a contender, cycling through them, and each copy adds a
+// sample. So conditions match the first round and the round needs only
+// contenders/population of the episodes to give each contender about
+// `episodes` more samples. Fitness and outcomes are means over an
+// individual's samples. Survivor counts and ticks come from the first round.
+// run(prey genomes, predator genomes, prey morphologies, predator
+// morphologies, rng, worker) plays one world. Adds the boid-episodes simulated to
+// `cost`.
+template <typename RunFn>
+static GenerationResult race_generation(const RacingConfig& racing, int episodes, ThreadPool* pool,
+                                        std::mt19937& rng, const Population& prey,
+                                        const Population* predator, RunFn run, long long& cost) {
+    static const std::vector<NeatGenome> no_predators;
+    const int prey_n = prey.size();
+    const int pred_n = predator ? predator->size() : 0;
+    FitnessRace prey_race(prey_n), pred_race(pred_n);
+    GenerationResult result;
+    result.prey_outcomes.resize(prey_n);
+    result.predator_outcomes.resize(pred_n);
+
+    // Credit slot s of a world to contender s % contenders.size()
+    auto add_outcomes = [](std::vector<IndividualOutcome>& sum, const std::vector<int>& contenders,
+                           const std::vector<IndividualOutcome>& add) {
+        for (size_t s = 0; s < add.size(); ++s) {
+            auto& o = sum[contenders[s % contenders.size()]];
+            o.energy_gained += add[s].energy_gained;
+            o.energy_spent += add[s].energy_spent;
+            o.survival_ticks += add[s].survival_ticks;
+        }
+    };
+    auto add_samples = [](FitnessRace& race, const std::vector<float>& fitness) {
+        const std::vector<int>& contenders = race.contenders();
+        for (size_t s = 0; s < fitness.size(); ++s) {
+            race.add_sample(contenders[s % contenders.size()], fitness[s]);
+        }
+    };
+
+    const int rounds = std::max(1, racing.rounds);
+    for (int round = 0; round < rounds; ++round) {
+        const std::vector<int>& prey_in = prey_race.contenders();
+        const std::vector<int>& pred_in = pred_race.contenders();
+
+        // The first round runs the populations as they are; later ones fill
+        // the worlds with copies of the contenders
+        RaceEntrants prey_sub, pred_sub;
+        if (round > 0) {
+            prey_sub = race_entrants(prey, prey_in);
+            if (predator) pred_sub = race_entrants(*predator, pred_in);
+        }
+        const auto& prey_genomes = round > 0 ? prey_sub.genomes : prey.genomes();
+        const auto& pred_genomes = !predator ? no_predators
+                                 : round > 0 ? pred_sub.genomes : predator->genomes();
+        const std::vector<MorphologyGenome>* prey_morphs = !prey.has_morphology() ? nullptr
+            : round > 0 ? &prey_sub.morphologies : &prey.morphologies();
+        const std::vector<MorphologyGenome>* pred_morphs =
+            !(predator && predator->has_morphology()) ? nullptr
+            : round > 0 ? &pred_sub.morphologies : &predator->morphologies();
+
+        // Enough worlds that the side with the larger share of contenders
+        // still gets about `episodes` samples each
+        int round_episodes = episodes;
+        if (round > 0) {
+            double share = static_cast<double>(prey_in.size()) / prey_n;
+            if (pred_n > 0) share = std::max(share, static_cast<double>(pred_in.size()) / pred_n);
+            round_episodes = std::clamp(static_cast<int>(std::ceil(episodes * share)), 1, episodes);
+        }
+
+        auto run_round = [&](std::mt19937& episode_rng, int worker) {
+            return run(prey_genomes, pred_genomes, prey_morphs, pred_morphs, episode_rng, worker);
+        };
+        std::vector<GenerationResult> results;
+        if (pool) {
+            results = run_episode_batch(round_episodes, *pool, rng, run_round);
+        } else {
+            results.push_back(run_round(rng, 0));
+        }
+        cost += static_cast<long long>(results.size()) * (prey_n + pred_n);
+
+        for (const auto& r : results) {
+            add_samples(prey_race, r.prey_fitness);
+            if (pred_n > 0) add_samples(pred_race, r.predator_fitness);
+            add_outcomes(result.prey_outcomes, prey_in, r.prey_outcomes);
+            if (pred_n > 0) add_outcomes(result.predator_outcomes, pred_in, r.predator_outcomes);
+            result.profile += r.profile;
+            if (round == 0) {
+                result.prey_survivors += r.prey_survivors;
+                result.predator_survivors += r.predator_survivors;
+                result.ticks_run += r.ticks_run;
+            }
+        }
+        if (round == 0) {
+            float inv = 1.0f / static_cast<float>(results.size());
+            result.prey_survivors = static_cast<int>(std::lround(result.prey_survivors * inv));
+            result.predator_survivors = static_cast<int>(std::lround(result.predator_survivors * inv));
+            result.ticks_run *= inv;
+        }
+
+        if (round + 1 < rounds) {
+            prey_race.cut(racing.keep_fraction);
+            pred_race.cut(racing.keep_fraction);
+        }
+    }
+
+    auto finish = [](const FitnessRace& race, std::vector<float>& fitness,
+                     std::vector<IndividualOutcome>& outcomes, std::vector<int>& samples,
+                     std::vector<float>& confidence) {
+        const int n = static_cast<int>(outcomes.size());
+        fitness.resize(n);
+        samples.resize(n);
+        confidence.resize(n);
+        for (int i = 0; i < n; ++i) {
+            fitness[i] = race.mean(i);
+            samples[i] = race.samples(i);
+            confidence[i] = race.confidence(i);
+            float inv = 1.0f / static_cast<float>(std::max(1, samples[i]));
+            outcomes[i].energy_gained *= inv;
+            outcomes[i].energy_spent *= inv;
+            outcomes[i].survival_ticks *= inv;
+        }
+    };
+    finish(prey_race, result.prey_fitness, result.prey_outcomes,
+           result.prey_episodes, result.prey_confidence);
+    finish(pred_race, result.predator_fitness, result.predator_outcomes,
+           result.predator_episodes, result.predator_confidence);
+    return result;
+}
+
+// One independently evolving set of populations (prey, plus predators when
+// co-evolving) with its own RNG. A plain run is a single island; island mode
+// evolves several side by side and migrates champions between them.
+struct Island {
+    std::mt19937 rng;
+    std::unique_ptr<Population> prey;
+    std::unique_ptr<Population> predator;   // null unless co-evolving
+    std::unique_ptr<ThreadPool> episode_pool;
+    // One per episode that can run at once, reused by every world the island
+    // steps; empty when worlds step serially
+    std::vector<std::unique_ptr<ThreadPool>> world_pools;
+    std::string output_dir;
+    std::string predator_output_dir;
+    std::string label;                      // log prefix, empty for a single island
+    GenerationResult result;                // this generation's evaluation
+    long long race_cost = 0;                // boid-episodes simulated while racing
+
+    float prey_all_time_best = 0.0f;
+    int prey_all_time_best_gen = -1;
+    float pred_all_time_best = 0.0f;
+    int pred_all_time_best_gen = -1;
+};
+
+// Spread of a morphology's eye directions and how dominant its widest eye is,
+// as telemetry summaries
+static void summarise_morphology(const MorphologyGenome& m, float& angle_spread, float& arc_max) {
+    double sum = 0.0, sum_sq = 0.0;
+    int count = 0;
+    arc_max = 0.0f;
+    for (const auto& group : m.groups) {
+        for (float a : group.angles) {
+            sum += a;
+            sum_sq += static_cast<double>(a) * a;
+            ++count;
+        }
+        float total = 0.0f, widest = 0.0f;
+        for (float f : group.arc_fracs) {
+            total += f;
+            widest = std::max(widest, f);
+        }
+        if (total > 0.0f) arc_max = std::max(arc_max, widest / total);
+    }
+    double mean = count > 0 ? sum / count : 0.0;
+    angle_spread = count > 0
+        ? static_cast<float>(std::sqrt(std::max(0.0, sum_sq / count - mean * mean))) : 0.0f;
+}
+
+// Append one population's generation row and per-individual rows
+static void collect_telemetry(TelemetryBatch& batch, int island, int gen,
+                              TelemetryPopulation which, const Population& pop,
+                              const std::vector<IndividualOutcome>& outcomes,
+                              const std::vector<int>& episodes,
+                              const std::vector<float>& confidence, int survivors, float ticks) {
+    std::vector<int> species_of(pop.size(), 0);
+    for (const auto& s : pop.species()) {
+        for (int idx : s.members) species_of[idx] = s.id;
+    }
+
+    GenerationTelemetry row;
+    row.island = island;
+    row.generation = gen;
+    row.population = which;
+    row.best_fitness = pop.best_fitness();
+    row.species_count = pop.species_count();
+    row.survivors = survivors;
+    row.ticks = ticks;
+
+    for (int i = 0; i < pop.size(); ++i) {
+        const NeatGenome& genome = pop.genome(i);
+        IndividualTelemetry ind;
+        ind.island = island;
+        ind.generation = gen;
+        ind.population = which;
+        ind.index = i;
+        ind.species_id = species_of[i];
+        ind.fitness = pop.fitness(i);
+        ind.episodes = episodes[i];
+        ind.fitness_confidence = confidence[i];
+        ind.energy_gained = outcomes[i].energy_gained;
+        ind.energy_spent = outcomes[i].energy_spent;
+        ind.survival_ticks = outcomes[i].survival_ticks;
+        ind.nodes = static_cast<int32_t>(genome.nodes().size());
+        ind.connections = static_cast<int32_t>(std::count_if(
+            genome.connections().begin(), genome.connections().end(),
+            [](const ConnectionGene& c) { return c.enabled; }));
+        if (pop.has_morphology()) {
+            summarise_morphology(pop.morphology(i), ind.eye_angle_spread, ind.eye_arc_max);
+        } else {
+            ind.eye_angle_spread = std::nanf("");
+            ind.eye_arc_max = std::nanf("");
+        }
+
+        row.mean_fitness += ind.fitness;
+        row.mean_nodes += static_cast<float>(ind.nodes);
+        row.mean_connections += static_cast<float>(ind.connections);
+        batch.individuals.push_back(ind);
+    }
+    float inv = 1.0f / static_cast<float>(std::max(1, pop.size()));
+    row.mean_fitness *= inv;
+    row.mean_nodes *= inv;
+    row.mean_connections *= inv;
+    batch.generations.push_back(row);
+}
+
+// Checkpoint layout (after the WBCP header): the generation to run next, the
+// island count and whether predators co-evolve, then per island its RNG,
+// populations and all-time-best bookkeeping.
+constexpr char CHECKPOINT_MAGIC[5] = "WBCP";
+constexpr uint32_t CHECKPOINT_VERSION = 1;
+
+// Write to a temporary file and rename it over `path`, so an interrupted
+// write never replaces the last good checkpoint.
+static void save_checkpoint(const std::string& path, const std::vector<Island>& islands,
+                            int next_gen) {
+    std::string tmp = path + ".tmp";
+    {
+        BinaryWriter out(tmp, CHECKPOINT_MAGIC, CHECKPOINT_VERSION);
+        out.write<int32_t>(next_gen);
+        out.write<uint32_t>(static_cast<uint32_t>(islands.size()));
+        out.write<uint8_t>(islands[0].predator != nullptr);
+        for (const auto& island : islands) {
+            write_rng(out, island.rng);
+            write_population(out, *island.prey);
+            if (island.predator) write_population(out, *island.predator);
+            out.write<float>(island.prey_all_time_best);
+            out.write<int32_t>(island.prey_all_time_best_gen);
+            out.write<float>(island.pred_all_time_best);
+            out.write<int32_t>(island.pred_all_time_best_gen);
+        }
+        out.finish();
+    }
+    std::filesystem::rename(tmp, path);
+}
+
+// Restore islands built from the same config and specs as the saved run.
+// Returns the generation to continue from.
+static int load_checkpoint(const std::string& path, std::vector<Island>& islands) {
+    BinaryReader in(path, CHECKPOINT_MAGIC);
+    if (in.version() != CHECKPOINT_VERSION) {
+        throw std::runtime_error("Unsupported checkpoint version " + std::to_string(in.version()));
+    }
+    int next_gen = in.read<int32_t>();
+    uint32_t island_count = in.read<uint32_t>();
+    bool coevolution = in.read<uint8_t>() != 0;
+    if (island_count != islands.size()) {
+        throw std::runtime_error("Checkpoint has " + std::to_string(island_count) +
+                                 " islands, run is configured for " + std::to_string(islands.size()));
+    }
+    if (coevolution != (islands[0].predator != nullptr)) {
+        throw std::runtime_error(coevolution
+            ? "Checkpoint was co-evolving predators; pass the same --predator-spec"
+            : "Checkpoint has no predators; drop --predator-spec");
+    }
+    for (auto& island : islands) {
+        read_rng(in, island.rng);
+        read_population(in, *island.prey);
+        if (island.predator) read_population(in, *island.predator);
+        island.prey_all_time_best = in.read<float>();
+        island.prey_all_time_best_gen = in.read<int32_t>();
+        island.pred_all_time_best = in.read<float>();
+        island.pred_all_time_best_gen = in.read<int32_t>();
+    }
+    return next_gen;
+}
+
+// One line per generation: where World::step spent its time and how busy
+// the neighbour queries were
+static void print_profile(const std::string& label, int gen, const StepProfile& p) {
+    if (p.steps == 0) return;
+    double total = static_cast<double>(p.total_ns());
+    double boid_steps = static_cast<double>(std::max<int64_t>(1, p.boid_steps));
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(1)
+         << "  " << label << "Profile gen " << gen << ": " << total * 1e-6 << " ms, "
+         << p.steps << " steps, " << total / boid_steps << " ns/boid-step |";
+    for (int ph = 0; ph < STEP_PHASE_COUNT; ++ph) {
+        line << " " << step_phase_name(static_cast<StepPhase>(ph)) << " "
+             << (total > 0.0 ? 100.0 * p.phase_ns[ph] / total : 0.0) << "%";
+    }
+    line << " | per boid-step: " << p.grid_candidates / boid_steps << " grid candidates, "
+         << p.eye_hits / boid_steps << " eye hits, "
+         << std::setprecision(3) << p.catch_candidates / boid_steps << " catch candidates\n";
+    std::cerr << line.str();
+}
+
+// Confidence half-width of the population's current best genome
+static float best_confidence(const Population& pop, const std::vector<float>& confidence) {
+    std::vector<int> best = pop.top_indices(1);
+    return best.empty() ? std::nanf("") : confidence[best[0]];
+}
+
+// A CSV cell: empty for NaN
+static std::string csv_float(float v) {
+    if (std::isnan(v)) return "";
+    std::ostringstream out;
+    out << v;
+    return out.str();
+}
+
 static void print_usage(const char* prog) {
     std::cerr << "Usage: " << prog << " [options]\n"
               << "\n  Config:\n"
               << "  --config PATH      Sim config JSON (default: data/sim_config.json)\n"
-              << "  --spec PATH        Prey boid spec JSON (default: data/simple_boid.json)\n"
+              << "  --spec PATH        Prey boid spec, JSON or .wbs (default: data/simple_boid.json)\n"
               << "  --predator-spec PATH  Predator boid spec (enables co-evolution)\n"
               << "\n  Evolution (override config):\n"
               << "  --generations N    Number of generations\n"
@@ -137,6 +530,18 @@ static void print_usage(const char* prog) {
               << "  --population N     Prey population size\n"
               << "  --predator-population N  Predator population size (default: same as prey)\n"
               << "  --ticks N          Ticks per generation\n"
+              << "  --episodes K       Independent worlds per generation, run in parallel; fitness averaged\n"
+              << "  --start-ticks N    Tick budget at generation 0, ramping up to --ticks\n"
+              << "  --ramp-generations N  Generations over which the tick budget ramps up\n"
+              << "  --early-stop       End an episode once fitness rankings have settled\n"
+              << "  --racing           Successive halving: re-evaluate only the best genomes\n"
+              << "  --racing-rounds N  Evaluation rounds, including the first full one (default: 3)\n"
+              << "  --racing-keep F    Fraction of contenders kept after each round (default: 0.5)\n"
+              << "\n  Islands (override config):\n"
+              << "  --islands N        Evolve N independent populations in parallel (default: 1)\n"
+              << "  --migration-interval N  Generations between champion migrations (0 = never)\n"
+              << "  --migrants N       Champions each island sends per migration\n"
+              << "  --migration-topology T  ring (to the next island) or full (to every island)\n"
               << "\n  World (override config):\n"
               << "  --world-size N     World width and height\n"
               << "  --food-max N       Max food items\n"
@@ -146,10 +551,20 @@ static void print_usage(const char* prog) {
               << "  --thrust-cost F    Energy cost per thrust per second\n"
               << "  --angular-drag F   Angular drag coefficient\n"
               << "  --linear-drag F    Linear drag coefficient\n"
+              << "  --threads N        Worker threads per world step (0 = all cores, default: config or 1;\n"
+              << "                     capped so worlds stepping at once fit on the cores)\n"
               << "\n  Output:\n"
               << "  --save-interval N  Save champion every N gens\n"
               << "  --output-dir PATH  Directory for saved genomes (default: data/champions)\n"
               << "  --save-best        Save whenever a new all-time best fitness is found\n"
+              << "  --trace PATH       Write a Chrome/Perfetto timeline of the run (trace-event JSON)\n"
+              << "  --profile          Print a per-generation breakdown of World::step phases\n"
+              << "                     (needs a build with -DWILDBOIDS_PROFILING=ON)\n"
+              << "  --telemetry PATH   Write per-generation and per-individual stats (binary,\n"
+              << "                     export with wildboids_telemetry). --resume appends to it\n"
+              << "  --checkpoint PATH  Write a binary checkpoint of the full run state to PATH\n"
+              << "  --checkpoint-interval N  Generations between checkpoints (default: 1)\n"
+              << "  --resume PATH      Continue a run from a checkpoint (same config and specs)\n"
               << "  --help             Show this help\n";
 }
 
@@ -161,6 +576,12 @@ int main(int argc, char* argv[]) {
     std::string predator_spec_path;  // empty = no predators (backward compat)
     std::string output_dir = "data/champions";
     bool save_best = false;
+    bool profile = false;
+    std::string checkpoint_path;
+    int checkpoint_interval = 1;
+    std::string resume_path;
+    std::string telemetry_path;
+    std::string trace_path;
 
     // Track which CLI flags were explicitly set (to override config)
     bool cli_generations = false, cli_population = false, cli_ticks = false;
@@ -169,10 +590,18 @@ int main(int argc, char* argv[]) {
     bool cli_food_energy = false, cli_metabolism = false, cli_thrust_cost = false;
     bool cli_angular_drag = false, cli_linear_drag = false;
     bool cli_predator_population = false;
+    bool cli_threads = false, cli_episodes = false;
+    bool cli_islands = false, cli_migration_interval = false, cli_migrants = false;
+    bool cli_start_ticks = false, cli_ramp_generations = false, cli_early_stop = false;
+    bool cli_racing = false, cli_racing_rounds = false, cli_racing_keep = false;
+    std::string ov_migration_topology;
 
     // Temp storage for CLI overrides
     int ov_generations = 0, ov_population = 0, ov_ticks = 0, ov_save_interval = 0;
-    int ov_food_max = 0, ov_predator_population = 0;
+    int ov_food_max = 0, ov_predator_population = 0, ov_threads = 1, ov_episodes = 1;
+    int ov_islands = 1, ov_migration_interval = 0, ov_migrants = 0;
+    int ov_start_ticks = 0, ov_ramp_generations = 0, ov_racing_rounds = 0;
+    float ov_racing_keep = 0;
     float ov_world_size = 0, ov_food_rate = 0, ov_food_energy = 0;
     float ov_metabolism = 0, ov_thrust_cost = 0;
     float ov_angular_drag = 0, ov_linear_drag = 0;
@@ -181,6 +610,8 @@ int main(int argc, char* argv[]) {
     for (int i = 1; i < argc; ++i) {
         if (std::strcmp(argv[i], "--save-best") == 0) {
             save_best = true;
+        } else if (std::strcmp(argv[i], "--profile") == 0) {
+            profile = true;
         } else if (std::strcmp(argv[i], "--help") == 0) {
             print_usage(argv[0]);
             return 0;
@@ -192,6 +623,16 @@ int main(int argc, char* argv[]) {
             predator_spec_path = argv[++i];
         } else if (std::strcmp(argv[i], "--output-dir") == 0 && i + 1 < argc) {
             output_dir = argv[++i];
+        } else if (std::strcmp(argv[i], "--telemetry") == 0 && i + 1 < argc) {
+            telemetry_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            trace_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--checkpoint") == 0 && i + 1 < argc) {
+            checkpoint_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--checkpoint-interval") == 0 && i + 1 < argc) {
+            checkpoint_interval = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--resume") == 0 && i + 1 < argc) {
+            resume_path = argv[++i];
         } else if (std::strcmp(argv[i], "--generations") == 0 && i + 1 < argc) {
             ov_generations = std::atoi(argv[++i]); cli_generations = true;
         } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
@@ -202,6 +643,28 @@ int main(int argc, char* argv[]) {
             ov_predator_population = std::atoi(argv[++i]); cli_predator_population = true;
         } else if (std::strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
             ov_ticks = std::atoi(argv[++i]); cli_ticks = true;
+        } else if (std::strcmp(argv[i], "--episodes") == 0 && i + 1 < argc) {
+            ov_episodes = std::atoi(argv[++i]); cli_episodes = true;
+        } else if (std::strcmp(argv[i], "--start-ticks") == 0 && i + 1 < argc) {
+            ov_start_ticks = std::atoi(argv[++i]); cli_start_ticks = true;
+        } else if (std::strcmp(argv[i], "--ramp-generations") == 0 && i + 1 < argc) {
+            ov_ramp_generations = std::atoi(argv[++i]); cli_ramp_generations = true;
+        } else if (std::strcmp(argv[i], "--early-stop") == 0) {
+            cli_early_stop = true;
+        } else if (std::strcmp(argv[i], "--racing") == 0) {
+            cli_racing = true;
+        } else if (std::strcmp(argv[i], "--racing-rounds") == 0 && i + 1 < argc) {
+            ov_racing_rounds = std::atoi(argv[++i]); cli_racing_rounds = true;
+        } else if (std::strcmp(argv[i], "--racing-keep") == 0 && i + 1 < argc) {
+            ov_racing_keep = static_cast<float>(std::atof(argv[++i])); cli_racing_keep = true;
+        } else if (std::strcmp(argv[i], "--islands") == 0 && i + 1 < argc) {
+            ov_islands = std::atoi(argv[++i]); cli_islands = true;
+        } else if (std::strcmp(argv[i], "--migration-interval") == 0 && i + 1 < argc) {
+            ov_migration_interval = std::atoi(argv[++i]); cli_migration_interval = true;
+        } else if (std::strcmp(argv[i], "--migrants") == 0 && i + 1 < argc) {
+            ov_migrants = std::atoi(argv[++i]); cli_migrants = true;
+        } else if (std::strcmp(argv[i], "--migration-topology") == 0 && i + 1 < argc) {
+            ov_migration_topology = argv[++i];
         } else if (std::strcmp(argv[i], "--save-interval") == 0 && i + 1 < argc) {
             ov_save_interval = std::atoi(argv[++i]); cli_save_interval = true;
         } else if (std::strcmp(argv[i], "--world-size") == 0 && i + 1 < argc) {
@@ -220,6 +683,8 @@ int main(int argc, char* argv[]) {
             ov_angular_drag = static_cast<float>(std::atof(argv[++i])); cli_angular_drag = true;
         } else if (std::strcmp(argv[i], "--linear-drag") == 0 && i + 1 < argc) {
             ov_linear_drag = static_cast<float>(std::atof(argv[++i])); cli_linear_drag = true;
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            ov_threads = std::atoi(argv[++i]); cli_threads = true;
         } else {
             std::cerr << "Unknown option: " << argv[i] << "\n";
             print_usage(argv[0]);
@@ -227,6 +692,11 @@ int main(int argc, char* argv[]) {
         }
     }
 
+    if (profile && !StepProfile::enabled) {
+        std::cerr << "Warning: --profile needs a build with -DWILDBOIDS_PROFILING=ON; ignoring\n";
+        profile = false;
+    }
+
     // Load sim config from JSON
     SimConfig sim;
     try {
@@ -242,6 +712,30 @@ int main(int argc, char* argv[]) {
     if (cli_population)   sim.neat.population_size = ov_population;
     if (cli_ticks)        sim.ticks_per_generation = ov_ticks;
     if (cli_save_interval) sim.save_interval = ov_save_interval;
+    if (cli_episodes) {
+        if (ov_episodes < 1) {
+            std::cerr << "--episodes must be at least 1, got " << ov_episodes << "\n";
+            return 1;
+        }
+        sim.episodes = ov_episodes;
+    }
+    if (cli_start_ticks)  sim.episode_length.start_ticks = ov_start_ticks;
+    if (cli_ramp_generations) sim.episode_length.ramp_generations = ov_ramp_generations;
+    if (cli_early_stop)   sim.episode_length.early_stop = true;
+    if (cli_racing)       sim.racing.enabled = true;
+    if (cli_racing_rounds) sim.racing.rounds = ov_racing_rounds;
+    if (cli_racing_keep)  sim.racing.keep_fraction = ov_racing_keep;
+    if (cli_islands)      sim.islands.count = ov_islands;
+    if (cli_migration_interval) sim.islands.migration_interval = ov_migration_interval;
+    if (cli_migrants)     sim.islands.migrants = ov_migrants;
+    if (!ov_migration_topology.empty()) {
+        try {
+            sim.islands.topology = parse_migration_topology(ov_migration_topology);
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << "\n";
+            return 1;
+        }
+    }
     if (cli_world_size)   { sim.world.width = ov_world_size; sim.world.height = ov_world_size; }
     if (cli_food_max)     sim.world.food_max = ov_food_max;
     if (cli_food_rate)    sim.world.food_spawn_rate = ov_food_rate;
@@ -250,6 +744,7 @@ int main(int argc, char* argv[]) {
     if (cli_thrust_cost)  sim.world.thrust_cost = ov_thrust_cost;
     if (cli_angular_drag) sim.world.angular_drag = ov_angular_drag;
     if (cli_linear_drag)  sim.world.linear_drag = ov_linear_drag;
+    if (cli_threads)      sim.world.threads = ov_threads;
 
     bool coevolution = !predator_spec_path.empty();
 
@@ -265,22 +760,19 @@ int main(int argc, char* argv[]) {
     int prey_n_sensors = sensor_input_count(prey_spec);
     int prey_n_thrusters = static_cast<int>(prey_spec.thrusters.size());
 
-    // Create seed genome and prey population
-    // If the spec has an embedded genome (i.e. it's a champion file), use it as the seed
-    std::mt19937 rng(static_cast<unsigned>(rng_seed));
+    // Seed genomes. If a spec has an embedded genome (i.e. it's a champion
+    // file), use it as the seed.
     int next_innov = 1;
     NeatGenome prey_seed;
     if (prey_spec.genome.has_value()) {
         prey_seed = *prey_spec.genome;
         std::cerr << "Seeding prey population from champion genome ("
-                  << prey_seed.connections.size() << " connections, "
-                  << prey_seed.nodes.size() << " nodes)\n";
+                  << prey_seed.connections().size() << " connections, "
+                  << prey_seed.nodes().size() << " nodes)\n";
     } else {
         prey_seed = NeatGenome::minimal(prey_n_sensors, prey_n_thrusters, next_innov);
     }
 
-    Population prey_pop(prey_seed, sim.neat, rng);
-
     // Validate morphology config matches boid spec eye counts
     if (sim.morphology.enabled && prey_spec.compound_eyes.has_value()) {
         std::string err = validate_morphology_config(*prey_spec.compound_eyes, sim.morphology);
@@ -290,22 +782,19 @@ int main(int argc, char* argv[]) {
         }
     }
 
-    // Enable morphology evolution for prey if configured
     if (sim.morphology.enabled) {
         if (prey_spec.morphology_genome.has_value()) {
-            prey_pop.enable_morphology(sim.morphology, *prey_spec.morphology_genome);
             std::cerr << "Prey morphology evolution enabled (seeded from champion)\n";
         } else {
-            prey_pop.enable_morphology(sim.morphology);
             std::cerr << "Prey morphology evolution enabled ("
                       << sim.morphology.groups.size() << " groups)\n";
         }
     }
 
-    // Load predator spec and create predator population (if co-evolution enabled)
+    // Load predator spec (if co-evolution enabled)
     BoidSpec predator_spec;
-    std::unique_ptr<Population> predator_pop;
     PopulationParams predator_neat_params = sim.neat;
+    NeatGenome pred_seed;
 
     if (coevolution) {
         try {
@@ -324,16 +813,14 @@ int main(int argc, char* argv[]) {
         }
 
         next_innov = 1;
-        NeatGenome pred_seed;
         if (predator_spec.genome.has_value()) {
             pred_seed = *predator_spec.genome;
             std::cerr << "Seeding predator population from champion genome ("
-                      << pred_seed.connections.size() << " connections, "
-                      << pred_seed.nodes.size() << " nodes)\n";
+                      << pred_seed.connections().size() << " connections, "
+                      << pred_seed.nodes().size() << " nodes)\n";
         } else {
             pred_seed = NeatGenome::minimal(pred_n_sensors, pred_n_thrusters, next_innov);
         }
-        predator_pop = std::make_unique<Population>(pred_seed, predator_neat_params, rng);
 
         // Validate morphology config matches predator spec eye counts
         if (sim.morphology.enabled && predator_spec.compound_eyes.has_value()) {
@@ -344,17 +831,59 @@ int main(int argc, char* argv[]) {
             }
         }
 
-        // Enable morphology evolution for predators if configured
+        std::cerr << "Co-evolution enabled: " << predator_neat_params.population_size
+                  << " predators\n";
+    }
+
+    // Islands: independent populations, each seeded from --seed plus its index,
+    // so island 0 of any run is the plain single-population run. Each island
+    // numbers innovations and hidden nodes in its own class, so migrants'
+    // genes never share a number with a different gene on their new island.
+    const IslandConfig& island_cfg = sim.islands;
+    const int island_count = std::max(1, island_cfg.count);
+    const bool island_mode = island_count > 1;
+    std::vector<Island> islands(island_count);
+    for (int i = 0; i < island_count; ++i) {
+        Island& island = islands[i];
+        island.rng.seed(static_cast<unsigned>(rng_seed + i));
+
+        island.prey = std::make_unique<Population>(prey_seed, sim.neat, island.rng);
+        island.prey->set_innovation_class(i, island_count);
         if (sim.morphology.enabled) {
-            if (predator_spec.morphology_genome.has_value()) {
-                predator_pop->enable_morphology(sim.morphology, *predator_spec.morphology_genome);
+            if (prey_spec.morphology_genome.has_value()) {
+                island.prey->enable_morphology(sim.morphology, *prey_spec.morphology_genome);
             } else {
-                predator_pop->enable_morphology(sim.morphology);
+                island.prey->enable_morphology(sim.morphology);
             }
         }
 
-        std::cerr << "Co-evolution enabled: " << predator_neat_params.population_size
-                  << " predators\n";
+        if (coevolution) {
+            island.predator = std::make_unique<Population>(pred_seed, predator_neat_params, island.rng);
+            island.predator->set_innovation_class(i, island_count);
+            if (sim.morphology.enabled) {
+                if (predator_spec.morphology_genome.has_value()) {
+                    island.predator->enable_morphology(sim.morphology, *predator_spec.morphology_genome);
+                } else {
+                    island.predator->enable_morphology(sim.morphology);
+                }
+            }
+        }
+
+        island.output_dir = island_mode ? output_dir + "/island" + std::to_string(i) : output_dir;
+        island.predator_output_dir = island.output_dir + "/predators";
+        island.label = island_mode ? "[island " + std::to_string(i) + "] " : "";
+    }
+
+    // Resuming overwrites the freshly built islands with the saved state
+    int start_gen = 0;
+    if (!resume_path.empty()) {
+        try {
+            start_gen = load_checkpoint(resume_path, islands);
+            std::cerr << "Resumed from " << resume_path << " at gen " << start_gen << "\n";
+        } catch (const std::exception& e) {
+            std::cerr << "Failed to resume: " << e.what() << "\n";
+            return 1;
+        }
     }
 
     // Print config summary to stderr
@@ -369,171 +898,402 @@ int main(int argc, char* argv[]) {
         std::cerr << " (pred: " << *predator_spec.metabolism_rate << ")";
     std::cerr << "  Thrust cost: " << sim.world.thrust_cost
               << "  Drag: " << sim.world.linear_drag << "/" << sim.world.angular_drag
-              << "  Fitness: " << (sim.fitness_mode == FitnessMode::Net ? "net" : "gross") << "\n";
+              << "  Fitness: " << (sim.fitness_mode == FitnessMode::Net ? "net" : "gross");
+    if (sim.episodes > 1)
+        std::cerr << "  Episodes: " << sim.episodes;
+    const EpisodeLengthConfig& length = sim.episode_length;
+    bool adaptive_length = length.early_stop || ticks_for_generation(sim, 0) < sim.ticks_per_generation;
+    if (ticks_for_generation(sim, 0) < sim.ticks_per_generation)
+        std::cerr << "  Ticks ramp: " << length.start_ticks << " over " << length.ramp_generations << " gens";
+    if (length.early_stop)
+        std::cerr << "  Early stop: rank corr >= " << length.rank_correlation
+                  << " x" << length.patience << " every " << length.check_interval << " ticks";
+    const RacingConfig& racing = sim.racing;
+    if (racing.enabled)
+        std::cerr << "  Racing: " << racing.rounds << " rounds, keep " << racing.keep_fraction;
+    if (sim.world.brain_activation != ActivationPrecision::Exact)
+        std::cerr << "  Activation: " << activation_precision_name(sim.world.brain_activation);
+    if (island_mode) {
+        std::cerr << "  Islands: " << island_count << " ("
+                  << (island_cfg.topology == MigrationTopology::Ring ? "ring" : "full")
+                  << ", " << island_cfg.migrants << " every " << island_cfg.migration_interval
+                  << " gens)";
+    }
+    std::cerr << "\n";
 
     // Print header
+    if (island_mode) std::cout << "island,";
     if (coevolution) {
         std::cout << "gen,prey_best,prey_mean,pred_best,pred_mean,"
-                  << "prey_species,pred_species,prey_survivors,pred_survivors\n";
+                  << "prey_species,pred_species,prey_survivors,pred_survivors";
+        if (racing.enabled) std::cout << ",prey_best_ci,pred_best_ci";
     } else {
-        std::cout << "gen,best_fitness,mean_fitness,species_count,pop_size,survivors\n";
+        std::cout << "gen,best_fitness,mean_fitness,species_count,pop_size,survivors";
+        if (racing.enabled) std::cout << ",best_ci";
     }
+    std::cout << "\n";
 
     // Create output directories
-    std::filesystem::create_directories(output_dir);
-    std::string predator_output_dir = output_dir + "/predators";
-    if (coevolution) {
-        std::filesystem::create_directories(predator_output_dir);
+    for (const auto& island : islands) {
+        std::filesystem::create_directories(island.output_dir);
+        if (coevolution) {
+            std::filesystem::create_directories(island.predator_output_dir);
+        }
     }
 
-    float prey_all_time_best = 0.0f;
-    int prey_all_time_best_gen = -1;
-    float pred_all_time_best = 0.0f;
-    int pred_all_time_best_gen = -1;
+    // Islands run concurrently, one per pool thread. Episodes run concurrently
+    // too, but only when there is a single island; within island mode each
+    // island runs its episodes in turn (results are the same either way).
+    int hw = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    std::unique_ptr<ThreadPool> island_pool;
+    if (island_mode) {
+        island_pool = std::make_unique<ThreadPool>(std::min(island_count, hw));
+    }
+    if (sim.episodes > 1) {
+        for (auto& island : islands) {
+            island.episode_pool = std::make_unique<ThreadPool>(
+                island_mode ? 1 : std::min(sim.episodes, hw));
+        }
+    }
+
+    // Worlds step on pools made once here, not one per World. Every world
+    // that can run at the same time gets its own, and the requested threads
+    // per world shrink so they all fit on the machine together.
+    const int concurrent_worlds = island_mode
+        ? std::min(island_count, hw)
+        : (islands[0].episode_pool ? islands[0].episode_pool->size() : 1);
+    int world_threads = sim.world.threads > 0 ? sim.world.threads : hw;
+    if (world_threads * concurrent_worlds > hw) {
+        world_threads = std::max(1, hw / concurrent_worlds);
+    }
+    if (world_threads > 1) {
+        for (auto& island : islands) {
+            int slots = island.episode_pool ? island.episode_pool->size() : 1;
+            for (int k = 0; k < slots; ++k) {
+                island.world_pools.push_back(std::make_unique<ThreadPool>(world_threads));
+            }
+        }
+    }
+    auto for_each_island = [&](auto&& fn) {
+        if (island_pool) {
+            island_pool->parallel_for(island_count, 1, [&](int begin, int end, int) {
+                for (int i = begin; i < end; ++i) fn(islands[i]);
+            });
+        } else {
+            fn(islands[0]);
+        }
+    };
+
+    // Stats are gathered here and formatted and written on the writer's thread
+    std::unique_ptr<TelemetryWriter> telemetry;
+    if (!telemetry_path.empty()) {
+        try {
+            // A resumed run continues its telemetry file instead of replacing it
+            telemetry = resume_path.empty()
+                ? std::make_unique<TelemetryWriter>(telemetry_path)
+                : std::make_unique<TelemetryWriter>(telemetry_path, start_gen);
+        } catch (const std::exception& e) {
+            std::cerr << "Failed to open telemetry file: " << e.what() << "\n";
+            return 1;
+        }
+    }
+
+    // Prepare morphology pointers (null if morphology evolution disabled)
+    const MorphologyEvolutionConfig* morpho_cfg =
+        sim.morphology.enabled ? &sim.morphology : nullptr;
+
+    // Ticks actually simulated against the budget, per episode
+    double ticks_run = 0.0, ticks_budget = 0.0;
+
+    if (!trace_path.empty()) {
+        set_trace_thread_name("main");
+        try {
+            trace_start(trace_path);
+        } catch (const std::exception& e) {
+            std::cerr << "Failed to open trace file: " << e.what() << "\n";
+            return 1;
+        }
+    }
 
     // Evolution loop
-    for (int gen = 0; gen < sim.generations; ++gen) {
-        // Empty predator genomes vector for prey-only mode
-        static const std::vector<NeatGenome> no_predators;
-
-        // Prepare morphology pointers (null if morphology evolution disabled)
-        const MorphologyEvolutionConfig* morpho_cfg =
-            sim.morphology.enabled ? &sim.morphology : nullptr;
-
-        auto result = run_generation(
-            prey_pop.genomes(),
-            coevolution ? predator_pop->genomes() : no_predators,
-            prey_spec,
-            predator_spec,
-            sim.world,
-            sim.ticks_per_generation,
-            sim.fitness_mode,
-            rng,
-            prey_pop.has_morphology() ? &prey_pop.morphologies() : nullptr,
-            morpho_cfg,
-            (coevolution && predator_pop->has_morphology()) ? &predator_pop->morphologies() : nullptr,
-            morpho_cfg);
-
-        // Evaluate prey fitness
-        prey_pop.evaluate([&](int idx, const NeatGenome&) {
-            return result.prey_fitness[idx];
-        });
+    for (int gen = start_gen; gen < sim.generations; ++gen) {
+        TraceSpan gen_span("generation", "evolution", "gen", gen);
 
-        float prey_mean = 0.0f;
-        for (float f : result.prey_fitness) prey_mean += f;
-        prey_mean /= static_cast<float>(result.prey_fitness.size());
+        // Evaluate every island's current generation
+        for_each_island([&](Island& island) {
+            TraceSpan span("evaluate", "evolution", "gen", gen);
+            // Empty predator genomes vector for prey-only mode
+            static const std::vector<NeatGenome> no_predators;
+            Population& prey_pop = *island.prey;
 
-        if (coevolution) {
-            // Evaluate predator fitness
-            predator_pop->evaluate([&](int idx, const NeatGenome&) {
-                return result.predator_fitness[idx];
+            auto run_world = [&](const std::vector<NeatGenome>& prey_genomes,
+                                 const std::vector<NeatGenome>& predator_genomes,
+                                 const std::vector<MorphologyGenome>* prey_morphologies,
+                                 const std::vector<MorphologyGenome>* pred_morphologies,
+                                 std::mt19937& episode_rng, int worker) {
+                return run_generation(
+                    prey_genomes,
+                    predator_genomes,
+                    prey_spec,
+                    predator_spec,
+                    sim.world,
+                    ticks_for_generation(sim, gen),
+                    sim.episode_length,
+                    sim.fitness_mode,
+                    episode_rng,
+                    island.world_pools.empty() ? nullptr : island.world_pools[worker].get(),
+                    prey_morphologies,
+                    morpho_cfg,
+                    pred_morphologies,
+                    morpho_cfg);
+            };
+
+            if (racing.enabled) {
+                island.result = race_generation(racing, sim.episodes, island.episode_pool.get(),
+                                                island.rng, prey_pop, island.predator.get(),
+                                                run_world, island.race_cost);
+            } else {
+                auto run_episode = [&](std::mt19937& episode_rng, int worker) {
+                    return run_world(
+                        prey_pop.genomes(),
+                        coevolution ? island.predator->genomes() : no_predators,
+                        prey_pop.has_morphology() ? &prey_pop.morphologies() : nullptr,
+                        (coevolution && island.predator->has_morphology())
+                            ? &island.predator->morphologies() : nullptr,
+                        episode_rng, worker);
+                };
+
+                // A single episode uses the island rng directly (identical to older runs)
+                island.result = island.episode_pool
+                    ? run_episodes(sim.episodes, *island.episode_pool, island.rng, run_episode)
+                    : run_episode(island.rng, 0);
+
+                // Plain evaluation gives everyone the same episodes and no bounds
+                GenerationResult& r = island.result;
+                r.prey_episodes.assign(r.prey_fitness.size(), sim.episodes);
+                r.predator_episodes.assign(r.predator_fitness.size(), sim.episodes);
+                r.prey_confidence.assign(r.prey_fitness.size(), std::nanf(""));
+                r.predator_confidence.assign(r.predator_fitness.size(), std::nanf(""));
+            }
+
+            prey_pop.evaluate([&](int idx, const NeatGenome&) {
+                return island.result.prey_fitness[idx];
             });
+            if (coevolution) {
+                island.predator->evaluate([&](int idx, const NeatGenome&) {
+                    return island.result.predator_fitness[idx];
+                });
+            }
+        });
+
+        // Report and save, island by island
+        TelemetryBatch batch;
+        TraceSpan report_span("report", "evolution");
+        for (int i = 0; i < island_count; ++i) {
+            Island& island = islands[i];
+            Population& prey_pop = *island.prey;
+            const GenerationResult& result = island.result;
+            ticks_run += result.ticks_run;
+            ticks_budget += ticks_for_generation(sim, gen);
+
+            float prey_mean = 0.0f;
+            for (float f : result.prey_fitness) prey_mean += f;
+            prey_mean /= static_cast<float>(result.prey_fitness.size());
 
-            float pred_mean = 0.0f;
-            for (float f : result.predator_fitness) pred_mean += f;
-            pred_mean /= static_cast<float>(result.predator_fitness.size());
-
-            std::cout << gen << ","
-                      << prey_pop.best_fitness() << ","
-                      << prey_mean << ","
-                      << predator_pop->best_fitness() << ","
-                      << pred_mean << ","
-                      << prey_pop.species_count() << ","
-                      << predator_pop->species_count() << ","
-                      << result.prey_survivors << ","
-                      << result.predator_survivors << "\n";
-
-            // Track predator all-time best
-            bool pred_new_best = predator_pop->best_fitness() > pred_all_time_best;
-            if (pred_new_best) {
-                pred_all_time_best = predator_pop->best_fitness();
-                pred_all_time_best_gen = gen;
-                std::cerr << "  New predator all-time best: " << pred_all_time_best
-                          << " at gen " << gen << "\n";
+            if (island_mode) std::cout << i << ",";
+            if (coevolution) {
+                Population& predator_pop = *island.predator;
+                float pred_mean = 0.0f;
+                for (float f : result.predator_fitness) pred_mean += f;
+                pred_mean /= static_cast<float>(result.predator_fitness.size());
+
+                std::cout << gen << ","
+                          << prey_pop.best_fitness() << ","
+                          << prey_mean << ","
+                          << predator_pop.best_fitness() << ","
+                          << pred_mean << ","
+                          << prey_pop.species_count() << ","
+                          << predator_pop.species_count() << ","
+                          << result.prey_survivors << ","
+                          << result.predator_survivors;
+                if (racing.enabled) {
+                    std::cout << "," << csv_float(best_confidence(prey_pop, result.prey_confidence))
+                              << "," << csv_float(best_confidence(predator_pop, result.predator_confidence));
+                }
+                std::cout << "\n";
+
+                // Track predator all-time best
+                bool pred_new_best = predator_pop.best_fitness() > island.pred_all_time_best;
+                if (pred_new_best) {
+                    island.pred_all_time_best = predator_pop.best_fitness();
+                    island.pred_all_time_best_gen = gen;
+                    std::cerr << "  " << island.label << "New predator all-time best: "
+                              << island.pred_all_time_best << " at gen " << gen << "\n";
+                }
+            } else {
+                std::cout << gen << ","
+                          << prey_pop.best_fitness() << ","
+                          << prey_mean << ","
+                          << prey_pop.species_count() << ","
+                          << prey_pop.size() << ","
+                          << result.prey_survivors;
+                if (racing.enabled) {
+                    std::cout << "," << csv_float(best_confidence(prey_pop, result.prey_confidence));
+                }
+                std::cout << "\n";
             }
-        } else {
-            std::cout << gen << ","
-                      << prey_pop.best_fitness() << ","
-                      << prey_mean << ","
-                      << prey_pop.species_count() << ","
-                      << prey_pop.size() << ","
-                      << result.prey_survivors << "\n";
-        }
-
-        // Track prey all-time best
-        bool prey_new_best = prey_pop.best_fitness() > prey_all_time_best;
-        if (prey_new_best) {
-            prey_all_time_best = prey_pop.best_fitness();
-            prey_all_time_best_gen = gen;
-            std::cerr << "  New prey all-time best: " << prey_all_time_best
-                      << " at gen " << gen << "\n";
-        }
-
-        // Save champions periodically
-        bool interval_save = sim.save_interval > 0 &&
-            (gen % sim.save_interval == 0 || gen == sim.generations - 1);
-        bool best_prey_save = save_best && prey_new_best;
-
-        if (interval_save || best_prey_save) {
-            BoidSpec champion_spec = prey_spec;
-            champion_spec.genome = prey_pop.best_genome();
-            if (prey_pop.has_morphology()) {
-                champion_spec.morphology_genome = prey_pop.best_morphology();
+
+            // Track prey all-time best
+            bool prey_new_best = prey_pop.best_fitness() > island.prey_all_time_best;
+            if (prey_new_best) {
+                island.prey_all_time_best = prey_pop.best_fitness();
+                island.prey_all_time_best_gen = gen;
+                std::cerr << "  " << island.label << "New prey all-time best: "
+                          << island.prey_all_time_best << " at gen " << gen << "\n";
             }
-            std::string prefix = coevolution ? "champion_prey_gen" : "champion_gen";
-            std::string path = output_dir + "/" + prefix + std::to_string(gen) + ".json";
-            try {
-                save_boid_spec(champion_spec, path);
-            } catch (const std::exception& e) {
-                std::cerr << "Warning: failed to save prey champion: " << e.what() << "\n";
+
+            if (profile) print_profile(island.label, gen, result.profile);
+
+            if (telemetry) {
+                collect_telemetry(batch, i, gen, TelemetryPopulation::Prey, prey_pop,
+                                  result.prey_outcomes, result.prey_episodes,
+                                  result.prey_confidence, result.prey_survivors, result.ticks_run);
+                if (coevolution) {
+                    collect_telemetry(batch, i, gen, TelemetryPopulation::Predator,
+                                      *island.predator, result.predator_outcomes,
+                                      result.predator_episodes, result.predator_confidence,
+                                      result.predator_survivors, result.ticks_run);
+                }
             }
-        }
 
-        if (coevolution) {
-            bool best_pred_save = save_best &&
-                (predator_pop->best_fitness() > pred_all_time_best ||
-                 (pred_all_time_best_gen == gen));
-
-            if (interval_save || best_pred_save) {
-                BoidSpec champion_spec = predator_spec;
-                champion_spec.genome = predator_pop->best_genome();
-                if (predator_pop->has_morphology()) {
-                    champion_spec.morphology_genome = predator_pop->best_morphology();
+            // Save champions periodically
+            bool interval_save = sim.save_interval > 0 &&
+                (gen % sim.save_interval == 0 || gen == sim.generations - 1);
+            bool best_prey_save = save_best && prey_new_best;
+
+            if (interval_save || best_prey_save) {
+                BoidSpec champion_spec = prey_spec;
+                champion_spec.genome = prey_pop.best_genome();
+                if (prey_pop.has_morphology()) {
+                    champion_spec.morphology_genome = prey_pop.best_morphology();
                 }
-                std::string path = predator_output_dir + "/champion_predator_gen"
-                    + std::to_string(gen) + ".json";
+                std::string prefix = coevolution ? "champion_prey_gen" : "champion_gen";
+                std::string path = island.output_dir + "/" + prefix + std::to_string(gen) + ".json";
+                TraceSpan span("save_champion", "io");
                 try {
                     save_boid_spec(champion_spec, path);
                 } catch (const std::exception& e) {
-                    std::cerr << "Warning: failed to save predator champion: " << e.what() << "\n";
+                    std::cerr << "Warning: failed to save prey champion: " << e.what() << "\n";
+                }
+            }
+
+            if (coevolution) {
+                Population& predator_pop = *island.predator;
+                bool best_pred_save = save_best &&
+                    (predator_pop.best_fitness() > island.pred_all_time_best ||
+                     (island.pred_all_time_best_gen == gen));
+
+                if (interval_save || best_pred_save) {
+                    BoidSpec champion_spec = predator_spec;
+                    champion_spec.genome = predator_pop.best_genome();
+                    if (predator_pop.has_morphology()) {
+                        champion_spec.morphology_genome = predator_pop.best_morphology();
+                    }
+                    std::string path = island.predator_output_dir + "/champion_predator_gen"
+                        + std::to_string(gen) + ".json";
+                    TraceSpan span("save_champion", "io");
+                    try {
+                        save_boid_spec(champion_spec, path);
+                    } catch (const std::exception& e) {
+                        std::cerr << "Warning: failed to save predator champion: " << e.what() << "\n";
+                    }
                 }
             }
         }
 
+        if (telemetry) telemetry->submit(std::move(batch));
+        report_span.end();
+
         if (gen < sim.generations - 1) {
-            prey_pop.advance_generation();
-            if (coevolution) {
-                predator_pop->advance_generation();
+            if (migration_due(island_cfg, gen)) {
+                TraceSpan span("migrate", "evolution");
+                std::vector<Population*> prey_pops, pred_pops;
+                for (Island& island : islands) {
+                    prey_pops.push_back(island.prey.get());
+                    pred_pops.push_back(island.predator.get());
+                }
+                migrate(prey_pops, pred_pops, island_cfg);
             }
+            for_each_island([](Island& island) {
+                island.prey->advance_generation();
+                if (island.predator) {
+                    island.predator->advance_generation();
+                }
+            });
+
+            if (!checkpoint_path.empty() && (gen + 1) % checkpoint_interval == 0) {
+                TraceSpan span("checkpoint", "io");
+                try {
+                    save_checkpoint(checkpoint_path, islands, gen + 1);
+                } catch (const std::exception& e) {
+                    std::cerr << "Warning: failed to write checkpoint: " << e.what() << "\n";
+                }
+            }
+        }
+
+        // Writing buffered spans every generation keeps the trace buffers from
+        // growing with the run; pool threads reuse rows rather than add them
+        if (!trace_path.empty()) trace_flush();
+    }
+
+    if (!trace_path.empty()) trace_stop();
+
+    if (telemetry) {
+        try {
+            telemetry->close();
+        } catch (const std::exception& e) {
+            std::cerr << "Warning: failed to write telemetry: " << e.what() << "\n";
         }
     }
 
     // Final summary
     std::cerr << "\nEvolution complete.\n"
-              << "  Generations: " << sim.generations << "\n"
-              << "  Prey all-time best fitness: " << prey_all_time_best
-              << " (gen " << prey_all_time_best_gen << ")\n";
+              << "  Generations: " << sim.generations << "\n";
+    if (adaptive_length && ticks_budget > 0.0) {
+        std::cerr << "  Ticks simulated: " << std::lround(ticks_run) << " of "
+                  << std::lround(ticks_budget) << " budgeted ("
+                  << std::lround(100.0 * ticks_run / ticks_budget) << "%)\n";
+    }
+    if (racing.enabled) {
+        // Against giving every genome every round
+        int per_world = sim.neat.population_size + (coevolution ? predator_neat_params.population_size : 0);
+        double full = static_cast<double>(sim.generations - start_gen) * island_count *
+                      std::max(1, racing.rounds) * sim.episodes * per_world;
+        long long cost = 0;
+        for (const auto& island : islands) cost += island.race_cost;
+        if (full > 0.0) {
+            std::cerr << "  Racing: " << cost << " boid-episodes of " << std::llround(full)
+                      << " for full evaluation (" << std::lround(100.0 * cost / full) << "%)\n";
+        }
+    }
+    for (const auto& island : islands) {
+        std::cerr << "  " << island.label << "Prey all-time best fitness: " << island.prey_all_time_best
+                  << " (gen " << island.prey_all_time_best_gen << ")\n";
 
-    if (coevolution) {
-        std::cerr << "  Predator all-time best fitness: " << pred_all_time_best
-                  << " (gen " << pred_all_time_best_gen << ")\n"
-                  << "  Final prey species: " << prey_pop.species_count() << "\n"
-                  << "  Final predator species: " << predator_pop->species_count() << "\n";
-    } else {
-        std::string prefix = coevolution ? "champion_prey_gen" : "champion_gen";
-        std::cerr << "  Best champion file: " << output_dir << "/" << prefix
-                  << prey_all_time_best_gen << ".json\n"
-                  << "  Final gen species: " << prey_pop.species_count() << "\n";
+        if (coevolution) {
+            std::cerr << "  " << island.label << "Predator all-time best fitness: "
+                      << island.pred_all_time_best
+                      << " (gen " << island.pred_all_time_best_gen << ")\n"
+                      << "  " << island.label << "Final prey species: "
+                      << island.prey->species_count() << "\n"
+                      << "  " << island.label << "Final predator species: "
+                      << island.predator->species_count() << "\n";
+        } else {
+            std::cerr << "  " << island.label << "Best champion file: " << island.output_dir
+                      << "/champion_gen" << island.prey_all_time_best_gen << ".json\n"
+                      << "  " << island.label << "Final gen species: "
+                      << island.prey->species_count() << "\n";
+        }
     }
 
     return 0;
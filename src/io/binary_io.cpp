@@ -0,0 +1,89 @@
+#include "io/binary_io.h"
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+constexpr size_t STREAM_BUFFER = 1 << 20;
+}
+
+BinaryWriter::BinaryWriter(const std::string& path, const char (&magic)[5], uint32_t version)
+    : buffer_(STREAM_BUFFER), path_(path) {
+    out_.rdbuf()->pubsetbuf(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    out_.open(path, std::ios::binary | std::ios::trunc);
+    if (!out_.is_open()) {
+        throw std::runtime_error("Could not open file for writing: " + path);
+    }
+    write_bytes(magic, 4);
+    write(version);
+}
+
+BinaryWriter::BinaryWriter(const std::string& path, Append)
+    : buffer_(STREAM_BUFFER), path_(path) {
+    out_.rdbuf()->pubsetbuf(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    out_.open(path, std::ios::binary | std::ios::app);
+    if (!out_.is_open()) {
+        throw std::runtime_error("Could not open file for appending: " + path);
+    }
+}
+
+void BinaryWriter::write_string(const std::string& s) {
+    write<uint64_t>(s.size());
+    write_bytes(s.data(), s.size());
+}
+
+void BinaryWriter::flush() {
+    out_.flush();
+}
+
+void BinaryWriter::finish() {
+    out_.flush();
+    if (!out_) throw std::runtime_error("Failed writing binary file: " + path_);
+    out_.close();
+}
+
+void BinaryWriter::write_bytes(const void* data, size_t size) {
+    out_.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+}
+
+BinaryReader::BinaryReader(const std::string& path, const char (&magic)[5])
+    : buffer_(STREAM_BUFFER), path_(path) {
+    in_.rdbuf()->pubsetbuf(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    in_.open(path, std::ios::binary);
+    if (!in_.is_open()) {
+        throw std::runtime_error("Could not open binary file: " + path);
+    }
+    in_.seekg(0, std::ios::end);
+    size_ = static_cast<uint64_t>(in_.tellg());
+    remaining_ = size_;
+    in_.seekg(0, std::ios::beg);
+
+    char tag[4];
+    read_bytes(tag, 4);
+    if (std::memcmp(tag, magic, 4) != 0) {
+        throw std::runtime_error("Not a " + std::string(magic, 4) + " file: " + path);
+    }
+    version_ = read<uint32_t>();
+}
+
+std::string BinaryReader::read_string() {
+    std::string s(read_count(), '\0');
+    read_bytes(s.data(), s.size());
+    return s;
+}
+
+size_t BinaryReader::read_count(size_t min_element_size) {
+    uint64_t count = read<uint64_t>();
+    if (min_element_size > 0 && count > remaining_ / min_element_size) {
+        throw std::runtime_error("Corrupt binary file (bad element count): " + path_);
+    }
+    return static_cast<size_t>(count);
+}
+
+void BinaryReader::read_bytes(void* data, size_t size) {
+    if (size > remaining_) {
+        throw std::runtime_error("Unexpected end of binary file: " + path_);
+    }
+    in_.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+    if (!in_) throw std::runtime_error("Failed reading binary file: " + path_);
+    remaining_ -= size;
+}
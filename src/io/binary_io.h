@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Buffered binary file streams for checkpoints and compact spec files.
+//
+// Values are written raw in host byte order, so files are meant to be read
+// back on the same kind of machine. Every file starts with a four-byte magic
+// tag and a format version. Readers throw std::runtime_error on a short read,
+// so a truncated file never yields half-filled state.
+class BinaryWriter {
+public:
+    // Opens (truncating) `path` and writes the magic tag and version.
+    // Throws if the file can't be opened.
+    BinaryWriter(const std::string& path, const char (&magic)[5], uint32_t version);
+
+    // Opens an existing file to write after its last byte, without a header.
+    // The caller checks the existing header first (e.g. with BinaryReader).
+    // Throws if the file can't be opened.
+    struct Append {};
+    BinaryWriter(const std::string& path, Append);
+
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        write_bytes(&value, sizeof(T));
+    }
+
+    // Element count, then the elements
+    template <typename T>
+    void write_vector(const std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        write<uint64_t>(values.size());
+        write_bytes(values.data(), values.size() * sizeof(T));
+    }
+
+    void write_string(const std::string& s);
+
+    // Push buffered bytes to the file, so a reader sees every complete record
+    void flush();
+
+    // Flush and close. Throws if anything failed to reach the file.
+    void finish();
+
+private:
+    // Declared before the stream so it outlives the stream's final flush
+    std::vector<char> buffer_;
+    std::ofstream out_;
+    std::string path_;
+
+    void write_bytes(const void* data, size_t size);
+};
+
+class BinaryReader {
+public:
+    // Opens `path` and checks its magic tag. Throws if the file can't be
+    // opened or isn't of this kind.
+    BinaryReader(const std::string& path, const char (&magic)[5]);
+
+    // Format version from the header
+    uint32_t version() const { return version_; }
+
+    // Bytes not yet read, and bytes read so far (the header included)
+    uint64_t remaining() const { return remaining_; }
+    uint64_t offset() const { return size_ - remaining_; }
+
+    template <typename T>
+    T read() {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T value;
+        read_bytes(&value, sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    std::vector<T> read_vector() {
+        static_assert(std::is_trivially_copyable_v<T>);
+        std::vector<T> values(read_count(sizeof(T)));
+        read_bytes(values.data(), values.size() * sizeof(T));
+        return values;
+    }
+
+    std::string read_string();
+
+    // An element count, checked against the bytes left in the file so a
+    // corrupt count can't trigger a huge allocation
+    size_t read_count(size_t min_element_size = 1);
+
+private:
+    std::vector<char> buffer_;  // must outlive in_, see BinaryWriter
+    std::ifstream in_;
+    std::string path_;
+    uint64_t size_ = 0;
+    uint64_t remaining_ = 0;
+    uint32_t version_ = 0;
+
+    void read_bytes(void* data, size_t size);
+};
@@ -1,7 +1,9 @@
 #include "io/boid_spec.h"
 #include "brain/neat_genome.h"
-#include "brain/neat_network.h"
+#include "brain/compiled_network.h"
+#include "io/genome_io.h"
 #include <nlohmann/json.hpp>
+#include <cstring>
 #include <fstream>
 #include <stdexcept>
 
@@ -100,7 +102,159 @@ int sensor_input_count(const BoidSpec& spec) {
     return static_cast<int>(spec.sensors.size());
 }
 
+// Binary spec files: "WBSP" header, then the spec's fields in declaration order
+static constexpr char BINARY_SPEC_MAGIC[5] = "WBSP";
+static constexpr uint32_t BINARY_SPEC_VERSION = 1;
+
+static void write_eyes(BinaryWriter& out, const std::vector<EyeSpec>& eyes) {
+    out.write<uint64_t>(eyes.size());
+    for (const auto& eye : eyes) {
+        out.write<int32_t>(eye.id);
+        out.write<float>(eye.center_angle);
+        out.write<float>(eye.arc_width);
+        out.write<float>(eye.max_range);
+    }
+}
+
+static std::vector<EyeSpec> read_eyes(BinaryReader& in) {
+    std::vector<EyeSpec> eyes(in.read_count(16));
+    for (auto& eye : eyes) {
+        eye.id = in.read<int32_t>();
+        eye.center_angle = in.read<float>();
+        eye.arc_width = in.read<float>();
+        eye.max_range = in.read<float>();
+    }
+    return eyes;
+}
+
+// Enum stored as a byte, range-checked on the way back in
+template <typename E>
+static E read_enum(BinaryReader& in, E last) {
+    uint8_t v = in.read<uint8_t>();
+    if (v > static_cast<uint8_t>(last)) {
+        throw std::runtime_error("Corrupt binary boid spec: bad enum value");
+    }
+    return static_cast<E>(v);
+}
+
+static BoidSpec load_boid_spec_binary(const std::string& path) {
+    BinaryReader in(path, BINARY_SPEC_MAGIC);
+    if (in.version() != BINARY_SPEC_VERSION) {
+        throw std::runtime_error("Unsupported binary boid spec version " +
+                                 std::to_string(in.version()) + ": " + path);
+    }
+
+    BoidSpec spec;
+    spec.version = in.read_string();
+    spec.type = in.read_string();
+    spec.mass = in.read<float>();
+    spec.moment_of_inertia = in.read<float>();
+    spec.initial_energy = in.read<float>();
+    if (in.read<uint8_t>()) spec.metabolism_rate = in.read<float>();
+
+    spec.thrusters.resize(in.read_count(32));
+    for (auto& ts : spec.thrusters) {
+        ts.id = in.read<int32_t>();
+        ts.label = in.read_string();
+        ts.position = {in.read<float>(), in.read<float>()};
+        ts.direction = {in.read<float>(), in.read<float>()};
+        ts.max_thrust = in.read<float>();
+    }
+
+    spec.sensors.resize(in.read_count(18));
+    for (auto& ss : spec.sensors) {
+        ss.id = in.read<int32_t>();
+        ss.center_angle = in.read<float>();
+        ss.arc_width = in.read<float>();
+        ss.max_range = in.read<float>();
+        ss.filter = read_enum(in, EntityFilter::Noise);
+        ss.signal_type = read_enum(in, SignalType::SectorDensity);
+    }
+
+    if (in.read<uint8_t>()) {
+        CompoundEyeConfig cfg;
+        cfg.eyes = read_eyes(in);
+        cfg.long_range_eyes = read_eyes(in);
+        cfg.channels.resize(in.read_count());
+        for (auto& ch : cfg.channels) ch = read_enum(in, SensorChannel::Opposite);
+        cfg.has_speed_sensor = in.read<uint8_t>() != 0;
+        cfg.has_angular_velocity_sensor = in.read<uint8_t>() != 0;
+        cfg.has_noise_sensor = in.read<uint8_t>() != 0;
+        cfg.has_shoaling_sensor = in.read<uint8_t>() != 0;
+        cfg.has_hunger_sensor = in.read<uint8_t>() != 0;
+        spec.compound_eyes = std::move(cfg);
+    }
+
+    if (in.read<uint8_t>()) spec.genome = read_genome(in);
+    if (in.read<uint8_t>()) spec.morphology_genome = read_morphology(in);
+    return spec;
+}
+
+void save_boid_spec_binary(const BoidSpec& spec, const std::string& path) {
+    BinaryWriter out(path, BINARY_SPEC_MAGIC, BINARY_SPEC_VERSION);
+    out.write_string(spec.version);
+    out.write_string(spec.type);
+    out.write<float>(spec.mass);
+    out.write<float>(spec.moment_of_inertia);
+    out.write<float>(spec.initial_energy);
+    out.write<uint8_t>(spec.metabolism_rate.has_value());
+    if (spec.metabolism_rate.has_value()) out.write<float>(*spec.metabolism_rate);
+
+    out.write<uint64_t>(spec.thrusters.size());
+    for (const auto& ts : spec.thrusters) {
+        out.write<int32_t>(ts.id);
+        out.write_string(ts.label);
+        out.write<float>(ts.position.x);
+        out.write<float>(ts.position.y);
+        out.write<float>(ts.direction.x);
+        out.write<float>(ts.direction.y);
+        out.write<float>(ts.max_thrust);
+    }
+
+    // The JSON form only keeps legacy sensors when there are no compound eyes
+    static const std::vector<SensorSpec> no_sensors;
+    const auto& sensors = spec.compound_eyes.has_value() ? no_sensors : spec.sensors;
+    out.write<uint64_t>(sensors.size());
+    for (const auto& ss : sensors) {
+        out.write<int32_t>(ss.id);
+        out.write<float>(ss.center_angle);
+        out.write<float>(ss.arc_width);
+        out.write<float>(ss.max_range);
+        out.write<uint8_t>(static_cast<uint8_t>(ss.filter));
+        out.write<uint8_t>(static_cast<uint8_t>(ss.signal_type));
+    }
+
+    out.write<uint8_t>(spec.compound_eyes.has_value());
+    if (spec.compound_eyes.has_value()) {
+        const auto& cfg = *spec.compound_eyes;
+        write_eyes(out, cfg.eyes);
+        write_eyes(out, cfg.long_range_eyes);
+        out.write<uint64_t>(cfg.channels.size());
+        for (auto ch : cfg.channels) out.write<uint8_t>(static_cast<uint8_t>(ch));
+        out.write<uint8_t>(cfg.has_speed_sensor);
+        out.write<uint8_t>(cfg.has_angular_velocity_sensor);
+        out.write<uint8_t>(cfg.has_noise_sensor);
+        out.write<uint8_t>(cfg.has_shoaling_sensor);
+        out.write<uint8_t>(cfg.has_hunger_sensor);
+    }
+
+    out.write<uint8_t>(spec.genome.has_value());
+    if (spec.genome.has_value()) write_genome(out, *spec.genome);
+    out.write<uint8_t>(spec.morphology_genome.has_value());
+    if (spec.morphology_genome.has_value()) write_morphology(out, *spec.morphology_genome);
+    out.finish();
+}
+
+bool is_binary_boid_spec(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    char tag[4] = {};
+    file.read(tag, 4);
+    return file && std::memcmp(tag, BINARY_SPEC_MAGIC, 4) == 0;
+}
+
 BoidSpec load_boid_spec(const std::string& path) {
+    if (is_binary_boid_spec(path)) return load_boid_spec_binary(path);
+
     std::ifstream file(path);
     if (!file.is_open()) {
         throw std::runtime_error("Could not open boid spec file: " + path);
@@ -189,7 +343,7 @@ BoidSpec load_boid_spec(const std::string& path) {
             ng.type = parse_node_type(jn.at("type").get<std::string>());
             ng.activation = parse_activation_fn(jn.value("activation", "sigmoid"));
             ng.bias = jn.value("bias", 0.0f);
-            genome.nodes.push_back(ng);
+            genome.add_node(ng);
         }
 
         for (const auto& jc : jg.at("connections")) {
@@ -200,7 +354,7 @@ BoidSpec load_boid_spec(const std::string& path) {
             cg.weight = jc.at("weight").get<float>();
             cg.enabled = jc.value("enabled", true);
             cg.recurrent = jc.value("recurrent", false);
-            genome.connections.push_back(cg);
+            genome.add_connection(cg);
         }
 
         spec.genome = std::move(genome);
@@ -256,7 +410,7 @@ Boid create_boid_from_spec(const BoidSpec& spec) {
     }
 
     if (spec.genome.has_value()) {
-        boid.brain = std::make_unique<NeatNetwork>(*spec.genome);
+        boid.brain = std::make_unique<CompiledNetwork>(*spec.genome);
     }
 
     return boid;
@@ -338,7 +492,7 @@ void save_boid_spec(const BoidSpec& spec, const std::string& path) {
     if (spec.genome.has_value()) {
         json jg;
         jg["nodes"] = json::array();
-        for (const auto& ng : spec.genome->nodes) {
+        for (const auto& ng : spec.genome->nodes()) {
             json jn;
             jn["id"] = ng.id;
             jn["type"] = node_type_to_string(ng.type);
@@ -348,7 +502,7 @@ void save_boid_spec(const BoidSpec& spec, const std::string& path) {
         }
 
         jg["connections"] = json::array();
-        for (const auto& cg : spec.genome->connections) {
+        for (const auto& cg : spec.genome->connections()) {
             json jc;
             jc["innovation"] = cg.innovation;
             jc["source"] = cg.source;
@@ -34,7 +34,8 @@ struct BoidSpec {
 // Returns total NEAT input count from whichever sensor format is present.
 int sensor_input_count(const BoidSpec& spec);
 
-// Load a boid spec from a JSON file. Throws on parse/validation error.
+// Load a boid spec from a JSON file, or from a binary spec file (recognised
+// by its header). Throws on parse/validation error.
 BoidSpec load_boid_spec(const std::string& path);
 
 // Create a Boid from a spec (positioned at origin, zero velocity).
@@ -42,3 +43,11 @@ Boid create_boid_from_spec(const BoidSpec& spec);
 
 // Save a boid spec to a JSON file.
 void save_boid_spec(const BoidSpec& spec, const std::string& path);
+
+// Save a boid spec in the compact binary format: the same fields as the JSON
+// form, stored as raw values so loading needs no parsing. A spec converted
+// from JSON loads to exactly the values the JSON file does.
+void save_boid_spec_binary(const BoidSpec& spec, const std::string& path);
+
+// True if `path` starts with the binary spec header.
+bool is_binary_boid_spec(const std::string& path);
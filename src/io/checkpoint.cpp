@@ -0,0 +1,123 @@
+#include "io/checkpoint.h"
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+void corrupt(const std::string& what) {
+    throw std::runtime_error("Corrupt checkpoint: " + what);
+}
+
+} // namespace
+
+void write_rng(BinaryWriter& out, const std::mt19937& rng) {
+    std::ostringstream ss;
+    ss << rng;
+    out.write_string(ss.str());
+}
+
+void read_rng(BinaryReader& in, std::mt19937& rng) {
+    std::istringstream ss(in.read_string());
+    ss >> rng;
+    if (!ss) corrupt("bad RNG state");
+}
+
+void write_population(BinaryWriter& out, const Population& population) {
+    out.write<int32_t>(population.generation_);
+    out.write<int32_t>(population.next_species_id_);
+
+    const auto& created = population.tracker_.created();
+    out.write<int32_t>(population.tracker_.next_innovation());
+    out.write<uint64_t>(created.size());
+    for (const auto& [source, target] : created) {
+        out.write<int32_t>(source);
+        out.write<int32_t>(target);
+    }
+
+    out.write<uint64_t>(population.genomes_.size());
+    for (const auto& g : population.genomes_) write_genome(out, g);
+    out.write_vector(population.fitness_);
+
+    out.write<uint64_t>(population.species_.size());
+    for (const auto& s : population.species_) {
+        out.write<int32_t>(s.id);
+        out.write_vector(s.representative.innovations);
+        out.write_vector(s.representative.weights);
+        out.write<int32_t>(s.representative.gene_count);
+        out.write_vector(s.members);
+        out.write<float>(s.best_fitness);
+        out.write<int32_t>(s.stagnation_count);
+    }
+
+    out.write<uint8_t>(population.has_morphology());
+    if (population.has_morphology()) {
+        for (const auto& m : population.morphologies_) write_morphology(out, m);
+    }
+}
+
+void read_population(BinaryReader& in, Population& population) {
+    int generation = in.read<int32_t>();
+    int next_species_id = in.read<int32_t>();
+
+    // Replay this generation's new pairs so they keep their numbers
+    int next_innovation = in.read<int32_t>();
+    size_t created = in.read_count(8);
+    const int classes = population.tracker_.classes();
+    if (created > static_cast<size_t>(next_innovation / classes)) corrupt("bad innovation state");
+    InnovationTracker tracker(next_innovation - static_cast<int>(created) * classes, classes,
+                              population.tracker_.class_index());
+    for (size_t k = 0; k < created; ++k) {
+        int source = in.read<int32_t>();
+        int target = in.read<int32_t>();
+        tracker.get_or_create(source, target);
+    }
+    if (tracker.next_innovation() != next_innovation) corrupt("duplicate innovation pairs");
+
+    size_t size = in.read_count(16);
+    if (static_cast<int>(size) != population.params_.population_size) {
+        throw std::runtime_error("Checkpoint population size " + std::to_string(size) +
+                                 " does not match the configured " +
+                                 std::to_string(population.params_.population_size));
+    }
+    std::vector<NeatGenome> genomes(size);
+    for (auto& g : genomes) g = read_genome(in);
+    std::vector<float> fitness = in.read_vector<float>();
+    if (fitness.size() != size) corrupt("fitness count mismatch");
+
+    std::vector<Species> species(in.read_count(4 + 24 + 4 + 8 + 4 + 4));
+    for (auto& s : species) {
+        s.id = in.read<int32_t>();
+        s.representative.innovations = in.read_vector<int>();
+        s.representative.weights = in.read_vector<float>();
+        s.representative.gene_count = in.read<int32_t>();
+        s.members = in.read_vector<int>();
+        s.best_fitness = in.read<float>();
+        s.stagnation_count = in.read<int32_t>();
+        for (int idx : s.members) {
+            if (idx < 0 || idx >= static_cast<int>(size)) corrupt("bad species member");
+        }
+    }
+
+    bool has_morphology = in.read<uint8_t>() != 0;
+    if (has_morphology != population.has_morphology()) {
+        throw std::runtime_error(has_morphology
+            ? "Checkpoint has morphologies but morphology evolution is off"
+            : "Checkpoint has no morphologies but morphology evolution is on");
+    }
+    std::vector<MorphologyGenome> morphologies;
+    if (has_morphology) {
+        morphologies.resize(size);
+        for (auto& m : morphologies) m = read_morphology(in);
+    }
+
+    // Only commit once the whole record has been read
+    population.generation_ = generation;
+    population.next_species_id_ = next_species_id;
+    population.tracker_ = std::move(tracker);
+    population.genomes_ = std::move(genomes);
+    population.spare_genomes_.clear();
+    population.fitness_ = std::move(fitness);
+    population.species_ = std::move(species);
+    population.morphologies_ = std::move(morphologies);
+    population.spare_morphologies_.clear();
+}
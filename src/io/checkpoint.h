@@ -0,0 +1,24 @@
+#pragma once
+
+#include "io/binary_io.h"
+#include "io/genome_io.h"
+#include "brain/population.h"
+#include <random>
+
+// Binary encoding of evolution state, used by the headless runner's
+// checkpoints. Each read_* throws std::runtime_error on a short or
+// malformed record.
+
+// Engine state in the standard's textual form, so it survives any library.
+void write_rng(BinaryWriter& out, const std::mt19937& rng);
+void read_rng(BinaryReader& in, std::mt19937& rng);
+
+// Everything a Population needs to carry on exactly where it stopped:
+// genomes, fitness, species (with representatives and stagnation counters),
+// innovation numbering and morphologies. The RNG is owned by the caller and
+// saved separately.
+void write_population(BinaryWriter& out, const Population& population);
+
+// Overwrite `population` with saved state. It must have been built with the
+// same population size and the same morphology setting; throws otherwise.
+void read_population(BinaryReader& in, Population& population);
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+// Locate `filename` in the project's data/ directory for tests and tools run
+// from the project root or a build directory below it. Falls back to
+// $WILDBOIDS_DATA_DIR, then to a path relative to the working directory.
+inline std::string data_path(const std::string& filename) {
+    for (const auto& prefix : {"data/", "../data/", "../../data/"}) {
+        std::string path = std::string(prefix) + filename;
+        if (std::filesystem::exists(path)) return path;
+    }
+    const char* env = std::getenv("WILDBOIDS_DATA_DIR");
+    if (env) return std::string(env) + "/" + filename;
+    return "data/" + filename;
+}
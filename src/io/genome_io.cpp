@@ -0,0 +1,87 @@
+#include "io/genome_io.h"
+#include <stdexcept>
+
+namespace {
+
+void corrupt(const std::string& what) {
+    throw std::runtime_error("Corrupt genome record: " + what);
+}
+
+NodeType node_type_from(uint8_t v) {
+    if (v > static_cast<uint8_t>(NodeType::Hidden)) corrupt("bad node type");
+    return static_cast<NodeType>(v);
+}
+
+ActivationFn activation_from(uint8_t v) {
+    if (v > static_cast<uint8_t>(ActivationFn::Linear)) corrupt("bad activation");
+    return static_cast<ActivationFn>(v);
+}
+
+// Smallest encoded sizes, for sanity-checking element counts
+constexpr size_t NODE_BYTES = 4 + 1 + 1 + 4;
+constexpr size_t CONNECTION_BYTES = 4 * 3 + 4 + 1 + 1;
+
+} // namespace
+
+void write_genome(BinaryWriter& out, const NeatGenome& genome) {
+    out.write<uint64_t>(genome.nodes().size());
+    for (const auto& n : genome.nodes()) {
+        out.write<int32_t>(n.id);
+        out.write<uint8_t>(static_cast<uint8_t>(n.type));
+        out.write<uint8_t>(static_cast<uint8_t>(n.activation));
+        out.write<float>(n.bias);
+    }
+    out.write<uint64_t>(genome.connections().size());
+    for (const auto& c : genome.connections()) {
+        out.write<int32_t>(c.innovation);
+        out.write<int32_t>(c.source);
+        out.write<int32_t>(c.target);
+        out.write<float>(c.weight);
+        out.write<uint8_t>(c.enabled);
+        out.write<uint8_t>(c.recurrent);
+    }
+}
+
+NeatGenome read_genome(BinaryReader& in) {
+    NeatGenome genome;
+    size_t n_nodes = in.read_count(NODE_BYTES);
+    for (size_t i = 0; i < n_nodes; ++i) {
+        NodeGene n;
+        n.id = in.read<int32_t>();
+        n.type = node_type_from(in.read<uint8_t>());
+        n.activation = activation_from(in.read<uint8_t>());
+        n.bias = in.read<float>();
+        genome.add_node(n);
+    }
+    size_t n_connections = in.read_count(CONNECTION_BYTES);
+    for (size_t i = 0; i < n_connections; ++i) {
+        ConnectionGene c;
+        c.innovation = in.read<int32_t>();
+        c.source = in.read<int32_t>();
+        c.target = in.read<int32_t>();
+        c.weight = in.read<float>();
+        c.enabled = in.read<uint8_t>() != 0;
+        c.recurrent = in.read<uint8_t>() != 0;
+        genome.add_connection(c);
+    }
+    return genome;
+}
+
+void write_morphology(BinaryWriter& out, const MorphologyGenome& morphology) {
+    out.write<uint64_t>(morphology.groups.size());
+    for (const auto& g : morphology.groups) {
+        out.write_vector(g.angles);
+        out.write_vector(g.arc_fracs);
+    }
+}
+
+MorphologyGenome read_morphology(BinaryReader& in) {
+    MorphologyGenome morphology;
+    morphology.groups.resize(in.read_count(16));
+    for (auto& g : morphology.groups) {
+        g.angles = in.read_vector<float>();
+        g.arc_fracs = in.read_vector<float>();
+        if (g.angles.size() != g.arc_fracs.size()) corrupt("morphology group size mismatch");
+    }
+    return morphology;
+}
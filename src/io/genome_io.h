@@ -0,0 +1,15 @@
+#pragma once
+
+#include "io/binary_io.h"
+#include "brain/neat_genome.h"
+#include "simulation/morphology_genome.h"
+
+// Field-by-field binary encoding of genomes, shared by checkpoints and
+// binary boid specs. Each read_* throws std::runtime_error on a short or
+// malformed record.
+
+void write_genome(BinaryWriter& out, const NeatGenome& genome);
+NeatGenome read_genome(BinaryReader& in);
+
+void write_morphology(BinaryWriter& out, const MorphologyGenome& morphology);
+MorphologyGenome read_morphology(BinaryReader& in);
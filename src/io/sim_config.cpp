@@ -5,6 +5,27 @@
 
 using json = nlohmann::json;
 
+MigrationTopology parse_migration_topology(const std::string& name) {
+    if (name == "ring") return MigrationTopology::Ring;
+    if (name == "full") return MigrationTopology::Full;
+    throw std::invalid_argument("Unknown migration topology: " + name + " (expected ring or full)");
+}
+
+bool parse_eye_kernel(const std::string& name) {
+    if (name == "exact") return false;
+    if (name == "fast") return true;
+    throw std::invalid_argument("Unknown eye kernel: " + name + " (expected exact or fast)");
+}
+
+int ticks_for_generation(const SimConfig& cfg, int generation) {
+    const auto& e = cfg.episode_length;
+    int full = cfg.ticks_per_generation;
+    if (e.start_ticks <= 0 || e.start_ticks >= full) return full;
+    if (e.ramp_generations <= 0 || generation >= e.ramp_generations) return full;
+    long long span = full - e.start_ticks;
+    return e.start_ticks + static_cast<int>(span * generation / e.ramp_generations);
+}
+
 SimConfig load_sim_config(const std::string& path) {
     std::ifstream file(path);
     if (!file.is_open()) {
@@ -25,6 +46,7 @@ SimConfig load_sim_config(const std::string& path) {
         cfg.world.grid_cell_size = w.value("gridCellSize", cfg.world.grid_cell_size);
         cfg.world.max_speed = w.value("maxSpeed", cfg.world.max_speed);
         cfg.world.max_angular_speed = w.value("maxAngularSpeed", cfg.world.max_angular_speed);
+        cfg.world.threads = w.value("threads", cfg.world.threads);
     }
 
     // Food
@@ -81,6 +103,8 @@ SimConfig load_sim_config(const std::string& path) {
                 else if (name == "opposite") cfg.world.enabled_channels.push_back(SensorChannel::Opposite);
             }
         }
+        if (s.contains("eyeKernel"))
+            cfg.world.fast_eye_kernel = parse_eye_kernel(s["eyeKernel"].get<std::string>());
     }
 
     // Shoaling
@@ -104,6 +128,13 @@ SimConfig load_sim_config(const std::string& path) {
         cfg.world.thrust_cost = e.value("thrustCost", cfg.world.thrust_cost);
     }
 
+    // Brain evaluation
+    if (j.contains("brain")) {
+        const auto& b = j["brain"];
+        if (b.contains("activation"))
+            cfg.world.brain_activation = parse_activation_precision(b["activation"].get<std::string>());
+    }
+
     // Evolution run parameters
     if (j.contains("evolution")) {
         const auto& ev = j["evolution"];
@@ -111,6 +142,37 @@ SimConfig load_sim_config(const std::string& path) {
         cfg.ticks_per_generation = ev.value("ticksPerGeneration", cfg.ticks_per_generation);
         cfg.generations = ev.value("generations", cfg.generations);
         cfg.save_interval = ev.value("saveInterval", cfg.save_interval);
+        cfg.episodes = ev.value("episodes", cfg.episodes);
+        if (cfg.episodes < 1) {
+            throw std::invalid_argument("evolution.episodes must be at least 1, got " +
+                                        std::to_string(cfg.episodes));
+        }
+        if (ev.contains("islands")) {
+            const auto& is = ev["islands"];
+            cfg.islands.count = is.value("count", cfg.islands.count);
+            cfg.islands.migration_interval = is.value("migrationInterval", cfg.islands.migration_interval);
+            cfg.islands.migrants = is.value("migrants", cfg.islands.migrants);
+            if (is.contains("topology"))
+                cfg.islands.topology = parse_migration_topology(is["topology"].get<std::string>());
+        }
+        if (ev.contains("episodeLength")) {
+            const auto& el = ev["episodeLength"];
+            auto& e = cfg.episode_length;
+            e.start_ticks = el.value("startTicks", e.start_ticks);
+            e.ramp_generations = el.value("rampGenerations", e.ramp_generations);
+            e.early_stop = el.value("earlyStop", e.early_stop);
+            e.check_interval = el.value("checkInterval", e.check_interval);
+            e.min_ticks = el.value("minTicks", e.min_ticks);
+            e.rank_correlation = el.value("rankCorrelation", e.rank_correlation);
+            e.patience = el.value("patience", e.patience);
+        }
+        if (ev.contains("racing")) {
+            const auto& rc = ev["racing"];
+            auto& r = cfg.racing;
+            r.enabled = rc.value("enabled", r.enabled);
+            r.rounds = rc.value("rounds", r.rounds);
+            r.keep_fraction = rc.value("keepFraction", r.keep_fraction);
+        }
         std::string fm = ev.value("fitnessMode", std::string("gross"));
         if (fm == "net") cfg.fitness_mode = FitnessMode::Net;
         else cfg.fitness_mode = FitnessMode::Gross;
@@ -157,6 +219,7 @@ SimConfig load_sim_config(const std::string& path) {
         cfg.neat.elitism = n.value("elitism", cfg.neat.elitism);
         cfg.neat.max_stagnation = n.value("maxStagnation", cfg.neat.max_stagnation);
         cfg.neat.allow_recurrent = n.value("recurrent", cfg.neat.allow_recurrent);
+        cfg.neat.threads = n.value("threads", cfg.neat.threads);
     }
 
     return cfg;
@@ -3,6 +3,7 @@
 #include "simulation/world.h"
 #include "simulation/morphology_genome.h"
 #include "brain/population.h"
+#include "brain/island_migration.h"
 #include <string>
 
 enum class FitnessMode {
@@ -10,6 +11,34 @@ enum class FitnessMode {
     Net     // total_energy_gained - total_energy_spent (rewards efficiency)
 };
 
+// Adaptive evaluation length (headless runner). Both parts are off by default.
+struct EpisodeLengthConfig {
+    // Tick budget ramps linearly from start_ticks at generation 0 up to
+    // ticks_per_generation at ramp_generations, then stays there.
+    int start_ticks = 0;          // 0 = always ticks_per_generation
+    int ramp_generations = 0;
+
+    // End an episode once every population's fitness ranking has settled:
+    // checked every check_interval ticks after min_ticks, stop after
+    // `patience` checks in a row with rank correlation >= rank_correlation.
+    bool early_stop = false;
+    int check_interval = 300;
+    int min_ticks = 600;
+    float rank_correlation = 0.99f;
+    int patience = 3;
+};
+
+// Successive-halving evaluation (headless runner). Every genome gets one
+// round of `episodes` worlds; each later round re-scores only the best
+// keep_fraction of the previous round's contenders. Later worlds keep full
+// population sizes by filling every slot with copies of the contenders, so
+// fewer of them are needed.
+struct RacingConfig {
+    bool enabled = false;
+    int rounds = 3;             // including the first, full round
+    float keep_fraction = 0.5f;
+};
+
 struct SimConfig {
     WorldConfig world;
     PopulationParams neat;
@@ -19,10 +48,24 @@ struct SimConfig {
     int generations = 100;
     int save_interval = 10;
     FitnessMode fitness_mode = FitnessMode::Gross;
+    int episodes = 1;  // independently seeded worlds per generation; fitness is averaged
+    IslandConfig islands;
+    EpisodeLengthConfig episode_length;
+    RacingConfig racing;
 
     // Morphology evolution (eye position/arc evolution)
     MorphologyEvolutionConfig morphology;
 };
 
+// "ring" or "full". Throws std::invalid_argument for anything else.
+MigrationTopology parse_migration_topology(const std::string& name);
+
+// sensors.eyeKernel: "exact" (false) or "fast" (true, the trig-free kernel).
+// Throws std::invalid_argument for anything else.
+bool parse_eye_kernel(const std::string& name);
+
+// Tick budget for one generation under the episode-length schedule.
+int ticks_for_generation(const SimConfig& cfg, int generation);
+
 // Load simulation config from a JSON file. Throws on parse/validation error.
 SimConfig load_sim_config(const std::string& path);
@@ -0,0 +1,327 @@
+#include "io/telemetry.h"
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace {
+
+constexpr char TELEMETRY_MAGIC[5] = "WBTL";
+constexpr uint32_t TELEMETRY_VERSION = 1;
+
+enum TableId : uint32_t { GENERATIONS = 0, INDIVIDUALS = 1 };
+constexpr const char* TABLE_NAMES[] = {"generations", "individuals"};
+
+// Each table's columns, in file order. fn(name, member) is called per column,
+// so the schema and the chunk writer can't drift apart.
+template <typename Fn>
+void generation_columns(Fn&& fn) {
+    fn("island", &GenerationTelemetry::island);
+    fn("generation", &GenerationTelemetry::generation);
+    fn("population", &GenerationTelemetry::population);
+    fn("best_fitness", &GenerationTelemetry::best_fitness);
+    fn("mean_fitness", &GenerationTelemetry::mean_fitness);
+    fn("species_count", &GenerationTelemetry::species_count);
+    fn("survivors", &GenerationTelemetry::survivors);
+    fn("ticks", &GenerationTelemetry::ticks);
+    fn("mean_nodes", &GenerationTelemetry::mean_nodes);
+    fn("mean_connections", &GenerationTelemetry::mean_connections);
+}
+
+template <typename Fn>
+void individual_columns(Fn&& fn) {
+    fn("island", &IndividualTelemetry::island);
+    fn("generation", &IndividualTelemetry::generation);
+    fn("population", &IndividualTelemetry::population);
+    fn("index", &IndividualTelemetry::index);
+    fn("species_id", &IndividualTelemetry::species_id);
+    fn("fitness", &IndividualTelemetry::fitness);
+    fn("episodes", &IndividualTelemetry::episodes);
+    fn("fitness_confidence", &IndividualTelemetry::fitness_confidence);
+    fn("energy_gained", &IndividualTelemetry::energy_gained);
+    fn("energy_spent", &IndividualTelemetry::energy_spent);
+    fn("survival_ticks", &IndividualTelemetry::survival_ticks);
+    fn("nodes", &IndividualTelemetry::nodes);
+    fn("connections", &IndividualTelemetry::connections);
+    fn("eye_angle_spread", &IndividualTelemetry::eye_angle_spread);
+    fn("eye_arc_max", &IndividualTelemetry::eye_arc_max);
+}
+
+template <typename Row, typename T>
+constexpr char column_type(T Row::*) {
+    static_assert(sizeof(T) == 4);
+    return std::is_floating_point_v<T> ? 'f' : 'i';
+}
+
+template <typename Columns>
+void write_schema(BinaryWriter& out, const char* name, Columns columns) {
+    out.write_string(name);
+    uint64_t count = 0;
+    columns([&](const char*, auto) { ++count; });
+    out.write<uint64_t>(count);
+    columns([&](const char* column, auto member) {
+        out.write_string(column);
+        out.write<char>(column_type(member));
+    });
+}
+
+template <typename Row, typename Columns>
+void write_chunk(BinaryWriter& out, TableId table, const std::vector<Row>& rows,
+                 Columns columns) {
+    if (rows.empty()) return;
+    out.write<uint32_t>(table);
+    columns([&](const char*, auto member) {
+        using T = std::remove_cv_t<std::remove_reference_t<decltype(rows[0].*member)>>;
+        std::vector<T> values;
+        values.reserve(rows.size());
+        for (const auto& row : rows) values.push_back(row.*member);
+        out.write_vector(values);
+    });
+}
+
+auto generation_table = [](auto&& fn) { generation_columns(fn); };
+auto individual_table = [](auto&& fn) { individual_columns(fn); };
+
+void write_header(BinaryWriter& out) {
+    out.write<uint32_t>(2);
+    write_schema(out, TABLE_NAMES[GENERATIONS], generation_table);
+    write_schema(out, TABLE_NAMES[INDIVIDUALS], individual_table);
+}
+
+struct Column {
+    std::string name;
+    char type;
+
+    bool operator==(const Column&) const = default;
+};
+
+struct Schema {
+    std::vector<std::string> names;
+    std::vector<std::vector<Column>> tables;
+};
+
+template <typename Columns>
+std::vector<Column> columns_of(Columns columns) {
+    std::vector<Column> out;
+    columns([&](const char* name, auto member) { out.push_back({name, column_type(member)}); });
+    return out;
+}
+
+// Check the version and read the table schemas
+Schema read_header(BinaryReader& in, const std::string& path) {
+    if (in.version() != TELEMETRY_VERSION) {
+        throw std::runtime_error("Unsupported telemetry version " +
+                                 std::to_string(in.version()) + ": " + path);
+    }
+    Schema schema;
+    uint32_t table_count = in.read<uint32_t>();
+    for (uint32_t t = 0; t < table_count; ++t) {
+        schema.names.push_back(in.read_string());
+        std::vector<Column> columns(in.read_count());
+        for (auto& c : columns) {
+            c.name = in.read_string();
+            c.type = in.read<char>();
+        }
+        schema.tables.push_back(std::move(columns));
+    }
+    return schema;
+}
+
+// Read the next chunk's table id and raw columns; returns the row count.
+// Throws if the chunk is damaged or cut short.
+size_t read_chunk(BinaryReader& in, const Schema& schema, uint32_t& id,
+                  std::vector<std::vector<uint32_t>>& data) {
+    id = in.read<uint32_t>();
+    if (id >= schema.tables.size()) throw std::runtime_error("bad table id");
+    data.clear();
+    size_t rows = 0;
+    for (size_t c = 0; c < schema.tables[id].size(); ++c) {
+        data.push_back(in.read_vector<uint32_t>());
+        if (c > 0 && data[c].size() != rows) throw std::runtime_error("ragged chunk");
+        rows = data[c].size();
+    }
+    return rows;
+}
+
+// Byte length of the part of an existing telemetry file a run resumed at
+// generation `resume_from` keeps: the header and every complete chunk before
+// the first one holding a row of generation resume_from or later.
+uint64_t resume_length(const std::string& path, int resume_from) {
+    BinaryReader in(path, TELEMETRY_MAGIC);
+    Schema schema = read_header(in, path);
+    if (schema.names != std::vector<std::string>{TABLE_NAMES[GENERATIONS], TABLE_NAMES[INDIVIDUALS]} ||
+        schema.tables[GENERATIONS] != columns_of(generation_table) ||
+        schema.tables[INDIVIDUALS] != columns_of(individual_table)) {
+        throw std::runtime_error("Telemetry file has a different schema, not appending: " + path);
+    }
+
+    // Both tables keep the generation in their second column
+    constexpr size_t GENERATION_COLUMN = 1;
+    uint64_t keep = in.offset();
+    std::vector<std::vector<uint32_t>> data;
+    while (in.remaining() > 0) {
+        uint32_t id;
+        size_t rows;
+        try {
+            rows = read_chunk(in, schema, id, data);
+        } catch (const std::exception&) {
+            break;  // damaged tail
+        }
+        bool later = false;
+        for (size_t r = 0; r < rows; ++r) {
+            int32_t gen;
+            std::memcpy(&gen, &data[GENERATION_COLUMN][r], sizeof(gen));
+            later |= gen >= resume_from;
+        }
+        if (later) break;
+        keep = in.offset();
+    }
+    return keep;
+}
+
+// Cut an existing file back to what a resumed run keeps, or create it fresh.
+// Returns the path, ready to open for appending.
+std::string prepare_resume(const std::string& path, int resume_from) {
+    if (!std::filesystem::exists(path)) {
+        BinaryWriter fresh(path, TELEMETRY_MAGIC, TELEMETRY_VERSION);
+        write_header(fresh);
+        fresh.finish();
+        return path;
+    }
+    uint64_t keep = resume_length(path, resume_from);
+    std::filesystem::resize_file(path, keep);
+    return path;
+}
+
+} // namespace
+
+TelemetryWriter::TelemetryWriter(const std::string& path)
+    : out_(path, TELEMETRY_MAGIC, TELEMETRY_VERSION) {
+    write_header(out_);
+    out_.flush();
+    thread_ = std::thread([this] { run(); });
+}
+
+TelemetryWriter::TelemetryWriter(const std::string& path, int resume_from)
+    : out_(prepare_resume(path, resume_from), BinaryWriter::Append{}) {
+    thread_ = std::thread([this] { run(); });
+}
+
+TelemetryWriter::~TelemetryWriter() {
+    try {
+        close();
+    } catch (const std::exception& e) {
+        std::cerr << "Warning: telemetry: " << e.what() << "\n";
+    }
+}
+
+void TelemetryWriter::submit(TelemetryBatch batch) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closing_) return;
+        queue_.push_back(std::move(batch));
+    }
+    cv_.notify_one();
+}
+
+void TelemetryWriter::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closing_ && !thread_.joinable()) return;
+        closing_ = true;
+    }
+    cv_.notify_one();
+    if (thread_.joinable()) thread_.join();
+
+    if (error_.empty()) {
+        try {
+            out_.finish();
+        } catch (const std::exception& e) {
+            error_ = e.what();
+        }
+    }
+    if (!error_.empty()) {
+        std::string error = std::move(error_);
+        error_.clear();
+        throw std::runtime_error(error);
+    }
+}
+
+void TelemetryWriter::run() {
+    for (;;) {
+        TelemetryBatch batch;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return closing_ || !queue_.empty(); });
+            if (queue_.empty()) return;  // closing and drained
+            batch = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        if (!error_.empty()) continue;  // keep draining so close() doesn't wait forever
+
+        try {
+            write_chunk(out_, GENERATIONS, batch.generations, generation_table);
+            write_chunk(out_, INDIVIDUALS, batch.individuals, individual_table);
+            out_.flush();
+        } catch (const std::exception& e) {
+            error_ = e.what();
+        }
+    }
+}
+
+void export_telemetry_csv(const std::string& path, const std::string& table, std::ostream& out) {
+    BinaryReader in(path, TELEMETRY_MAGIC);
+    Schema schema = read_header(in, path);
+    const size_t table_count = schema.names.size();
+
+    size_t wanted = table_count;
+    for (size_t t = 0; t < table_count; ++t) {
+        if (schema.names[t] == table) wanted = t;
+    }
+    if (wanted == table_count) {
+        throw std::runtime_error("No table '" + table + "' in telemetry file: " + path);
+    }
+
+    const auto& columns = schema.tables[wanted];
+    for (size_t c = 0; c < columns.size(); ++c) {
+        out << (c ? "," : "") << columns[c].name;
+    }
+    out << "\n";
+
+    // Enough digits that every float reads back exactly
+    std::streamsize old_precision = out.precision(std::numeric_limits<float>::max_digits10);
+    std::vector<std::vector<uint32_t>> data;
+    int chunks = 0;
+    while (in.remaining() > 0) {
+        try {
+            uint32_t id;
+            size_t rows = read_chunk(in, schema, id, data);
+            ++chunks;
+            if (id != wanted) continue;
+
+            for (size_t r = 0; r < rows; ++r) {
+                for (size_t c = 0; c < columns.size(); ++c) {
+                    if (c) out << ",";
+                    if (columns[c].type == 'f') {
+                        float v;
+                        std::memcpy(&v, &data[c][r], sizeof(v));
+                        if (!std::isnan(v)) out << v;
+                    } else {
+                        int32_t v;
+                        std::memcpy(&v, &data[c][r], sizeof(v));
+                        out << v;
+                    }
+                }
+                out << "\n";
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "Warning: telemetry file ends in a damaged chunk after "
+                      << chunks << " complete ones (" << e.what() << ")\n";
+            break;
+        }
+    }
+    out.precision(old_precision);
+}
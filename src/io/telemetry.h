@@ -0,0 +1,103 @@
+#pragma once
+
+#include "io/binary_io.h"
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Per-generation evolution telemetry, written by a background thread to a
+// compact columnar binary file (magic "WBTL").
+//
+// The file starts with the schema of each table (its name, then each
+// column's name and type: 'i' for int32, 'f' for float32). Then come chunks,
+// one per submitted batch and table: the table id, then every column as a
+// length-prefixed array. Readers can export any table without knowing the
+// columns in advance, and a file cut short by a crash keeps all complete
+// chunks.
+
+enum class TelemetryPopulation : int32_t { Prey = 0, Predator = 1 };
+
+// One row per population per generation
+struct GenerationTelemetry {
+    int32_t island = 0;
+    int32_t generation = 0;
+    TelemetryPopulation population = TelemetryPopulation::Prey;
+    float best_fitness = 0.0f;
+    float mean_fitness = 0.0f;
+    int32_t species_count = 0;
+    int32_t survivors = 0;
+    float ticks = 0.0f;             // ticks simulated (mean over episodes)
+    float mean_nodes = 0.0f;
+    float mean_connections = 0.0f;  // enabled only
+};
+
+// One row per individual per generation. Energy and survival are averaged
+// over episodes. Morphology columns are NaN without morphology evolution.
+struct IndividualTelemetry {
+    int32_t island = 0;
+    int32_t generation = 0;
+    TelemetryPopulation population = TelemetryPopulation::Prey;
+    int32_t index = 0;
+    int32_t species_id = 0;
+    float fitness = 0.0f;
+    int32_t episodes = 0;             // episodes the fitness is averaged over
+    float fitness_confidence = 0.0f;  // 95% CI half-width; NaN unless racing
+    float energy_gained = 0.0f;
+    float energy_spent = 0.0f;
+    float survival_ticks = 0.0f;
+    int32_t nodes = 0;
+    int32_t connections = 0;        // enabled only
+    float eye_angle_spread = 0.0f;  // std dev of eye centre angles (radians)
+    float eye_arc_max = 0.0f;       // widest eye's share of its group's arc
+};
+
+struct TelemetryBatch {
+    std::vector<GenerationTelemetry> generations;
+    std::vector<IndividualTelemetry> individuals;
+};
+
+class TelemetryWriter {
+public:
+    // Creates `path` and writes the schema. Throws if the file can't be opened.
+    explicit TelemetryWriter(const std::string& path);
+
+    // Continue the file of a run resumed at generation `resume_from`: rows
+    // of earlier generations are kept, later rows and a damaged tail are
+    // cut off, and new chunks are appended. Creates the file if it doesn't
+    // exist. Throws if its schema differs from this build's.
+    TelemetryWriter(const std::string& path, int resume_from);
+
+    // Finishes writing everything submitted so far.
+    ~TelemetryWriter();
+
+    TelemetryWriter(const TelemetryWriter&) = delete;
+    TelemetryWriter& operator=(const TelemetryWriter&) = delete;
+
+    // Queue a batch for the writer thread and return at once.
+    void submit(TelemetryBatch batch);
+
+    // Wait for the queue to drain and close the file. Rethrows a write
+    // failure from the writer thread. Later submits are ignored.
+    void close();
+
+private:
+    BinaryWriter out_;
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<TelemetryBatch> queue_;
+    bool closing_ = false;
+    std::string error_;  // first write failure, reported by close()
+
+    void run();
+};
+
+// Write one table ("generations" or "individuals") of a telemetry file as
+// CSV. A truncated final chunk is dropped with a warning on stderr. Throws
+// on a missing file, bad header or unknown table.
+void export_telemetry_csv(const std::string& path, const std::string& table, std::ostream& out);
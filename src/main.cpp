@@ -1,3 +1,4 @@
+#include "brain/compiled_network.h"
 #include "brain/neat_genome.h"
 #include "display/app.h"
 #include "display/renderer.h"
@@ -34,9 +35,9 @@ int main(int argc, char* argv[]) {
       window_size = std::atoi(argv[++i]);
     } else if (std::strcmp(argv[i], "--help") == 0) {
       std::cerr << "Usage: " << argv[0] << " [options]\n"
-                << "  --champion PATH          Load evolved prey champion JSON\n"
+                << "  --champion PATH          Load evolved prey champion (JSON or .wbs)\n"
                 << "  --prey-champion PATH     Same as --champion\n"
-                << "  --predator-champion PATH Load evolved predator champion JSON\n"
+                << "  --predator-champion PATH Load evolved predator champion (JSON or .wbs)\n"
                 << "  --boids N                Number of prey boids (default: 30)\n"
                 << "  --predators N            Number of predator boids (default: 0)\n"
                 << "  --config PATH            Sim config JSON (default: data/sim_config.json)\n"
@@ -130,9 +131,12 @@ int main(int argc, char* argv[]) {
 
   // Spawn prey boids
   if (!prey_champion_path.empty()) {
-    // Champion mode: all prey use the loaded genome
+    // Champion mode: all prey use the loaded genome, sharing one compiled
+    // tape so the world can evaluate their brains in batches
+    auto tape = prey_spec.genome ? std::make_shared<const NetworkTape>(*prey_spec.genome, sim.world.brain_activation) : nullptr;
     for (int i = 0; i < num_boids; i++) {
       Boid boid = create_boid_from_spec(prey_spec);
+      if (tape) boid.brain = std::make_unique<CompiledNetwork>(tape);
       boid.body.position = {pos_x(rng), pos_y(rng)};
       boid.body.angle = angle_dist(rng);
       world.add_boid(std::move(boid));
@@ -147,8 +151,8 @@ int main(int argc, char* argv[]) {
     for (int i = 0; i < num_boids; i++) {
       NeatGenome genome = NeatGenome::minimal(n_sensors, n_thrusters, next_innov);
       next_innov = 1;
-      for (auto &c : genome.connections) {
-        c.weight = weight_dist(rng);
+      for (size_t c = 0; c < genome.connections().size(); c++) {
+        genome.set_weight(c, weight_dist(rng));
       }
       prey_spec.genome = genome;
 
@@ -162,9 +166,11 @@ int main(int argc, char* argv[]) {
   // Spawn predator boids
   if (num_predators > 0) {
     if (!predator_champion_path.empty()) {
-      // Champion mode: all predators use the loaded genome
+      // Champion mode: all predators use the loaded genome (one shared tape)
+      auto tape = predator_spec.genome ? std::make_shared<const NetworkTape>(*predator_spec.genome, sim.world.brain_activation) : nullptr;
       for (int i = 0; i < num_predators; i++) {
         Boid boid = create_boid_from_spec(predator_spec);
+        if (tape) boid.brain = std::make_unique<CompiledNetwork>(tape);
         boid.body.position = {pos_x(rng), pos_y(rng)};
         boid.body.angle = angle_dist(rng);
         world.add_boid(std::move(boid));
@@ -179,8 +185,8 @@ int main(int argc, char* argv[]) {
       for (int i = 0; i < num_predators; i++) {
         NeatGenome genome = NeatGenome::minimal(n_sensors, n_thrusters, next_innov);
         next_innov = 1;
-        for (auto &c : genome.connections) {
-          c.weight = weight_dist(rng);
+        for (size_t c = 0; c < genome.connections().size(); c++) {
+          genome.set_weight(c, weight_dist(rng));
         }
         predator_spec.genome = genome;
 
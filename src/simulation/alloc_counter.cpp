@@ -0,0 +1,59 @@
+#include "simulation/alloc_counter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<uint64_t> g_allocations{0};
+
+void* counted_alloc(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0) size = 1;
+    return std::malloc(size);
+}
+
+void* counted_aligned_alloc(std::size_t size, std::align_val_t align) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    std::size_t a = static_cast<std::size_t>(align);
+    if (a < sizeof(void*)) a = sizeof(void*);
+    std::size_t rounded = (size + a - 1) / a * a;  // aligned_alloc wants a multiple
+    return std::aligned_alloc(a, rounded == 0 ? a : rounded);
+}
+
+void* throwing(void* p) {
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+} // namespace
+
+uint64_t allocation_count() {
+    return g_allocations.load(std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size) { return throwing(counted_alloc(size)); }
+void* operator new[](std::size_t size) { return throwing(counted_alloc(size)); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return counted_alloc(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return counted_alloc(size); }
+void* operator new(std::size_t size, std::align_val_t a) { return throwing(counted_aligned_alloc(size, a)); }
+void* operator new[](std::size_t size, std::align_val_t a) { return throwing(counted_aligned_alloc(size, a)); }
+void* operator new(std::size_t size, std::align_val_t a, const std::nothrow_t&) noexcept {
+    return counted_aligned_alloc(size, a);
+}
+void* operator new[](std::size_t size, std::align_val_t a, const std::nothrow_t&) noexcept {
+    return counted_aligned_alloc(size, a);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
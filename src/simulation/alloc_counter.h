@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+
+// Heap allocation accounting for tests and benchmarks.
+//
+// alloc_counter.cpp replaces the global operator new/delete family with
+// versions that bump one relaxed atomic counter per allocation, on every
+// thread. It is compiled into the test (and benchmark) executables only,
+// never into wildboids_sim, so the simulation runners keep the default
+// allocator.
+
+// Total allocations made through operator new since program start.
+uint64_t allocation_count();
+
+// Allocations made since construction.
+//   AllocationCounter counter;
+//   world.step(dt, &rng);
+//   CHECK(counter.count() == 0);
+class AllocationCounter {
+public:
+    AllocationCounter() : start_(allocation_count()) {}
+    uint64_t count() const { return allocation_count() - start_; }
+    void restart() { start_ = allocation_count(); }
+
+private:
+    uint64_t start_;
+};
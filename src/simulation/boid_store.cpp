@@ -0,0 +1,52 @@
+#include "simulation/boid_store.h"
+#include "simulation/boid.h"
+#include <stdexcept>
+
+void BoidStore::push_back(const Boid& boid) {
+    position.push_back(boid.body.position);
+    velocity.push_back(boid.body.velocity);
+    angle.push_back(boid.body.angle);
+    energy.push_back(boid.energy);
+    alive.push_back(boid.alive ? 1 : 0);
+    type_id.push_back(intern_type(boid.type));
+    metabolism.push_back(boid.metabolism_rate);
+    thrust.push_back(boid.total_thrust());
+    energy_gained.push_back(boid.total_energy_gained);
+    energy_spent.push_back(boid.total_energy_spent);
+}
+
+void BoidStore::load(int i, const Boid& boid) {
+    position[i] = boid.body.position;
+    velocity[i] = boid.body.velocity;
+    angle[i] = boid.body.angle;
+    energy[i] = boid.energy;
+    alive[i] = boid.alive ? 1 : 0;
+    metabolism[i] = boid.metabolism_rate;
+    thrust[i] = boid.total_thrust();
+    energy_gained[i] = boid.total_energy_gained;
+    energy_spent[i] = boid.total_energy_spent;
+}
+
+void BoidStore::store(int i, Boid& boid) const {
+    boid.energy = energy[i];
+    boid.alive = alive[i] != 0;
+    boid.total_energy_gained = energy_gained[i];
+    boid.total_energy_spent = energy_spent[i];
+}
+
+void BoidStore::reload_types(const std::vector<Boid>& boids) {
+    for (int i = 0; i < static_cast<int>(boids.size()); ++i) {
+        type_id[i] = intern_type(boids[i].type);
+    }
+}
+
+uint8_t BoidStore::intern_type(const std::string& type) {
+    for (int id = 0; id < static_cast<int>(type_names_.size()); ++id) {
+        if (type_names_[id] == type) return static_cast<uint8_t>(id);
+    }
+    if (type_names_.size() > UINT8_MAX) {
+        throw std::runtime_error("Too many boid types (at most 256): " + type);
+    }
+    type_names_.push_back(type);
+    return static_cast<uint8_t>(type_names_.size() - 1);
+}
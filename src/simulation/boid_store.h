@@ -0,0 +1,59 @@
+#pragma once
+
+#include "simulation/vec2.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct Boid;
+
+// Interned boid type ids. "prey" and "predator" always get these ids;
+// any other type string (including the empty default) is assigned the next free id.
+constexpr uint8_t TYPE_PREY = 0;
+constexpr uint8_t TYPE_PREDATOR = 1;
+
+// Structure-of-arrays copy of the per-boid fields that World::step's hot loops
+// touch every tick (grid rebuild, shoaling, energy, food, predation).
+//
+// Boid stays the owner of cold state (thrusters, sensors, brain) and is what
+// get_boids() returns. World refreshes the store from the boid list during the
+// integration pass, runs the hot phases against the arrays, and writes the
+// mutable fields back at the end of the step, so callers holding Boid
+// references see the same values as before.
+struct BoidStore {
+    std::vector<Vec2> position;
+    std::vector<Vec2> velocity;
+    std::vector<float> angle;
+    std::vector<float> energy;
+    std::vector<uint8_t> alive;
+    std::vector<uint8_t> type_id;
+
+    // Per-tick energy inputs: resolved metabolism rate and total thrust output
+    std::vector<float> metabolism;   // -1 = use world default
+    std::vector<float> thrust;       // sum of power * max_thrust
+
+    // Cumulative energy bookkeeping (mirrors Boid::total_energy_*)
+    std::vector<float> energy_gained;
+    std::vector<float> energy_spent;
+
+    int size() const { return static_cast<int>(position.size()); }
+
+    // Append a boid, interning its type string.
+    void push_back(const Boid& boid);
+
+    // Copy the dynamic fields of boid i (everything except the type id).
+    void load(int i, const Boid& boid);
+
+    // Write the fields the hot phases mutate back into boid i.
+    void store(int i, Boid& boid) const;
+
+    // Re-intern the type of every boid (after external edits via get_boids_mut()).
+    void reload_types(const std::vector<Boid>& boids);
+
+    // Id of `type`, adding it if new. Throws std::runtime_error past 256 types.
+    uint8_t intern_type(const std::string& type);
+    const std::string& type_name(uint8_t id) const { return type_names_[id]; }
+
+private:
+    std::vector<std::string> type_names_ = {"prey", "predator"};
+};
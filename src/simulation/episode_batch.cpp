@@ -0,0 +1,45 @@
+#include "simulation/episode_batch.h"
+#include <cmath>
+
+static void add_outcomes(std::vector<IndividualOutcome>& sum,
+                         const std::vector<IndividualOutcome>& add) {
+    for (size_t i = 0; i < sum.size(); ++i) {
+        sum[i].energy_gained += add[i].energy_gained;
+        sum[i].energy_spent += add[i].energy_spent;
+        sum[i].survival_ticks += add[i].survival_ticks;
+    }
+}
+
+static void scale_outcomes(std::vector<IndividualOutcome>& outcomes, float k) {
+    for (auto& o : outcomes) {
+        o.energy_gained *= k;
+        o.energy_spent *= k;
+        o.survival_ticks *= k;
+    }
+}
+
+GenerationResult average_episodes(std::vector<GenerationResult> results) {
+    int episodes = static_cast<int>(results.size());
+    GenerationResult mean = std::move(results[0]);
+    for (int e = 1; e < episodes; ++e) {
+        for (size_t i = 0; i < mean.prey_fitness.size(); ++i)
+            mean.prey_fitness[i] += results[e].prey_fitness[i];
+        for (size_t i = 0; i < mean.predator_fitness.size(); ++i)
+            mean.predator_fitness[i] += results[e].predator_fitness[i];
+        add_outcomes(mean.prey_outcomes, results[e].prey_outcomes);
+        add_outcomes(mean.predator_outcomes, results[e].predator_outcomes);
+        mean.prey_survivors += results[e].prey_survivors;
+        mean.predator_survivors += results[e].predator_survivors;
+        mean.ticks_run += results[e].ticks_run;
+        mean.profile += results[e].profile;
+    }
+    float inv = 1.0f / static_cast<float>(episodes);
+    for (float& f : mean.prey_fitness) f *= inv;
+    for (float& f : mean.predator_fitness) f *= inv;
+    scale_outcomes(mean.prey_outcomes, inv);
+    scale_outcomes(mean.predator_outcomes, inv);
+    mean.ticks_run *= inv;
+    mean.prey_survivors = static_cast<int>(std::lround(mean.prey_survivors * inv));
+    mean.predator_survivors = static_cast<int>(std::lround(mean.predator_survivors * inv));
+    return mean;
+}
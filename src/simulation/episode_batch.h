@@ -0,0 +1,63 @@
+#pragma once
+
+#include "simulation/step_profile.h"
+#include "simulation/thread_pool.h"
+#include <random>
+#include <vector>
+
+// How one individual fared in a generation (averaged over episodes)
+struct IndividualOutcome {
+    float energy_gained = 0.0f;
+    float energy_spent = 0.0f;
+    float survival_ticks = 0.0f;
+};
+
+struct GenerationResult {
+    std::vector<float> prey_fitness;
+    std::vector<float> predator_fitness;
+    std::vector<IndividualOutcome> prey_outcomes;
+    std::vector<IndividualOutcome> predator_outcomes;
+    int prey_survivors = 0;
+    int predator_survivors = 0;
+    float ticks_run = 0.0f;  // may stop short of the budget
+
+    // Episodes each individual's fitness is averaged over, and the 95%
+    // confidence half-width of that mean (NaN when it can't be estimated)
+    std::vector<int> prey_episodes;
+    std::vector<int> predator_episodes;
+    std::vector<float> prey_confidence;
+    std::vector<float> predator_confidence;
+
+    StepProfile profile;  // summed over every world run (profiling builds)
+};
+
+// Run `episodes` independently seeded copies of one generation in parallel,
+// calling run(episode_rng, worker). `worker` is in [0, pool.size()) and no two
+// episodes share it at once, so it can pick per-worker resources such as a
+// world's thread pool. Episode seeds are drawn from rng up front and each
+// result lands in its own slot, so the output does not depend on the pool
+// size or on scheduling.
+template <typename RunFn>
+std::vector<GenerationResult> run_episode_batch(int episodes, ThreadPool& pool,
+                                                std::mt19937& rng, RunFn run) {
+    std::vector<unsigned> seeds(episodes);
+    for (auto& s : seeds) s = static_cast<unsigned>(rng());
+
+    std::vector<GenerationResult> results(episodes);
+    pool.parallel_for(episodes, 1, [&](int begin, int end, int worker) {
+        for (int e = begin; e < end; ++e) {
+            std::mt19937 episode_rng(seeds[e]);
+            results[e] = run(episode_rng, worker);
+        }
+    });
+    return results;
+}
+
+// Average a batch of episode results, summing in episode order. Profiles are
+// summed rather than averaged. `results` must not be empty.
+GenerationResult average_episodes(std::vector<GenerationResult> results);
+
+template <typename RunFn>
+GenerationResult run_episodes(int episodes, ThreadPool& pool, std::mt19937& rng, RunFn run) {
+    return average_episodes(run_episode_batch(episodes, pool, rng, run));
+}
@@ -0,0 +1,50 @@
+#include "simulation/eye_kernel.h"
+#include <algorithm>
+#include <cmath>
+
+EyeKernel::EyeKernel(const CompoundEyeConfig& cfg)
+    : n_channels_(static_cast<int>(cfg.channels.size()))
+{
+    auto add_eye = [&](const EyeSpec& eye) {
+        dir_x_.push_back(std::sin(eye.center_angle));
+        dir_y_.push_back(std::cos(eye.center_angle));
+        float half = eye.arc_width * 0.5f;
+        cos_half_.push_back(half >= static_cast<float>(M_PI) ? -2.0f : std::cos(half));
+        range_sq_.push_back(eye.max_range * eye.max_range);
+        inv_range_.push_back(eye.max_range > 0.0f ? 1.0f / eye.max_range : 0.0f);
+    };
+    // Short-range eyes first, then long-range, matching the output layout
+    for (const auto& eye : cfg.eyes) add_eye(eye);
+    for (const auto& eye : cfg.long_range_eyes) add_eye(eye);
+}
+
+void EyeKernel::see(float* scratch, int ch, Vec2 body, float dist_sq) const {
+    float dist = std::sqrt(dist_sq);
+
+    // A target exactly on top of the boid has bearing 0 on the exact path
+    float ax = body.x, ay = body.y, alen = dist;
+    if (dist_sq == 0.0f) { ax = 0.0f; ay = 1.0f; alen = 1.0f; }
+
+    const int n = eye_count();
+    const float* dx = dir_x_.data();
+    const float* dy = dir_y_.data();
+    const float* cos_h = cos_half_.data();
+    const float* rsq = range_sq_.data();
+    const float* inv = inv_range_.data();
+    float* best = scratch + ch * n;
+
+    for (int e = 0; e < n; ++e) {
+        bool hit = (dist_sq <= rsq[e]) & (ax * dx[e] + ay * dy[e] >= cos_h[e] * alen);
+        float signal = hit ? 1.0f - dist * inv[e] : 0.0f;
+        best[e] = std::max(best[e], signal);
+    }
+}
+
+void EyeKernel::write_outputs(const float* scratch, float* outputs) const {
+    const int n = eye_count();
+    for (int e = 0; e < n; ++e) {
+        for (int c = 0; c < n_channels_; ++c) {
+            outputs[e * n_channels_ + c] = scratch[c * n + e];
+        }
+    }
+}
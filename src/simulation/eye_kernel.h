@@ -0,0 +1,45 @@
+#pragma once
+
+#include "simulation/sensor.h"
+#include "simulation/vec2.h"
+#include <vector>
+
+// Trig-free compound-eye evaluation (opt-in via WorldConfig::fast_eye_kernel).
+//
+// Each eye is stored as a unit centre direction plus cos(arc/2). A target at
+// body-frame offset d is inside the arc when dot(d, dir) >= cos(arc/2) * |d|,
+// so no atan2, fmod or per-eye sqrt is needed. Eye parameters are kept as
+// structure-of-arrays and the per-target loop runs branch-free across all eyes
+// of both tiers, which the compiler turns into SIMD code.
+//
+// Tolerance against the exact path (SensorySystem::perceive):
+//   - signals differ by at most 1e-5 (1 - dist * (1/range) vs 1 - dist / range)
+//   - a target within ~1e-5 rad of an arc edge may fall on the other side
+//     of it, since the two tests round differently
+class EyeKernel {
+public:
+    explicit EyeKernel(const CompoundEyeConfig& cfg);
+
+    int eye_count() const { return static_cast<int>(dir_x_.size()); }
+    int channel_count() const { return n_channels_; }
+
+    // Floats of scratch needed by see()/write_outputs(): channel-major, one
+    // slot per (channel, eye). Must be zeroed before the first see().
+    int scratch_size() const { return eye_count() * n_channels_; }
+
+    // Record a target on channel ch at body-frame offset `body` with
+    // squared distance dist_sq, keeping the strongest signal per eye.
+    void see(float* scratch, int ch, Vec2 body, float dist_sq) const;
+
+    // Copy the accumulated signals into the sensor output layout
+    // [short eyes x channels, long eyes x channels].
+    void write_outputs(const float* scratch, float* outputs) const;
+
+private:
+    int n_channels_;
+    std::vector<float> dir_x_;      // sin(centre): body-frame +x component
+    std::vector<float> dir_y_;      // cos(centre): body-frame +y (forward) component
+    std::vector<float> cos_half_;   // cos(arc/2), or -2 for arcs of 2π or more
+    std::vector<float> range_sq_;
+    std::vector<float> inv_range_;
+};
@@ -33,6 +33,9 @@ public:
     void spawn(std::vector<Food>& food, float dt, std::mt19937& rng);
     void pre_seed(std::vector<Food>& food, std::mt19937& rng);
 
+    // Most items this source keeps in the world at once
+    int capacity() const { return config_.max_food; }
+
 private:
     UniformFoodConfig config_;
     float world_w_, world_h_;
@@ -46,6 +49,7 @@ public:
     void pre_seed(std::vector<Food>& food, std::mt19937& rng);
 
     int target_count() const;
+    int capacity() const { return target_count(); }
 
 private:
     PatchFoodConfig config_;
@@ -0,0 +1,76 @@
+#include "simulation/food_store.h"
+
+FoodStore::FoodStore(float world_w, float world_h, float cell_size) {
+    cols_ = std::max(1, static_cast<int>(std::ceil(world_w / cell_size)));
+    rows_ = std::max(1, static_cast<int>(std::ceil(world_h / cell_size)));
+    cell_w_ = world_w / static_cast<float>(cols_);
+    cell_h_ = world_h / static_cast<float>(rows_);
+    cell_head_.assign(cols_ * rows_, -1);
+}
+
+void FoodStore::reserve(int n) {
+    items_.reserve(n);
+    dense_slot_.reserve(n);
+    slots_.reserve(n);
+    free_slots_.reserve(n);
+}
+
+void FoodStore::add(const Food& food) {
+    items_.push_back(food);
+    index_appended();
+}
+
+void FoodStore::index_appended() {
+    for (int d = static_cast<int>(dense_slot_.size()); d < size(); ++d) {
+        index_item(d);
+    }
+}
+
+void FoodStore::index_item(int dense) {
+    int slot;
+    if (!free_slots_.empty()) {
+        slot = free_slots_.back();
+        free_slots_.pop_back();
+    } else {
+        slot = static_cast<int>(slots_.size());
+        slots_.emplace_back();
+    }
+
+    Slot& s = slots_[slot];
+    s.dense = dense;
+    s.cell = cell_of(items_[dense].position);
+    s.serial = next_serial_++;
+
+    // Push onto the front of the cell list
+    s.prev = -1;
+    s.next = cell_head_[s.cell];
+    if (s.next >= 0) slots_[s.next].prev = slot;
+    cell_head_[s.cell] = slot;
+
+    dense_slot_.push_back(slot);
+}
+
+void FoodStore::remove(int slot) {
+    Slot& s = slots_[slot];
+
+    // Unlink from the cell list
+    if (s.prev >= 0) slots_[s.prev].next = s.next;
+    else cell_head_[s.cell] = s.next;
+    if (s.next >= 0) slots_[s.next].prev = s.prev;
+
+    // Swap-and-pop out of the dense array
+    int last = size() - 1;
+    int moved_slot = dense_slot_[last];
+    items_[s.dense] = items_[last];
+    dense_slot_[s.dense] = moved_slot;
+    slots_[moved_slot].dense = s.dense;
+    items_.pop_back();
+    dense_slot_.pop_back();
+
+    s.dense = -1;
+    free_slots_.push_back(slot);
+}
+
+int FoodStore::cell_of(Vec2 pos) const {
+    return axis_cell(pos.y, cell_h_, rows_) * cols_ + axis_cell(pos.x, cell_w_, cols_);
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "simulation/vec2.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+struct Food {
+    Vec2 position;
+    float energy_value = 10.0f;
+};
+
+// Food items in a dense array, bucketed into a uniform grid by stable slot id.
+// Removal is O(1): the item is swapped with the last dense entry and its slot
+// goes on a free list. Dense order is therefore not insertion order; use
+// serial() where the original insertion order matters.
+//
+// Each grid cell is an intrusive doubly linked list threaded through the
+// slots, so once reserve() covers the peak food count, adding and removing
+// food never allocates.
+class FoodStore {
+public:
+    // Cells evenly divide the world (at most cell_size on a side), so a wrapped
+    // neighbourhood never misses items across a partial edge cell.
+    FoodStore(float world_w, float world_h, float cell_size);
+
+    const std::vector<Food>& items() const { return items_; }
+    int size() const { return static_cast<int>(items_.size()); }
+
+    void add(const Food& food);
+
+    // Pre-size storage for n items.
+    void reserve(int n);
+
+    // Vector that food sources append to directly. Call index_appended()
+    // afterwards to bucket the new items.
+    std::vector<Food>& append_target() { return items_; }
+    void index_appended();
+
+    // Remove by slot id (as passed to for_each_near callbacks).
+    void remove(int slot);
+
+    const Food& at_slot(int slot) const { return items_[slots_[slot].dense]; }
+
+    // Monotonic insertion counter for the item in `slot`.
+    uint64_t serial(int slot) const { return slots_[slot].serial; }
+
+    // Call fn(slot, food) once for every item in cells overlapping the circle at
+    // pos. Neighbourhoods always wrap around the world edges, since sensors measure
+    // toroidal distance even in bounded worlds. Callers must do their own distance checks.
+    template <typename Fn>
+    void for_each_near(Vec2 pos, float radius, Fn&& fn) const {
+        int c0, c1, r0, r1;
+        cell_range(pos.x, radius, cell_w_, cols_, c0, c1);
+        cell_range(pos.y, radius, cell_h_, rows_, r0, r1);
+        for (int r = r0; r <= r1; ++r) {
+            int row = wrap(r, rows_) * cols_;
+            for (int c = c0; c <= c1; ++c) {
+                for (int slot = cell_head_[row + wrap(c, cols_)]; slot >= 0;) {
+                    int next = slots_[slot].next;
+                    fn(slot, items_[slots_[slot].dense]);
+                    slot = next;
+                }
+            }
+        }
+    }
+
+private:
+    struct Slot {
+        int dense = -1;      // index into items_, -1 when free
+        int cell = 0;
+        int prev = -1;       // neighbouring slots in the cell list
+        int next = -1;
+        uint64_t serial = 0;
+    };
+
+    int cols_, rows_;
+    float cell_w_, cell_h_;
+
+    std::vector<Food> items_;
+    std::vector<int> dense_slot_;   // items_ index -> slot id
+    std::vector<Slot> slots_;
+    std::vector<int> free_slots_;
+    std::vector<int> cell_head_;    // first slot per cell, -1 when empty
+    uint64_t next_serial_ = 0;
+
+    int cell_of(Vec2 pos) const;
+    void index_item(int dense);
+
+    static int wrap(int i, int n) { return ((i % n) + n) % n; }
+
+    // Torus cell along one axis; positions outside the world wrap like toroidal_delta().
+    static int axis_cell(float x, float cell, int n) {
+        return wrap(static_cast<int>(std::floor(x / cell)), n);
+    }
+
+    // Inclusive (unwrapped) cell range covering [x - radius, x + radius] along one
+    // axis, capped at n cells so no cell is visited twice.
+    static void cell_range(float x, float radius, float cell, int n, int& lo, int& hi) {
+        int center = axis_cell(x, cell, n);
+        int span = static_cast<int>(std::ceil(radius / cell));
+        lo = center - span;
+        hi = center + span;
+        if (hi - lo + 1 >= n) { lo = 0; hi = n - 1; }
+    }
+};
@@ -0,0 +1,46 @@
+#include "simulation/rank_stability.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+bool RankStability::observe(const std::vector<float>& fitness) {
+    const int n = static_cast<int>(fitness.size());
+    order_.resize(n);
+    std::iota(order_.begin(), order_.end(), 0);
+    std::sort(order_.begin(), order_.end(),
+              [&](int a, int b) { return fitness[a] > fitness[b]; });
+
+    // Tied values share the mean of the ranks they span
+    next_ranks_.resize(n);
+    for (int first = 0; first < n;) {
+        int last = first;
+        while (last + 1 < n && fitness[order_[last + 1]] == fitness[order_[first]]) ++last;
+        double mid = 0.5 * (first + last);
+        for (int r = first; r <= last; ++r) next_ranks_[order_[r]] = mid;
+        first = last + 1;
+    }
+
+    if (static_cast<int>(ranks_.size()) == n && n > 1) {
+        // Pearson correlation of the two rank vectors. Mid-ranks keep the
+        // mean at (n - 1) / 2 however many ties there are.
+        double mean = 0.5 * (n - 1);
+        double cov = 0.0, var_prev = 0.0, var_next = 0.0;
+        for (int i = 0; i < n; ++i) {
+            double a = ranks_[i] - mean;
+            double b = next_ranks_[i] - mean;
+            cov += a * b;
+            var_prev += a * a;
+            var_next += b * b;
+        }
+        // A snapshot where everyone ties orders nobody, so it can't confirm a ranking
+        last_correlation_ = var_prev > 0.0 && var_next > 0.0
+            ? static_cast<float>(cov / std::sqrt(var_prev * var_next))
+            : 0.0f;
+        streak_ = last_correlation_ >= threshold_ ? streak_ + 1 : 0;
+    } else if (n <= 1) {
+        ++streak_;  // nothing to reorder
+    }
+
+    ranks_.swap(next_ranks_);
+    return stable();
+}
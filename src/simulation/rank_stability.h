@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+
+// Watches a population's fitness during an episode and reports when its
+// ranking has stopped changing, so evaluation can end early.
+//
+// Each observe() ranks the current fitness values, giving tied values the
+// mean of the ranks they span, and compares the ranking with the previous one
+// by Spearman correlation (Pearson on those ranks, so ties are handled
+// exactly). A snapshot in which everyone ties correlates 0 with anything:
+// the ranking counts as settled only once it actually orders individuals,
+// and `patience` consecutive observations correlate at `threshold` or better
+// with the one before.
+class RankStability {
+public:
+    RankStability(float threshold, int patience)
+        : threshold_(threshold), patience_(patience) {}
+
+    // Record a snapshot; returns stable().
+    bool observe(const std::vector<float>& fitness);
+
+    bool stable() const { return streak_ >= patience_; }
+
+    // Correlation between the last two snapshots (1 before there are two)
+    float last_correlation() const { return last_correlation_; }
+
+private:
+    float threshold_;
+    int patience_;
+    int streak_ = 0;
+    float last_correlation_ = 1.0f;
+    std::vector<double> ranks_;       // mid-rank of each individual at the last snapshot
+    std::vector<int> order_;          // scratch
+    std::vector<double> next_ranks_;  // scratch
+};
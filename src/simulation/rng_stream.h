@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+// Counter-based random numbers. Every (seed, stream) pair maps to its own value
+// without any shared generator state, so parallel code draws the same numbers
+// no matter how work is split between threads.
+
+// SplitMix64 finaliser: a strong 64-bit mix of x.
+inline uint64_t splitmix64(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// 64 random bits for element `stream` of the sequence identified by `seed`.
+inline uint64_t stream_bits(uint64_t seed, uint64_t stream) {
+    return splitmix64(seed ^ splitmix64(stream));
+}
+
+// Uniform float in [lo, hi) built from the top 24 bits of stream_bits().
+inline float stream_uniform(uint64_t seed, uint64_t stream, float lo, float hi) {
+    float u = static_cast<float>(stream_bits(seed, stream) >> 40) * (1.0f / 16777216.0f);
+    return lo + (hi - lo) * u;
+}
@@ -10,27 +10,40 @@ SensorySystem::SensorySystem(std::vector<SensorSpec> specs)
     : specs_(std::move(specs)) {}
 
 SensorySystem::SensorySystem(CompoundEyeConfig eye_config)
-    : eye_config_(std::move(eye_config)) {}
+    : eye_config_(std::move(eye_config))
+    , eye_kernel_(std::in_place, *eye_config_) {}
 
 int SensorySystem::input_count() const {
     if (is_compound()) return eye_config_->total_inputs();
     return static_cast<int>(specs_.size());
 }
 
+int SensorySystem::noise_output_index() const {
+    if (!is_compound() || !eye_config_->has_noise_sensor) return -1;
+    const auto& cfg = *eye_config_;
+    // Proprioceptive layout: [speed, angular velocity, noise, ...] after both eye tiers
+    int idx = (cfg.short_range_eye_count() + cfg.long_range_eye_count())
+              * static_cast<int>(cfg.channels.size());
+    if (cfg.has_speed_sensor) ++idx;
+    if (cfg.has_angular_velocity_sensor) ++idx;
+    return idx;
+}
+
 void SensorySystem::perceive(const std::vector<Boid>& boids,
                               const SpatialGrid& grid,
                               const WorldConfig& config,
                               int self_index,
                               const std::vector<Food>& food,
                               float* outputs,
-                              std::mt19937* rng) const {
+                              std::mt19937* rng,
+                              const FoodStore* food_index) const {
     if (is_compound()) {
-        perceive_compound(boids, grid, config, self_index, food, outputs, rng);
+        perceive_compound(boids, grid, config, self_index, food, outputs, rng, food_index);
         return;
     }
     const Boid& self = boids[self_index];
     for (int i = 0; i < static_cast<int>(specs_.size()); ++i) {
-        outputs[i] = evaluate_sensor(specs_[i], self, boids, grid, config, food);
+        outputs[i] = evaluate_sensor(specs_[i], self, boids, grid, config, food, food_index);
     }
 }
 
@@ -87,7 +100,8 @@ float SensorySystem::evaluate_sensor(const SensorSpec& spec,
                                       const std::vector<Boid>& boids,
                                       const SpatialGrid& grid,
                                       const WorldConfig& config,
-                                      const std::vector<Food>& food) const {
+                                      const std::vector<Food>& food,
+                                      const FoodStore* food_index) const {
     // Proprioceptive sensors — read internal state, no spatial query
     if (spec.filter == EntityFilter::Speed) {
         float speed = self.body.velocity.length();
@@ -109,25 +123,27 @@ float SensorySystem::evaluate_sensor(const SensorSpec& spec,
     int count = 0;
 
     if (spec.filter == EntityFilter::Food) {
-        // Brute-force iterate food (Option A — food vector is small)
-        for (const auto& f : food) {
+        auto visit = [&](const Food& f) {
             Vec2 delta = toroidal_delta(self.body.position, f.position,
                                          config.width, config.height);
             check_arc(spec, self, delta, range_sq, nearest_dist_sq, count);
+        };
+        if (food_index) {
+            food_index->for_each_near(self.body.position, spec.max_range,
+                                      [&](int, const Food& f) { visit(f); });
+        } else {
+            for (const auto& f : food) visit(f);
         }
     } else {
         // Use spatial grid for boid detection
-        std::vector<int> candidates;
-        grid.query(self.body.position, spec.max_range, candidates);
-
-        for (int j : candidates) {
-            if (&boids[j] == &self) continue;
-            if (!passes_filter(spec.filter, boids[j].type)) continue;
+        grid.for_each(self.body.position, spec.max_range, [&](int j) {
+            if (&boids[j] == &self) return;
+            if (!passes_filter(spec.filter, boids[j].type)) return;
 
             Vec2 delta = toroidal_delta(self.body.position, boids[j].body.position,
                                          config.width, config.height);
             check_arc(spec, self, delta, range_sq, nearest_dist_sq, count);
-        }
+        });
     }
 
     return compute_signal(spec.signal_type, nearest_dist_sq, range_sq,
@@ -142,82 +158,84 @@ static bool channel_enabled(SensorChannel ch, const std::vector<SensorChannel>&
     return false;
 }
 
+// Output channel index of `ch` if this sensor has it and the world enables it, else -1.
+static int active_channel(const CompoundEyeConfig& cfg, SensorChannel ch, const WorldConfig& config) {
+    for (int c = 0; c < static_cast<int>(cfg.channels.size()); ++c) {
+        if (cfg.channels[c] == ch) {
+            return channel_enabled(ch, config.enabled_channels) ? c : -1;
+        }
+    }
+    return -1;
+}
+
+void SensorySystem::boid_channels(const WorldConfig& config, int& same_ch, int& opposite_ch) const {
+    same_ch = active_channel(*eye_config_, SensorChannel::Same, config);
+    opposite_ch = active_channel(*eye_config_, SensorChannel::Opposite, config);
+}
+
+float SensorySystem::max_eye_range() const {
+    float max_range = 0;
+    for (const auto& eye : eye_config_->eyes)
+        max_range = std::max(max_range, eye.max_range);
+    for (const auto& eye : eye_config_->long_range_eyes)
+        max_range = std::max(max_range, eye.max_range);
+    return max_range;
+}
+
+void SensorySystem::begin_compound(float* outputs) const {
+    int total = eye_config_->total_inputs();
+    for (int i = 0; i < total; ++i) outputs[i] = 0.0f;
+}
+
+// Check a target against all eyes in a list, keeping the strongest signal per eye.
+void SensorySystem::process_eyes(const std::vector<EyeSpec>& eye_list, int out_offset,
+                                 float angle, float dist_sq, int ch_idx, float* outputs) const {
+    int n_channels = static_cast<int>(eye_config_->channels.size());
+    for (int e = 0; e < static_cast<int>(eye_list.size()); ++e) {
+        const auto& eye = eye_list[e];
+        float range_sq = eye.max_range * eye.max_range;
+        if (dist_sq > range_sq) continue;
+        if (!angle_in_arc(angle, eye.center_angle, eye.arc_width)) continue;
+
+        int out_idx = out_offset + e * n_channels + ch_idx;
+        float dist = std::sqrt(dist_sq);
+        float signal = 1.0f - (dist / eye.max_range);
+        if (signal > outputs[out_idx]) {
+            outputs[out_idx] = signal;
+        }
+    }
+}
+
+void SensorySystem::see_target(float* outputs, int ch_idx, float angle, float dist_sq) const {
+    const auto& cfg = *eye_config_;
+    // Output layout: [short eyes × channels, long eyes × channels, proprioceptive]
+    int long_range_offset = cfg.short_range_eye_count() * static_cast<int>(cfg.channels.size());
+    process_eyes(cfg.eyes, 0, angle, dist_sq, ch_idx, outputs);
+    process_eyes(cfg.long_range_eyes, long_range_offset, angle, dist_sq, ch_idx, outputs);
+}
+
 void SensorySystem::perceive_compound(const std::vector<Boid>& boids,
                                        const SpatialGrid& grid,
                                        const WorldConfig& config,
                                        int self_index,
                                        const std::vector<Food>& food,
                                        float* outputs,
-                                       std::mt19937* rng) const {
+                                       std::mt19937* rng,
+                                       const FoodStore* food_index) const {
     const Boid& self = boids[self_index];
-    const auto& cfg = *eye_config_;
-    int n_channels = static_cast<int>(cfg.channels.size());
-    int n_short_eyes = cfg.short_range_eye_count();
-    int n_long_eyes = cfg.long_range_eye_count();
-    int total = cfg.total_inputs();
-
-    // Output layout: [short eyes × channels, long eyes × channels, proprioceptive]
-    int long_range_offset = n_short_eyes * n_channels;
-
-    // Zero all outputs
-    for (int i = 0; i < total; ++i) outputs[i] = 0.0f;
-
-    // Find channel indices for each type
-    int food_ch = -1, same_ch = -1, opposite_ch = -1;
-    for (int c = 0; c < n_channels; ++c) {
-        if (cfg.channels[c] == SensorChannel::Food) food_ch = c;
-        else if (cfg.channels[c] == SensorChannel::Same) same_ch = c;
-        else if (cfg.channels[c] == SensorChannel::Opposite) opposite_ch = c;
-    }
-
-    // Check which channels are enabled in world config
-    bool food_enabled = food_ch >= 0 && channel_enabled(SensorChannel::Food, config.enabled_channels);
-    bool same_enabled = same_ch >= 0 && channel_enabled(SensorChannel::Same, config.enabled_channels);
-    bool opposite_enabled = opposite_ch >= 0 && channel_enabled(SensorChannel::Opposite, config.enabled_channels);
-
-    // Helper: check a target against all eyes in a list, updating outputs
-    auto process_eyes = [&](const std::vector<EyeSpec>& eye_list, int out_offset,
-                            float angle, float dist_sq, int ch_idx) {
-        for (int e = 0; e < static_cast<int>(eye_list.size()); ++e) {
-            const auto& eye = eye_list[e];
-            float range_sq = eye.max_range * eye.max_range;
-            if (dist_sq > range_sq) continue;
-            if (!angle_in_arc(angle, eye.center_angle, eye.arc_width)) continue;
-
-            int out_idx = out_offset + e * n_channels + ch_idx;
-            float dist = std::sqrt(dist_sq);
-            float signal = 1.0f - (dist / eye.max_range);
-            if (signal > outputs[out_idx]) {
-                outputs[out_idx] = signal;
-            }
-        }
-    };
+    begin_compound(outputs);
 
     // --- Boid channels (Same, Opposite) ---
-    if (same_enabled || opposite_enabled) {
-        // Find max range across all eyes (both tiers) for a single grid query
-        float max_range = 0;
-        for (const auto& eye : cfg.eyes)
-            max_range = std::max(max_range, eye.max_range);
-        for (const auto& eye : cfg.long_range_eyes)
-            max_range = std::max(max_range, eye.max_range);
-
-        std::vector<int> candidates;
-        grid.query(self.body.position, max_range, candidates);
-
-        for (int j : candidates) {
-            if (&boids[j] == &self) continue;
-            if (!boids[j].alive) continue;
-
-            bool is_same_type = (boids[j].type == self.type);
-            int ch_idx;
-            if (is_same_type) {
-                if (!same_enabled) continue;
-                ch_idx = same_ch;
-            } else {
-                if (!opposite_enabled) continue;
-                ch_idx = opposite_ch;
-            }
+    int same_ch, opposite_ch;
+    boid_channels(config, same_ch, opposite_ch);
+    if (same_ch >= 0 || opposite_ch >= 0) {
+        // Single grid query at the max range across all eyes (both tiers)
+        grid.for_each(self.body.position, max_eye_range(), [&](int j) {
+            if (&boids[j] == &self) return;
+            if (!boids[j].alive) return;
+
+            int ch_idx = (boids[j].type == self.type) ? same_ch : opposite_ch;
+            if (ch_idx < 0) return;
 
             Vec2 delta = toroidal_delta(self.body.position, boids[j].body.position,
                                          config.width, config.height);
@@ -227,25 +245,54 @@ void SensorySystem::perceive_compound(const std::vector<Boid>& boids,
             float angle = std::atan2(body_delta.x, body_delta.y);
             float dist_sq = delta.length_squared();
 
-            process_eyes(cfg.eyes, 0, angle, dist_sq, ch_idx);
-            process_eyes(cfg.long_range_eyes, long_range_offset, angle, dist_sq, ch_idx);
-        }
+            see_target(outputs, ch_idx, angle, dist_sq);
+        });
     }
 
+    finish_compound(self, config, food, outputs, rng, food_index);
+}
+
+void SensorySystem::finish_compound(const Boid& self,
+                                     const WorldConfig& config,
+                                     const std::vector<Food>& food,
+                                     float* outputs,
+                                     std::mt19937* rng,
+                                     const FoodStore* food_index,
+                                     float* kernel_scratch) const {
+    const auto& cfg = *eye_config_;
+    int n_channels = static_cast<int>(cfg.channels.size());
+    int n_short_eyes = cfg.short_range_eye_count();
+    int n_long_eyes = cfg.long_range_eye_count();
+
     // --- Food channel ---
-    if (food_enabled) {
-        for (const auto& f : food) {
+    int food_ch = active_channel(cfg, SensorChannel::Food, config);
+    if (food_ch >= 0) {
+        float cos_a = std::cos(self.body.angle);
+        float sin_a = std::sin(self.body.angle);
+        auto visit = [&](const Food& f) {
             Vec2 delta = toroidal_delta(self.body.position, f.position,
                                          config.width, config.height);
+            float dist_sq = delta.length_squared();
+
+            if (kernel_scratch) {
+                Vec2 body{delta.x * cos_a + delta.y * sin_a, delta.y * cos_a - delta.x * sin_a};
+                eye_kernel_->see(kernel_scratch, food_ch, body, dist_sq);
+                return;
+            }
 
             Vec2 body_delta = delta.rotated(-self.body.angle);
             float angle = std::atan2(body_delta.x, body_delta.y);
-            float dist_sq = delta.length_squared();
 
-            process_eyes(cfg.eyes, 0, angle, dist_sq, food_ch);
-            process_eyes(cfg.long_range_eyes, long_range_offset, angle, dist_sq, food_ch);
+            see_target(outputs, food_ch, angle, dist_sq);
+        };
+        if (food_index) {
+            food_index->for_each_near(self.body.position, max_eye_range(),
+                                      [&](int, const Food& f) { visit(f); });
+        } else {
+            for (const auto& f : food) visit(f);
         }
     }
+    if (kernel_scratch) eye_kernel_->write_outputs(kernel_scratch, outputs);
 
     // --- Proprioceptive sensors (appended after both eye tiers) ---
     int proprio_idx = (n_short_eyes + n_long_eyes) * n_channels;
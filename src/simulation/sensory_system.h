@@ -1,5 +1,6 @@
 #pragma once
 
+#include "simulation/eye_kernel.h"
 #include "simulation/sensor.h"
 #include "simulation/vec2.h"
 #include <vector>
@@ -8,6 +9,7 @@
 
 struct Boid;
 struct Food;
+class FoodStore;
 struct WorldConfig;
 class SpatialGrid;
 
@@ -24,19 +26,49 @@ public:
 
     bool is_compound() const { return eye_config_.has_value(); }
     const CompoundEyeConfig& compound_config() const { return *eye_config_; }
+    const EyeKernel& eye_kernel() const { return *eye_kernel_; }
+
+    // Output index of the compound-eye noise sensor, or -1 if there is none.
+    int noise_output_index() const;
 
     // Fill outputs[0..input_count()-1] with sensor readings for boid at self_index.
+    // If food_index is given, food is looked up in nearby cells only; otherwise
+    // every item in `food` is checked.
     void perceive(const std::vector<Boid>& boids,
                   const SpatialGrid& grid,
                   const WorldConfig& config,
                   int self_index,
                   const std::vector<Food>& food,
                   float* outputs,
-                  std::mt19937* rng = nullptr) const;
+                  std::mt19937* rng = nullptr,
+                  const FoodStore* food_index = nullptr) const;
+
+    // Compound-eye evaluation in pieces, for callers that visit neighbours
+    // themselves (World's fused interaction pass). perceive() for a compound
+    // sensor is begin_compound + see_target per visible boid + finish_compound.
+    // Output channel for same-type / other-type boids, or -1 if absent or disabled.
+    void boid_channels(const WorldConfig& config, int& same_ch, int& opposite_ch) const;
+    // Longest eye range across both tiers.
+    float max_eye_range() const;
+    // Zero all outputs.
+    void begin_compound(float* outputs) const;
+    // Feed one target on channel ch_idx at body-frame bearing `angle` and squared distance.
+    void see_target(float* outputs, int ch_idx, float angle, float dist_sq) const;
+    // Food channel and proprioceptive inputs. With kernel_scratch, the food
+    // channel goes through eye_kernel() into the scratch (which may already hold
+    // boid targets), and the scratch is then written to the eye outputs.
+    void finish_compound(const Boid& self,
+                         const WorldConfig& config,
+                         const std::vector<Food>& food,
+                         float* outputs,
+                         std::mt19937* rng,
+                         const FoodStore* food_index,
+                         float* kernel_scratch = nullptr) const;
 
 private:
     std::vector<SensorSpec> specs_;                 // legacy mode
     std::optional<CompoundEyeConfig> eye_config_;   // compound-eye mode
+    std::optional<EyeKernel> eye_kernel_;           // trig-free form of eye_config_
 
     // Legacy path
     float evaluate_sensor(const SensorSpec& spec,
@@ -44,7 +76,8 @@ private:
                           const std::vector<Boid>& boids,
                           const SpatialGrid& grid,
                           const WorldConfig& config,
-                          const std::vector<Food>& food) const;
+                          const std::vector<Food>& food,
+                          const FoodStore* food_index) const;
 
     // Compound-eye path
     void perceive_compound(const std::vector<Boid>& boids,
@@ -53,5 +86,9 @@ private:
                            int self_index,
                            const std::vector<Food>& food,
                            float* outputs,
-                           std::mt19937* rng) const;
+                           std::mt19937* rng,
+                           const FoodStore* food_index) const;
+
+    void process_eyes(const std::vector<EyeSpec>& eye_list, int out_offset,
+                      float angle, float dist_sq, int ch_idx, float* outputs) const;
 };
@@ -10,46 +10,78 @@ SpatialGrid::SpatialGrid(float world_w, float world_h, float cell_size, bool tor
 {
     cols_ = std::max(1, static_cast<int>(std::ceil(world_w / cell_size)));
     rows_ = std::max(1, static_cast<int>(std::ceil(world_h / cell_size)));
-    cells_.resize(cols_ * rows_);
+    offsets_.assign(cols_ * rows_ + 1, 0);
 }
 
-void SpatialGrid::clear() {
-    for (auto& cell : cells_) {
-        cell.clear();
+void SpatialGrid::build(const std::vector<Vec2>& positions, const std::vector<uint8_t>& include) {
+    clear();
+    for (int i = 0; i < static_cast<int>(positions.size()); ++i) {
+        if (include[i]) insert(i, positions[i]);
     }
+    finalize();
+}
+
+void SpatialGrid::clear() {
+    pending_index_.clear();
+    pending_cell_.clear();
+    dirty_ = true;
 }
 
 void SpatialGrid::insert(int boid_index, Vec2 position) {
     int col, row;
     col_row(position, col, row);
-    cells_[cell_index(col, row)].push_back(boid_index);
+    pending_index_.push_back(boid_index);
+    pending_cell_.push_back(cell_index(col, row));
+    dirty_ = true;
+}
+
+// Counting sort of the pending entries into CSR form. Stable, so each cell
+// lists its boids in insertion order.
+void SpatialGrid::finalize() const {
+    if (!dirty_) return;
+
+    std::fill(offsets_.begin(), offsets_.end(), 0);
+    for (int cell : pending_cell_) ++offsets_[cell + 1];
+    for (size_t c = 1; c < offsets_.size(); ++c) offsets_[c] += offsets_[c - 1];
+
+    indices_.resize(pending_index_.size());
+    // Fill using offsets_[cell] as a cursor, then shift back to restore starts
+    for (size_t k = 0; k < pending_index_.size(); ++k) {
+        indices_[offsets_[pending_cell_[k]]++] = pending_index_[k];
+    }
+    for (size_t c = offsets_.size() - 1; c > 0; --c) offsets_[c] = offsets_[c - 1];
+    offsets_[0] = 0;
+
+    dirty_ = false;
 }
 
 void SpatialGrid::query(Vec2 pos, float radius, std::vector<int>& out_indices) const {
+    for_each_cell(pos, radius, [&](std::span<const int> cell) {
+        out_indices.insert(out_indices.end(), cell.begin(), cell.end());
+    });
+}
+
+void SpatialGrid::cell_range(Vec2 pos, float radius, int& c0, int& c1, int& r0, int& r1) const {
     // How many cells in each direction we need to check
     int cell_span = static_cast<int>(std::ceil(radius / cell_size_));
 
     int center_col, center_row;
     col_row(pos, center_col, center_row);
+    c0 = center_col - cell_span;
+    c1 = center_col + cell_span;
+    r0 = center_row - cell_span;
+    r1 = center_row + cell_span;
 
-    for (int dr = -cell_span; dr <= cell_span; ++dr) {
-        for (int dc = -cell_span; dc <= cell_span; ++dc) {
-            int c = center_col + dc;
-            int r = center_row + dr;
-
-            if (toroidal_) {
-                c = wrap_col(c);
-                r = wrap_row(r);
-            } else {
-                // Non-toroidal: skip out-of-bounds cells
-                if (c < 0 || c >= cols_ || r < 0 || r >= rows_) continue;
-            }
-
-            const auto& cell = cells_[cell_index(c, r)];
-            for (int idx : cell) {
-                out_indices.push_back(idx);
-            }
-        }
+    if (toroidal_) {
+        // Never wrap onto a column/row twice
+        if (c1 - c0 + 1 >= cols_) { c0 = 0; c1 = cols_ - 1; }
+        if (r1 - r0 + 1 >= rows_) { r0 = 0; r1 = rows_ - 1; }
+    } else {
+        // Non-toroidal: skip out-of-bounds cells
+        c0 = std::max(c0, 0);
+        c1 = std::min(c1, cols_ - 1);
+        r0 = std::max(r0, 0);
+        r1 = std::min(r1, rows_ - 1);
     }
 }
 
@@ -1,14 +1,53 @@
 #pragma once
 
 #include "simulation/vec2.h"
+#include <cstdint>
+#include <span>
 #include <vector>
 
+// Uniform grid over the world, stored as compressed rows: indices_ holds every
+// boid index sorted by cell, and cell c owns indices_[offsets_[c], offsets_[c+1]).
+// Within a cell, indices keep insertion order: ascending after build(), and
+// in the order insert() was called otherwise.
 class SpatialGrid {
 public:
     SpatialGrid(float world_w, float world_h, float cell_size, bool toroidal);
 
+    // Bulk rebuild: bucket every i with include[i] != 0 by positions[i].
+    void build(const std::vector<Vec2>& positions, const std::vector<uint8_t>& include);
+
+    // Incremental interface. Inserts are sorted into cells on the next query;
+    // call finalize() first if several threads will query concurrently.
     void clear();
     void insert(int boid_index, Vec2 position);
+    void finalize() const;
+
+    // Call fn(std::span<const int>) for each cell overlapping a circle at pos with
+    // given radius. Each cell is visited at most once, even when the circle wraps
+    // all the way around a toroidal world. Callers do their own distance checks.
+    template <typename Fn>
+    void for_each_cell(Vec2 pos, float radius, Fn&& fn) const {
+        if (dirty_) finalize();
+        int c0, c1, r0, r1;
+        cell_range(pos, radius, c0, c1, r0, r1);
+        for (int r = r0; r <= r1; ++r) {
+            int row = (toroidal_ ? wrap_row(r) : r) * cols_;
+            for (int c = c0; c <= c1; ++c) {
+                int cell = row + (toroidal_ ? wrap_col(c) : c);
+                int begin = offsets_[cell];
+                int end = offsets_[cell + 1];
+                if (begin != end) fn(std::span<const int>(indices_.data() + begin, end - begin));
+            }
+        }
+    }
+
+    // Call fn(boid_index) for every boid in cells overlapping the circle.
+    template <typename Fn>
+    void for_each(Vec2 pos, float radius, Fn&& fn) const {
+        for_each_cell(pos, radius, [&](std::span<const int> cell) {
+            for (int idx : cell) fn(idx);
+        });
+    }
 
     // Appends indices of boids in cells overlapping a circle at pos with given radius.
     // Callers must do fine-grained distance checks on the results.
@@ -25,10 +64,19 @@ private:
     float world_w_;
     float world_h_;
     bool toroidal_;
-    std::vector<std::vector<int>> cells_;
+
+    // CSR storage, rebuilt by finalize()
+    mutable std::vector<int> offsets_;   // cols_ * rows_ + 1 entries
+    mutable std::vector<int> indices_;
+    mutable bool dirty_ = false;
+
+    // Pending (index, cell) pairs from insert()/build(), in insertion order
+    std::vector<int> pending_index_;
+    std::vector<int> pending_cell_;
 
     int cell_index(int col, int row) const;
     void col_row(Vec2 pos, int& col, int& row) const;
     int wrap_col(int c) const;
     int wrap_row(int r) const;
+    void cell_range(Vec2 pos, float radius, int& c0, int& c1, int& r0, int& r1) const;
 };
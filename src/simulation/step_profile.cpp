@@ -0,0 +1,34 @@
+#include "simulation/step_profile.h"
+
+const char* step_phase_name(StepPhase phase) {
+    switch (phase) {
+        case StepPhase::Integrate:    return "integrate";
+        case StepPhase::RebuildGrid:  return "rebuild_grid";
+        case StepPhase::Neighbours:   return "neighbours";
+        case StepPhase::Sensors:      return "sensors";
+        case StepPhase::Brains:       return "brains";
+        case StepPhase::DeductEnergy: return "deduct_energy";
+        case StepPhase::FoodEating:   return "food_eating";
+        case StepPhase::Predation:    return "predation";
+        case StepPhase::WriteBack:    return "write_back";
+        case StepPhase::SpawnFood:    return "spawn_food";
+        case StepPhase::Count:        break;
+    }
+    return "unknown";
+}
+
+int64_t StepProfile::total_ns() const {
+    int64_t total = 0;
+    for (int64_t ns : phase_ns) total += ns;
+    return total;
+}
+
+StepProfile& StepProfile::operator+=(const StepProfile& other) {
+    steps += other.steps;
+    boid_steps += other.boid_steps;
+    for (int p = 0; p < STEP_PHASE_COUNT; ++p) phase_ns[p] += other.phase_ns[p];
+    grid_candidates += other.grid_candidates;
+    eye_hits += other.eye_hits;
+    catch_candidates += other.catch_candidates;
+    return *this;
+}
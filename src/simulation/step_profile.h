@@ -0,0 +1,91 @@
+#pragma once
+
+#include "simulation/trace.h"
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+// Per-phase timing and counters for World::step.
+//
+// Only built with the WILDBOIDS_PROFILING CMake option, which defines
+// WILDBOIDS_PROFILING for wildboids_sim and everything that links it.
+// Without it StepProfile still exists, so callers compile either way, but
+// World never touches it and the profiling hooks below expand to nothing.
+// WB_STEP_PHASE also opens a trace span (see trace.h), which is decided at
+// run time in every build.
+
+enum class StepPhase : int {
+    Integrate,
+    RebuildGrid,
+    Neighbours,   // fused pass: shoaling, boid eye channels, catch candidates
+    Sensors,      // food eye channels, proprioception, legacy sensors
+    Brains,
+    DeductEnergy,
+    FoodEating,
+    Predation,
+    WriteBack,
+    SpawnFood,
+    Count
+};
+
+constexpr int STEP_PHASE_COUNT = static_cast<int>(StepPhase::Count);
+
+// Lower-case name, e.g. "rebuild_grid"
+const char* step_phase_name(StepPhase phase);
+
+struct StepProfile {
+#ifdef WILDBOIDS_PROFILING
+    static constexpr bool enabled = true;
+#else
+    static constexpr bool enabled = false;
+#endif
+
+    int64_t steps = 0;
+    int64_t boid_steps = 0;        // boids present, summed over steps
+    std::array<int64_t, STEP_PHASE_COUNT> phase_ns{};
+    int64_t grid_candidates = 0;   // boids visited by neighbour-pass grid queries
+    int64_t eye_hits = 0;          // boids registered by a compound eye channel
+    int64_t catch_candidates = 0;  // prey found in a predator's catch reach
+
+    int64_t total_ns() const;
+    StepProfile& operator+=(const StepProfile& other);
+};
+
+#ifdef WILDBOIDS_PROFILING
+
+// Adds the lifetime of the enclosing scope to a nanosecond total
+class PhaseTimer {
+public:
+    explicit PhaseTimer(int64_t& slot) : slot_(slot), start_(std::chrono::steady_clock::now()) {}
+    PhaseTimer(StepProfile& profile, StepPhase phase)
+        : PhaseTimer(profile.phase_ns[static_cast<int>(phase)]) {}
+    ~PhaseTimer() {
+        slot_ += std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start_).count();
+    }
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+private:
+    int64_t& slot_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+#define WB_PROFILE_PHASE(profile, phase) \
+    PhaseTimer WB_PROFILE_CONCAT_(wb_phase_timer_, __LINE__)((profile), (phase))
+#define WB_PROFILE_ONLY(...) __VA_ARGS__
+
+#else
+
+#define WB_PROFILE_PHASE(profile, phase) ((void)0)
+#define WB_PROFILE_ONLY(...)
+
+#endif
+
+#define WB_PROFILE_CONCAT_INNER_(a, b) a##b
+#define WB_PROFILE_CONCAT_(a, b) WB_PROFILE_CONCAT_INNER_(a, b)
+
+// Time the rest of the enclosing scope as one step phase
+#define WB_STEP_PHASE(profile, phase) \
+    TraceSpan WB_PROFILE_CONCAT_(wb_phase_span_, __LINE__)(step_phase_name(phase), "step"); \
+    WB_PROFILE_PHASE(profile, phase)
@@ -0,0 +1,68 @@
+#include "simulation/thread_pool.h"
+#include "simulation/trace.h"
+#include <algorithm>
+
+ThreadPool::ThreadPool(int threads) {
+    if (threads <= 0) {
+        threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    workers_.reserve(threads - 1);
+    for (int w = 1; w < threads; ++w) {
+        workers_.emplace_back([this, w] { worker_loop(w); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& t : workers_) t.join();
+}
+
+void ThreadPool::run(int n, int grain, Task task, void* ctx) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = task;
+        ctx_ = ctx;
+        n_ = n;
+        grain_ = grain;
+        next_.store(0, std::memory_order_relaxed);
+        active_ = static_cast<int>(workers_.size());
+        ++job_id_;
+    }
+    wake_.notify_all();
+
+    drain(0);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return active_ == 0; });
+}
+
+void ThreadPool::worker_loop(int worker) {
+    set_trace_thread_name("pool worker " + std::to_string(worker));
+    uint64_t seen_job = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&] { return stopping_ || job_id_ != seen_job; });
+            if (stopping_) return;
+            seen_job = job_id_;
+        }
+
+        drain(worker);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--active_ == 0) done_.notify_one();
+    }
+}
+
+void ThreadPool::drain(int worker) {
+    TraceSpan span("parallel_for", "pool");
+    for (;;) {
+        int begin = next_.fetch_add(grain_, std::memory_order_relaxed);
+        if (begin >= n_) return;
+        task_(ctx_, begin, std::min(begin + grain_, n_), worker);
+    }
+}
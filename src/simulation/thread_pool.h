@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Fixed-size worker pool for data-parallel loops.
+// The calling thread takes part in every loop, so a pool of size N starts N-1 workers.
+// Work is handed out in chunks from a shared counter; callers that need
+// deterministic results must only write per-index state inside the loop body.
+class ThreadPool {
+public:
+    // threads <= 0 uses std::thread::hardware_concurrency().
+    explicit ThreadPool(int threads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int size() const { return static_cast<int>(workers_.size()) + 1; }
+
+    // Call fn(begin, end, worker) over [0, n) in chunks of at most `grain` items.
+    // `worker` is in [0, size()) and is stable for the duration of a call, so it can
+    // index per-thread scratch buffers. Blocks until every chunk has run.
+    template <typename Fn>
+    void parallel_for(int n, int grain, Fn&& fn) {
+        if (n <= 0) return;
+        if (grain < 1) grain = 1;
+        if (size() == 1 || n <= grain) {
+            fn(0, n, 0);
+            return;
+        }
+        using F = std::remove_reference_t<Fn>;
+        run(n, grain, [](void* ctx, int begin, int end, int worker) {
+            (*static_cast<F*>(ctx))(begin, end, worker);
+        }, const_cast<void*>(static_cast<const void*>(&fn)));
+    }
+
+private:
+    using Task = void (*)(void* ctx, int begin, int end, int worker);
+
+    void run(int n, int grain, Task task, void* ctx);
+    void worker_loop(int worker);
+    void drain(int worker);
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    uint64_t job_id_ = 0;
+    bool stopping_ = false;
+    int active_ = 0;  // workers still inside the current job
+
+    Task task_ = nullptr;
+    void* ctx_ = nullptr;
+    int n_ = 0;
+    int grain_ = 1;
+    std::atomic<int> next_{0};
+};
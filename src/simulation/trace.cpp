@@ -0,0 +1,187 @@
+#include "simulation/trace.h"
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace trace_detail {
+std::atomic<bool> enabled{false};
+}
+
+namespace {
+
+struct Event {
+    const char* name;
+    const char* category;
+    const char* arg_name;
+    int64_t arg;
+    int64_t start_ns;  // since the trace started
+    int64_t duration_ns;
+};
+
+// One per trace row. Owned by the registry so the events survive the thread;
+// when a thread exits its buffer waits in the registry for the next thread
+// of the same name.
+struct ThreadBuffer {
+    std::mutex mutex;          // uncontended except while flushing
+    std::vector<Event> events;
+    int tid = 0;
+    std::string name;          // as set by set_trace_thread_name, empty if unset
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::ofstream out;
+    std::chrono::steady_clock::time_point origin;
+    std::atomic<uint64_t> session{0};  // bumped by each trace_start
+    bool first_event = true;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    std::vector<ThreadBuffer*> idle;  // buffers of exited threads, free for reuse
+    std::vector<std::pair<int, std::string>> pending_names;  // written on the next flush
+};
+
+Registry& registry() {
+    static Registry r;
+    return r;
+}
+
+// The calling thread's buffer, handed back to the registry when the thread
+// exits so a later thread can carry on in the same row
+struct ThreadSlot {
+    ThreadBuffer* buffer = nullptr;
+    uint64_t session = 0;
+
+    ~ThreadSlot() {
+        if (!buffer) return;
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        if (session == r.session) r.idle.push_back(buffer);
+    }
+};
+
+thread_local ThreadSlot t_slot;
+thread_local std::string t_name;
+
+// Requires r.mutex. An idle buffer of the same name keeps its row; otherwise
+// a new row is opened.
+ThreadBuffer* acquire_buffer(Registry& r, const std::string& name) {
+    for (auto it = r.idle.begin(); it != r.idle.end(); ++it) {
+        if ((*it)->name == name) {
+            ThreadBuffer* buffer = *it;
+            r.idle.erase(it);
+            return buffer;
+        }
+    }
+    auto buffer = std::make_unique<ThreadBuffer>();
+    buffer->tid = static_cast<int>(r.buffers.size()) + 1;
+    buffer->name = name;
+    r.pending_names.emplace_back(buffer->tid,
+                                 name.empty() ? "thread " + std::to_string(buffer->tid) : name);
+    r.buffers.push_back(std::move(buffer));
+    return r.buffers.back().get();
+}
+
+// Append a JSON string literal, escaping what thread names might contain
+void write_string(std::ostream& out, const std::string& s) {
+    out << '"';
+    for (char c : s) {
+        if (c == '"' || c == '\\') out << '\\';
+        if (static_cast<unsigned char>(c) >= 0x20) out << c;
+    }
+    out << '"';
+}
+
+void write_separator(Registry& r) {
+    if (!r.first_event) r.out << ",\n";
+    r.first_event = false;
+}
+
+// Requires r.mutex
+void write_pending(Registry& r) {
+    for (const auto& [tid, name] : r.pending_names) {
+        write_separator(r);
+        r.out << R"({"ph":"M","name":"thread_name","pid":1,"tid":)" << tid << R"(,"args":{"name":)";
+        write_string(r.out, name);
+        r.out << "}}";
+    }
+    r.pending_names.clear();
+
+    std::vector<Event> events;
+    for (auto& buffer : r.buffers) {
+        {
+            std::lock_guard<std::mutex> lock(buffer->mutex);
+            events.swap(buffer->events);
+        }
+        for (const Event& e : events) {
+            write_separator(r);
+            r.out << R"({"ph":"X","pid":1,"tid":)" << buffer->tid
+                  << R"(,"name":")" << e.name << R"(","cat":")" << e.category
+                  << R"(","ts":)" << e.start_ns / 1000 << '.' << (e.start_ns % 1000) / 100
+                  << R"(,"dur":)" << e.duration_ns / 1000 << '.' << (e.duration_ns % 1000) / 100;
+            if (e.arg_name) r.out << R"(,"args":{")" << e.arg_name << R"(":)" << e.arg << '}';
+            r.out << '}';
+        }
+        events.clear();
+    }
+}
+
+} // namespace
+
+void trace_detail::record(const char* name, const char* category, const char* arg_name,
+                          int64_t arg, std::chrono::steady_clock::time_point start,
+                          std::chrono::steady_clock::time_point end) {
+    Registry& r = registry();
+    if (!t_slot.buffer || t_slot.session != r.session.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(r.mutex);
+        if (!enabled.load(std::memory_order_relaxed)) return;
+        t_slot.buffer = acquire_buffer(r, t_name);
+        t_slot.session = r.session;
+    }
+
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+    Event e{name, category, arg_name, arg,
+            duration_cast<nanoseconds>(start - r.origin).count(),
+            duration_cast<nanoseconds>(end - start).count()};
+    std::lock_guard<std::mutex> lock(t_slot.buffer->mutex);
+    t_slot.buffer->events.push_back(e);
+}
+
+void trace_start(const std::string& path) {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    if (trace_detail::enabled.load()) throw std::runtime_error("A trace is already open");
+    r.out.open(path);
+    if (!r.out.is_open()) throw std::runtime_error("Could not create trace file: " + path);
+    r.out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    r.first_event = true;
+    r.buffers.clear();
+    r.idle.clear();
+    r.pending_names.clear();
+    ++r.session;
+    r.origin = std::chrono::steady_clock::now();
+    trace_detail::enabled.store(true);
+}
+
+void trace_flush() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    if (!r.out.is_open()) return;
+    write_pending(r);
+    r.out.flush();
+}
+
+void trace_stop() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    if (!trace_detail::enabled.load()) return;
+    trace_detail::enabled.store(false);
+    write_pending(r);
+    r.out << "\n]}\n";
+    r.out.close();
+}
+
+void set_trace_thread_name(const std::string& name) {
+    t_name = name;
+}
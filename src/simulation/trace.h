@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// Opt-in timeline tracing in the Chrome trace-event format, which
+// chrome://tracing and ui.perfetto.dev both open.
+//
+// Spans are recorded per thread, so parallel loops show up as one row per
+// worker. A thread that exits hands its row to the next thread with the same
+// name, so pools built over and over reuse their workers' rows instead of
+// adding new ones. While no trace is open a span costs one relaxed atomic load.
+//
+//   trace_start("run.json");
+//   { TraceSpan span("generation", "evolution", "gen", gen); ... }
+//   trace_flush();   // optional: write what's buffered so far
+//   trace_stop();
+//
+// Span names and categories must be string literals (or otherwise outlive
+// the trace): only the pointers are stored.
+
+namespace trace_detail {
+extern std::atomic<bool> enabled;
+void record(const char* name, const char* category, const char* arg_name, int64_t arg,
+            std::chrono::steady_clock::time_point start,
+            std::chrono::steady_clock::time_point end);
+}
+
+inline bool trace_enabled() { return trace_detail::enabled.load(std::memory_order_relaxed); }
+
+// Open `path` and start recording. Throws std::runtime_error if a trace is
+// already open or the file can't be created.
+void trace_start(const std::string& path);
+
+// Write every buffered span to the file. Call from one thread at a time;
+// spans may still be recorded concurrently.
+void trace_flush();
+
+// Stop recording, write what's left and close the file. Call once the traced
+// work has finished. Does nothing if no trace is open.
+void trace_stop();
+
+// Name the calling thread's row in the trace (default "thread N"). Call
+// before the thread records its first span.
+void set_trace_thread_name(const std::string& name);
+
+// Records the lifetime of the enclosing scope, or up to end() when a span
+// stops partway through one, with an optional integer argument shown
+// alongside it
+class TraceSpan {
+public:
+    TraceSpan(const char* name, const char* category,
+              const char* arg_name = nullptr, int64_t arg = 0)
+        : name_(name), category_(category), arg_name_(arg_name), arg_(arg),
+          active_(trace_enabled()) {
+        if (active_) start_ = std::chrono::steady_clock::now();
+    }
+    ~TraceSpan() { end(); }
+
+    // Record the span now instead of at the end of the scope
+    void end() {
+        if (active_) {
+            trace_detail::record(name_, category_, arg_name_, arg_, start_,
+                                 std::chrono::steady_clock::now());
+            active_ = false;
+        }
+    }
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    const char* name_;
+    const char* category_;
+    const char* arg_name_;
+    int64_t arg_;
+    bool active_;
+    std::chrono::steady_clock::time_point start_;
+};
@@ -1,11 +1,14 @@
 #include "simulation/world.h"
 #include "simulation/sensor.h"
 #include "simulation/toroidal.h"
+#include "simulation/thread_pool.h"
+#include "simulation/rng_stream.h"
 #include <cmath>
 #include <algorithm>
 
-World::World(const WorldConfig& config)
+World::World(const WorldConfig& config, ThreadPool* pool)
     : config_(config)
+    , food_(config.width, config.height, config.grid_cell_size)
     , grid_(config.width, config.height, config.grid_cell_size, config.toroidal)
     , food_source_(UniformFoodSource(UniformFoodConfig{}, 0, 0))  // placeholder
 {
@@ -17,77 +20,409 @@ World::World(const WorldConfig& config)
         uc->energy = config_.food_energy;
     }
     food_source_ = make_food_source(config_.food_source_config, config_.width, config_.height);
+
+    if (pool) {
+        pool_ = pool;
+    } else if (config_.threads != 1) {
+        own_pool_ = std::make_unique<ThreadPool>(config_.threads);
+        pool_ = own_pool_.get();
+    }
+    eye_scratch_.resize(pool_ ? pool_->size() : 1);
+    catch_arena_.resize(pool_ ? pool_->size() : 1);
+    std::visit([&](const auto& source) { food_.reserve(source.capacity()); }, food_source_);
+    brain_scratch_.resize(pool_ ? pool_->size() : 1);
+    WB_PROFILE_ONLY(worker_counters_.resize(pool_ ? pool_->size() : 1);)
+}
+
+World::~World() = default;
+World::World(World&&) noexcept = default;
+World& World::operator=(World&&) noexcept = default;
+
+// Boids per work chunk: small enough to balance dead/alive and brain-size
+// differences across threads, large enough to amortise the shared counter.
+static constexpr int BOID_GRAIN = 32;
+
+template <typename Fn>
+void World::for_each_boid_chunk(Fn&& fn) {
+    int n = static_cast<int>(boids_.size());
+    if (pool_) {
+        pool_->parallel_for(n, BOID_GRAIN, fn);
+    } else {
+        fn(0, n, 0);
+    }
 }
 
+template <typename Fn>
+void World::for_each_boid(Fn&& fn) {
+    for_each_boid_chunk([&](int begin, int end, int worker) {
+        for (int i = begin; i < end; ++i) fn(i, worker);
+    });
+}
+
+#ifdef WILDBOIDS_PROFILING
+// The neighbour pass reads the clock once per chunk, and times the sensor
+// stage of one boid in this many to estimate the stage's share
+static constexpr int SENSOR_SAMPLE_STRIDE = 8;
+#endif
+
 void World::add_boid(Boid boid) {
     boids_.push_back(std::move(boid));
+    store_.push_back(boids_.back());
+    catch_lists_.emplace_back();
+    brain_jobs_dirty_ = true;
+    const auto& added = boids_.back();
+
+    uint8_t type = store_.type_id.back();
+    if (alive_by_type_.size() <= type) alive_by_type_.resize(type + 1, 0);
+    if (added.alive) ++alive_by_type_[type];
+    death_tick_.push_back(added.alive ? -1 : ticks_);
+    if (added.sensors && added.sensors->noise_output_index() >= 0) ++noise_sensor_boids_;
+
+    // Any worker may evaluate this boid's eyes, so every worker's scratch must fit them
+    if (added.sensors && added.sensors->is_compound()) {
+        size_t need = added.sensors->eye_kernel().scratch_size();
+        for (auto& scratch : eye_scratch_) scratch.reserve(need);
+    }
 }
 
 void World::add_food(Food food) {
-    food_.push_back(food);
+    food_.add(food);
 }
 
 void World::step(float dt, std::mt19937* rng) {
-    for (auto& boid : boids_) {
-        float drag = (boid.effective_linear_drag >= 0.0f)
-                     ? boid.effective_linear_drag
-                     : config_.linear_drag;
-        boid.step(dt, drag, config_.angular_drag);
-        if (config_.toroidal) {
-            wrap_position(boid.body.position);
-        }
-    }
+    TraceSpan span("step", "world");
+    if (store_types_dirty_) refresh_boid_metadata();
 
+    integrate(dt);
     rebuild_grid();
-    compute_shoaling();
-    run_sensors(rng);
+    interact(rng);
     run_brains();
     deduct_energy(dt);
     check_food_eating();
     check_predation();
+    write_back_store();
 
     if (rng) {
         spawn_food(dt, *rng);
     }
+    ++ticks_;
+    WB_PROFILE_ONLY(++profile_.steps; profile_.boid_steps += static_cast<int64_t>(boids_.size());)
 }
 
 void World::pre_seed_food(std::mt19937& rng) {
     std::visit([&](auto& source) {
-        source.pre_seed(food_, rng);
+        source.pre_seed(food_.append_target(), rng);
     }, food_source_);
+    food_.index_appended();
 }
 
-void World::run_sensors(std::mt19937* rng) {
+// Physics integration. Walks the full Boid objects (thrusters live there) and
+// refreshes the store's copy of each boid's hot fields on the way past.
+void World::integrate(float dt) {
+    WB_STEP_PHASE(profile_, StepPhase::Integrate);
+    for_each_boid([&](int i, int) {
+        auto& boid = boids_[i];
+        float drag = (boid.effective_linear_drag >= 0.0f)
+                     ? boid.effective_linear_drag
+                     : config_.linear_drag;
+        boid.step(dt, drag, config_.angular_drag);
+        if (config_.toroidal) {
+            wrap_position(boid.body.position);
+        }
+        store_.load(i, boid);
+    });
+}
+
+// Full refresh of the store from the boid list (outside of step()).
+void World::sync_store() {
+    if (store_types_dirty_) refresh_boid_metadata();
     for (int i = 0; i < static_cast<int>(boids_.size()); ++i) {
+        store_.load(i, boids_[i]);
+    }
+}
+
+// Re-derive per-boid data that only changes when boids are edited externally.
+void World::refresh_boid_metadata() {
+    store_.reload_types(boids_);
+    noise_sensor_boids_ = 0;
+    std::fill(alive_by_type_.begin(), alive_by_type_.end(), 0);
+    for (int i = 0; i < static_cast<int>(boids_.size()); ++i) {
+        const auto& boid = boids_[i];
+        if (boid.sensors && boid.sensors->noise_output_index() >= 0) ++noise_sensor_boids_;
+
+        // Boids may have been killed or revived by hand
+        uint8_t type = store_.type_id[i];
+        if (alive_by_type_.size() <= type) alive_by_type_.resize(type + 1, 0);
+        if (boid.alive) {
+            ++alive_by_type_[type];
+            death_tick_[i] = -1;
+        } else if (death_tick_[i] < 0) {
+            death_tick_[i] = ticks_;
+        }
+    }
+    store_types_dirty_ = false;
+}
+
+// Publish energy/alive changes made by the hot phases back to the Boid objects.
+void World::write_back_store() {
+    WB_STEP_PHASE(profile_, StepPhase::WriteBack);
+    for (int i = 0; i < static_cast<int>(boids_.size()); ++i) {
+        store_.store(i, boids_[i]);
+    }
+}
+
+// Fused neighbour pass. Each living boid visits its grid neighbourhood once,
+// at the widest radius any consumer needs, and the pair's delta, distance and
+// bearing are computed once and shared by:
+//   - shoaling (same-type neighbours in the forward arc -> effective drag)
+//   - compound-eye Same/Opposite channels
+//   - predation (prey within catch reach become catch candidates, applied
+//     later by check_predation once energy deaths are known)
+// Each boid only writes its own state, so this runs across the pool.
+void World::interact(std::mt19937* rng) {
+    // Noise sensors draw from per-boid counter streams keyed by one value from the
+    // shared generator, so the readings do not depend on which thread runs a boid.
+    TraceSpan span("neighbours+sensors", "step");
+    bool draw_noise = rng && noise_sensor_boids_ > 0;
+    uint64_t noise_seed = draw_noise ? (*rng)() : 0;
+
+    const auto& pos = store_.position;
+    float catch_radius_sq = config_.predator_catch_radius * config_.predator_catch_radius;
+
+    // Arenas start at one entry per boid, enough for any tick in which no prey
+    // is in reach of more than one predator
+    for (auto& arena : catch_arena_) {
+        arena.clear();
+        arena.reserve(boids_.size());
+    }
+
+#ifdef WILDBOIDS_PROFILING
+    auto pass_start = std::chrono::steady_clock::now();
+    for (auto& counters : worker_counters_) counters = {};
+#endif
+
+    auto visit = [&](int i, int worker) {
+        WB_PROFILE_ONLY(WorkerCounters& counters = worker_counters_[worker];)
         auto& boid = boids_[i];
-        if (!boid.alive) continue;
-        if (!boid.sensors) continue;
-        boid.sensor_outputs.resize(boid.sensors->input_count());
-        boid.sensors->perceive(boids_, grid_, config_, i, food_,
-                               boid.sensor_outputs.data(), rng);
+        auto& arena = catch_arena_[worker];
+        CatchList& catches = catch_lists_[i];
+        catches = {worker, static_cast<int>(arena.size()), 0};
+        if (!store_.alive[i]) {
+            boid.effective_linear_drag = config_.linear_drag;
+            return;
+        }
+
+        uint8_t type = store_.type_id[i];
+        const auto& shoal_cfg = (type == TYPE_PREDATOR)
+                                ? config_.predator_shoaling
+                                : config_.prey_shoaling;
+        bool shoal = shoal_cfg.radius > 0.0f;
+        bool hunt = (type == TYPE_PREDATOR);
+
+        const SensorySystem* eyes = (boid.sensors && boid.sensors->is_compound())
+                                    ? &*boid.sensors : nullptr;
+        float* outputs = nullptr;
+        int same_ch = -1, opposite_ch = -1;
+        if (boid.sensors) {
+            boid.sensor_outputs.resize(boid.sensors->input_count());
+            outputs = boid.sensor_outputs.data();
+        }
+        float* scratch = nullptr;  // EyeKernel accumulators when the fast kernel is on
+        if (eyes) {
+            eyes->begin_compound(outputs);
+            eyes->boid_channels(config_, same_ch, opposite_ch);
+            if (config_.fast_eye_kernel) {
+                auto& buf = eye_scratch_[worker];
+                buf.assign(eyes->eye_kernel().scratch_size(), 0.0f);
+                scratch = buf.data();
+            }
+        }
+        bool see = same_ch >= 0 || opposite_ch >= 0;
+
+        float radius = 0.0f;
+        if (shoal) radius = std::max(radius, shoal_cfg.radius);
+        if (see) radius = std::max(radius, eyes->max_eye_range());
+        if (hunt) radius = std::max(radius, config_.predator_catch_radius);
+
+        float shoal_radius_sq = shoal_cfg.radius * shoal_cfg.radius;
+        float angle_i = store_.angle[i];
+        float cos_i = scratch ? std::cos(angle_i) : 1.0f;
+        float sin_i = scratch ? std::sin(angle_i) : 0.0f;
+        int shoal_count = 0;
+
+        if (shoal || see || hunt) {
+            grid_.for_each(pos[i], radius, [&](int j) {
+                if (j == i) return;
+                if (!store_.alive[j]) return;
+                WB_PROFILE_ONLY(++counters.grid_candidates;)
+                bool same_type = (store_.type_id[j] == type);
+
+                // Eyes always measure toroidal distance; shoaling and predation
+                // only wrap in a toroidal world.
+                Vec2 wrapped = toroidal_delta(pos[i], pos[j], config_.width, config_.height);
+                Vec2 delta = config_.toroidal ? wrapped : pos[j] - pos[i];
+                float dist_sq = delta.length_squared();
+
+                bool have_bearing = false;
+                float bearing = 0.0f;
+                auto body_bearing = [&]() {
+                    if (!have_bearing) {
+                        Vec2 body_delta = delta.rotated(-angle_i);
+                        bearing = std::atan2(body_delta.x, body_delta.y);
+                        have_bearing = true;
+                    }
+                    return bearing;
+                };
+
+                // Shoaling: only count neighbours within the forward arc
+                if (shoal && same_type && dist_sq <= shoal_radius_sq) {
+                    if (shoal_cfg.arc >= 6.28f ||  // skip if full circle (2π)
+                        angle_in_arc(body_bearing(), 0.0f, shoal_cfg.arc)) {
+                        ++shoal_count;
+                    }
+                }
+
+                if (hunt && store_.type_id[j] == TYPE_PREY && dist_sq <= catch_radius_sq) {
+                    bool in_mouth = true;
+                    if (config_.mouth_enabled) {
+                        in_mouth = angle_in_arc(body_bearing(), 0.0f, config_.mouth_arc_width) &&
+                                   (!config_.mouth_require_approach ||
+                                    delta.dot(store_.velocity[i]) > 0.0f);
+                    }
+                    if (in_mouth) {
+                        arena.push_back(j);
+                        ++catches.count;
+                        WB_PROFILE_ONLY(++counters.catch_candidates;)
+                    }
+                }
+
+                int ch_idx = same_type ? same_ch : opposite_ch;
+                WB_PROFILE_ONLY(if (ch_idx >= 0) ++counters.eye_hits;)
+                if (ch_idx >= 0 && scratch) {
+                    Vec2 body{wrapped.x * cos_i + wrapped.y * sin_i,
+                              wrapped.y * cos_i - wrapped.x * sin_i};
+                    eyes->eye_kernel().see(scratch, ch_idx, body, wrapped.length_squared());
+                } else if (ch_idx >= 0) {
+                    if (config_.toroidal) {
+                        eyes->see_target(outputs, ch_idx, body_bearing(), dist_sq);
+                    } else {
+                        Vec2 body_delta = wrapped.rotated(-angle_i);
+                        eyes->see_target(outputs, ch_idx,
+                                         std::atan2(body_delta.x, body_delta.y),
+                                         wrapped.length_squared());
+                    }
+                }
+            });
+        }
+
+        if (shoal) {
+            float fraction = static_cast<float>(std::min(shoal_count, shoal_cfg.max_neighbours))
+                           / static_cast<float>(shoal_cfg.max_neighbours);
+            boid.effective_linear_drag = config_.linear_drag * (1.0f - shoal_cfg.max_reduction * fraction);
+        } else {
+            boid.effective_linear_drag = config_.linear_drag;
+        }
+
+        // Remaining sensor inputs (food, proprioception) — after shoaling, which
+        // the shoaling sensor reads
+        if (!boid.sensors) return;
+#ifdef WILDBOIDS_PROFILING
+        bool sample_sensors = i % SENSOR_SAMPLE_STRIDE == 0;
+        auto sensor_start = sample_sensors ? std::chrono::steady_clock::now()
+                                           : std::chrono::steady_clock::time_point{};
+#endif
+        if (eyes) {
+            eyes->finish_compound(boid, config_, food_.items(), outputs, nullptr, &food_, scratch);
+        } else {
+            boid.sensors->perceive(boids_, grid_, config_, i, food_.items(),
+                                   outputs, nullptr, &food_);
+        }
+        if (draw_noise) {
+            int noise_idx = boid.sensors->noise_output_index();
+            if (noise_idx >= 0) {
+                outputs[noise_idx] = stream_uniform(noise_seed, i, -1.0f, 1.0f);
+            }
+        }
+#ifdef WILDBOIDS_PROFILING
+        if (sample_sensors) {
+            counters.sensor_ns += SENSOR_SAMPLE_STRIDE *
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - sensor_start).count();
+        }
+#endif
+    };
+
+    for_each_boid_chunk([&](int begin, int end, int worker) {
+        WB_PROFILE_ONLY(PhaseTimer chunk_timer(worker_counters_[worker].boid_ns);)
+        for (int i = begin; i < end; ++i) visit(i, worker);
+    });
+
+#ifdef WILDBOIDS_PROFILING
+    // Share the pass's wall time between its two stages in proportion to the
+    // time the workers spent in each (the sensor time is a sampled estimate,
+    // so clamp it to the chunks' total)
+    int64_t pass_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - pass_start).count();
+    WorkerCounters sum;
+    for (const auto& c : worker_counters_) {
+        sum.boid_ns += c.boid_ns;
+        sum.sensor_ns += c.sensor_ns;
+        sum.grid_candidates += c.grid_candidates;
+        sum.eye_hits += c.eye_hits;
+        sum.catch_candidates += c.catch_candidates;
     }
+    int64_t sensors_ns = sum.boid_ns > 0
+        ? static_cast<int64_t>(static_cast<double>(pass_ns) *
+                               std::min(sum.sensor_ns, sum.boid_ns) / sum.boid_ns)
+        : 0;
+    profile_.phase_ns[static_cast<int>(StepPhase::Neighbours)] += pass_ns - sensors_ns;
+    profile_.phase_ns[static_cast<int>(StepPhase::Sensors)] += sensors_ns;
+    profile_.grid_candidates += sum.grid_candidates;
+    profile_.eye_hits += sum.eye_hits;
+    profile_.catch_candidates += sum.catch_candidates;
+#endif
 }
 
 void World::refresh_sensors(int boid_index, std::mt19937* rng) {
+    sync_store();
     rebuild_grid();
     if (boid_index >= 0 && boid_index < static_cast<int>(boids_.size())) {
         auto& boid = boids_[boid_index];
         if (boid.alive && boid.sensors) {
             boid.sensor_outputs.resize(boid.sensors->input_count());
-            boid.sensors->perceive(boids_, grid_, config_, boid_index, food_,
-                                   boid.sensor_outputs.data(), rng);
+            boid.sensors->perceive(boids_, grid_, config_, boid_index, food_.items(),
+                                   boid.sensor_outputs.data(), rng, &food_);
         }
     }
 }
 
+int World::alive_count(uint8_t type_id) const {
+    return type_id < alive_by_type_.size() ? alive_by_type_[type_id] : 0;
+}
+
+int World::survival_ticks(int boid_index) const {
+    int died = death_tick_[boid_index];
+    return died >= 0 ? died : ticks_;
+}
+
 const std::vector<Boid>& World::get_boids() const {
     return boids_;
 }
 
 std::vector<Boid>& World::get_boids_mut() {
+    // Callers may change types; re-intern them before the next step.
+    store_types_dirty_ = true;
+    brain_jobs_dirty_ = true;
     return boids_;
 }
 
+void World::set_thruster_power(int boid_index, int thruster_index, float power) {
+    if (boid_index < 0 || boid_index >= static_cast<int>(boids_.size())) return;
+    auto& thrusters = boids_[boid_index].thrusters;
+    if (thruster_index < 0 || thruster_index >= static_cast<int>(thrusters.size())) return;
+    thrusters[thruster_index].power = power;
+}
+
 const WorldConfig& World::get_config() const {
     return config_;
 }
@@ -104,210 +439,266 @@ void World::wrap_position(Vec2& pos) const {
     if (pos.y < 0) pos.y += config_.height;
 }
 
-void World::run_brains() {
-    for (auto& boid : boids_) {
-        if (!boid.alive) continue;
-        if (!boid.brain) continue;
-
-        int n_in = static_cast<int>(boid.sensor_outputs.size());
-        int n_out = static_cast<int>(boid.thrusters.size());
-
-        // Allocate thruster commands buffer
-        std::vector<float> commands(n_out);
-        boid.brain->activate(boid.sensor_outputs.data(), n_in,
-                             commands.data(), n_out);
-
-        // Map network outputs [0,1] directly to thruster power [0,1]
-        for (int i = 0; i < n_out; ++i) {
-            boid.thrusters[i].power = commands[i];
+// Boids per batched brain evaluation, and the fewest boids sharing a tape
+// that are worth batching.
+static constexpr int BRAIN_BATCH = 64;
+static constexpr int BRAIN_BATCH_MIN = 4;
+
+// Group boids by shared NetworkTape. Rebuilt only when boids are added or
+// handed out mutably (brains may have been swapped).
+void World::plan_brain_jobs() {
+    brain_order_.clear();
+    brain_jobs_.clear();
+
+    std::vector<const NetworkTape*> tapes;               // first-seen order
+    std::vector<std::vector<int>> members;
+    std::vector<int> solo;
+    for (int b = 0; b < static_cast<int>(boids_.size()); ++b) {
+        if (!boids_[b].brain) continue;
+        auto* compiled = dynamic_cast<CompiledNetwork*>(boids_[b].brain.get());
+        if (!compiled) {
+            solo.push_back(b);
+            continue;
+        }
+        const NetworkTape* tape = &compiled->tape();
+        auto it = std::find(tapes.begin(), tapes.end(), tape);
+        if (it == tapes.end()) {
+            tapes.push_back(tape);
+            members.emplace_back();
+            it = tapes.end() - 1;
         }
+        members[it - tapes.begin()].push_back(b);
     }
-}
 
-void World::rebuild_grid() {
-    grid_.clear();
-    for (int i = 0; i < static_cast<int>(boids_.size()); ++i) {
-        if (boids_[i].alive) {
-            grid_.insert(i, boids_[i].body.position);
+    for (size_t t = 0; t < tapes.size(); ++t) {
+        if (static_cast<int>(members[t].size()) < BRAIN_BATCH_MIN) {
+            solo.insert(solo.end(), members[t].begin(), members[t].end());
+            continue;
+        }
+        for (size_t k = 0; k < members[t].size(); k += BRAIN_BATCH) {
+            int begin = static_cast<int>(brain_order_.size());
+            size_t end = std::min(members[t].size(), k + BRAIN_BATCH);
+            brain_order_.insert(brain_order_.end(), members[t].begin() + k, members[t].begin() + end);
+            brain_jobs_.push_back({tapes[t], begin, static_cast<int>(brain_order_.size())});
         }
     }
-}
 
-void World::compute_shoaling() {
-    // Early exit if both types disabled (radius 0)
-    if (config_.prey_shoaling.radius <= 0.0f &&
-        config_.predator_shoaling.radius <= 0.0f) {
-        // Reset all to world default
-        for (auto& boid : boids_) {
-            boid.effective_linear_drag = config_.linear_drag;
-        }
-        return;
+    std::sort(solo.begin(), solo.end());
+    for (size_t k = 0; k < solo.size(); k += BOID_GRAIN) {
+        int begin = static_cast<int>(brain_order_.size());
+        size_t end = std::min(solo.size(), k + BOID_GRAIN);
+        brain_order_.insert(brain_order_.end(), solo.begin() + k, solo.begin() + end);
+        brain_jobs_.push_back({nullptr, begin, static_cast<int>(brain_order_.size())});
     }
 
-    std::vector<int> candidates;
-    for (int i = 0; i < static_cast<int>(boids_.size()); ++i) {
-        auto& boid = boids_[i];
-        if (!boid.alive) {
-            boid.effective_linear_drag = config_.linear_drag;
-            continue;
+    // Size every worker's scratch for the largest job, since any worker may run it
+    size_t matrix = 0, items = 0, commands = 0;
+    for (const auto& job : brain_jobs_) {
+        size_t job_commands = 0;
+        for (int k = job.begin; k < job.end; ++k) {
+            job_commands += boids_[brain_order_[k]].thrusters.size();
         }
-
-        const auto& shoal_cfg = (boid.type == "predator")
-                                ? config_.predator_shoaling
-                                : config_.prey_shoaling;
-
-        if (shoal_cfg.radius <= 0.0f) {
-            boid.effective_linear_drag = config_.linear_drag;
-            continue;
+        commands = std::max(commands, job_commands);
+        if (job.tape) {
+            size_t count = static_cast<size_t>(job.end - job.begin);
+            matrix = std::max(matrix, count * job.tape->state_size());
+            items = std::max(items, count);
         }
+    }
+    for (auto& scratch : brain_scratch_) {
+        scratch.matrix.reserve(matrix);
+        scratch.items.reserve(items);
+        scratch.commands.reserve(commands);
+    }
 
-        // Query grid for nearby boids
-        candidates.clear();
-        grid_.query(boid.body.position, shoal_cfg.radius, candidates);
-
-        float radius_sq = shoal_cfg.radius * shoal_cfg.radius;
-        int count = 0;
-        for (int j : candidates) {
-            if (j == i) continue;
-            if (!boids_[j].alive) continue;
-            if (boids_[j].type != boid.type) continue;
-
-            Vec2 delta;
-            if (config_.toroidal) {
-                delta = toroidal_delta(boid.body.position, boids_[j].body.position,
-                                       config_.width, config_.height);
-            } else {
-                delta = boids_[j].body.position - boid.body.position;
-            }
-            if (delta.length_squared() > radius_sq) continue;
+    brain_jobs_dirty_ = false;
+}
 
-            // Arc check: only count neighbours within the forward arc
-            if (shoal_cfg.arc < 6.28f) {  // skip if full circle (2π)
-                Vec2 body_delta = delta.rotated(-boid.body.angle);
-                float angle = std::atan2(body_delta.x, body_delta.y);
-                if (!angle_in_arc(angle, 0.0f, shoal_cfg.arc)) continue;
+void World::run_brains() {
+    WB_STEP_PHASE(profile_, StepPhase::Brains);
+    if (brain_jobs_dirty_) plan_brain_jobs();
+
+    // Map network outputs [0,1] directly to thruster power [0,1], and refresh
+    // the thrust total used by deduct_energy()
+    auto apply_commands = [&](int b, const float* commands) {
+        auto& boid = boids_[b];
+        for (int i = 0; i < static_cast<int>(boid.thrusters.size()); ++i) {
+            boid.thrusters[i].power = commands[i];
+        }
+        store_.thrust[b] = boid.total_thrust();
+    };
+
+    auto run_job = [&](int j, int worker) {
+        const BrainJob& job = brain_jobs_[j];
+        BrainScratch& scratch = brain_scratch_[worker];
+
+        if (!job.tape) {
+            for (int k = job.begin; k < job.end; ++k) {
+                int b = brain_order_[k];
+                auto& boid = boids_[b];
+                if (!boid.alive) continue;
+                int n_in = static_cast<int>(boid.sensor_outputs.size());
+                int n_out = static_cast<int>(boid.thrusters.size());
+                scratch.commands.resize(n_out);
+                boid.brain->activate(boid.sensor_outputs.data(), n_in,
+                                     scratch.commands.data(), n_out);
+                apply_commands(b, scratch.commands.data());
             }
-            ++count;
+            return;
         }
 
-        float fraction = static_cast<float>(std::min(count, shoal_cfg.max_neighbours))
-                       / static_cast<float>(shoal_cfg.max_neighbours);
-        boid.effective_linear_drag = config_.linear_drag * (1.0f - shoal_cfg.max_reduction * fraction);
+        // Batched: command rows are laid out back to back in scratch.commands
+        scratch.items.clear();
+        int total_out = 0;
+        for (int k = job.begin; k < job.end; ++k) {
+            const auto& boid = boids_[brain_order_[k]];
+            if (boid.alive) total_out += static_cast<int>(boid.thrusters.size());
+        }
+        scratch.commands.resize(total_out);
+        int offset = 0;
+        for (int k = job.begin; k < job.end; ++k) {
+            auto& boid = boids_[brain_order_[k]];
+            if (!boid.alive) continue;
+            auto* net = static_cast<CompiledNetwork*>(boid.brain.get());
+            int n_out = static_cast<int>(boid.thrusters.size());
+            scratch.items.push_back({net->state(), boid.sensor_outputs.data(),
+                                     static_cast<int>(boid.sensor_outputs.size()),
+                                     scratch.commands.data() + offset, n_out});
+            offset += n_out;
+        }
+        job.tape->activate_batch(scratch.items.data(), static_cast<int>(scratch.items.size()),
+                                 scratch.matrix);
+        offset = 0;
+        for (int k = job.begin; k < job.end; ++k) {
+            int b = brain_order_[k];
+            if (!boids_[b].alive) continue;
+            apply_commands(b, scratch.commands.data() + offset);
+            offset += static_cast<int>(boids_[b].thrusters.size());
+        }
+    };
+
+    int n_jobs = static_cast<int>(brain_jobs_.size());
+    if (pool_) {
+        pool_->parallel_for(n_jobs, 1, [&](int begin, int end, int worker) {
+            for (int j = begin; j < end; ++j) run_job(j, worker);
+        });
+    } else {
+        for (int j = 0; j < n_jobs; ++j) run_job(j, 0);
     }
 }
 
+void World::rebuild_grid() {
+    WB_STEP_PHASE(profile_, StepPhase::RebuildGrid);
+    grid_.build(store_.position, store_.alive);
+}
+
 const std::vector<Food>& World::get_food() const {
-    return food_;
+    return food_.items();
 }
 
 void World::spawn_food(float dt, std::mt19937& rng) {
+    WB_STEP_PHASE(profile_, StepPhase::SpawnFood);
     std::visit([&](auto& source) {
-        source.spawn(food_, dt, rng);
+        source.spawn(food_.append_target(), dt, rng);
     }, food_source_);
+    food_.index_appended();
 }
 
+// Apply the catch candidates gathered by interact(). Predators act in index
+// order; a candidate is skipped if it (or the predator) died since.
 void World::check_predation() {
-    float catch_radius_sq = config_.predator_catch_radius * config_.predator_catch_radius;
+    WB_STEP_PHASE(profile_, StepPhase::Predation);
+    for (int p = 0; p < store_.size(); ++p) {
+        if (!store_.alive[p]) continue;
+        if (store_.type_id[p] != TYPE_PREDATOR) continue;
 
-    for (auto& predator : boids_) {
-        if (!predator.alive) continue;
-        if (predator.type != "predator") continue;
+        const CatchList& catches = catch_lists_[p];
+        const int* candidates = catch_arena_[catches.worker].data() + catches.begin;
+        for (int k = 0; k < catches.count; ++k) {
+            int q = candidates[k];
+            if (!store_.alive[q]) continue;
 
-        for (auto& prey : boids_) {
-            if (!prey.alive) continue;
-            if (prey.type != "prey") continue;
+            kill(q);  // prey dies
 
+            // Predator gains energy
+            store_.energy[p] += config_.predator_catch_energy;
+            store_.energy_gained[p] += config_.predator_catch_energy;
+        }
+    }
+}
+
+void World::check_food_eating() {
+    WB_STEP_PHASE(profile_, StepPhase::FoodEating);
+    float eat_radius_sq = config_.food_eat_radius * config_.food_eat_radius;
+
+    for (int i = 0; i < store_.size(); ++i) {
+        if (!store_.alive[i]) continue;
+        if (store_.type_id[i] == TYPE_PREDATOR) continue;  // predators don't eat food
+
+        Vec2 pos = store_.position[i];
+        eaten_scratch_.clear();
+        food_.for_each_near(pos, config_.food_eat_radius, [&](int slot, const Food& f) {
             Vec2 delta;
             if (config_.toroidal) {
-                delta = toroidal_delta(predator.body.position, prey.body.position,
+                delta = toroidal_delta(pos, f.position,
                                        config_.width, config_.height);
             } else {
-                delta = prey.body.position - predator.body.position;
+                delta = f.position - pos;
             }
             float dist_sq = delta.length_squared();
 
-            if (dist_sq > catch_radius_sq) continue;
+            if (dist_sq > eat_radius_sq) return;
 
             if (config_.mouth_enabled) {
-                Vec2 body_delta = delta.rotated(-predator.body.angle);
+                Vec2 body_delta = delta.rotated(-store_.angle[i]);
                 float angle = std::atan2(body_delta.x, body_delta.y);
                 if (!angle_in_arc(angle, 0.0f, config_.mouth_arc_width))
-                    continue;
-                if (config_.mouth_require_approach && delta.dot(predator.body.velocity) <= 0.0f)
-                    continue;
+                    return;
+                if (config_.mouth_require_approach && delta.dot(store_.velocity[i]) <= 0.0f)
+                    return;
             }
 
-            // Prey dies
-            prey.alive = false;
-            prey.energy = 0.0f;
-            for (auto& t : prey.thrusters) t.power = 0.0f;
-
-            // Predator gains energy
-            predator.energy += config_.predator_catch_energy;
-            predator.total_energy_gained += config_.predator_catch_energy;
+            eaten_scratch_.push_back(slot);
+        });
+        if (eaten_scratch_.empty()) continue;
+
+        // Credit energy in insertion order so totals match a linear scan exactly
+        std::sort(eaten_scratch_.begin(), eaten_scratch_.end(), [&](int a, int b) {
+            return food_.serial(a) < food_.serial(b);
+        });
+        for (int slot : eaten_scratch_) {
+            float value = food_.at_slot(slot).energy_value;
+            store_.energy[i] += value;
+            store_.energy_gained[i] += value;
+            food_.remove(slot);
         }
     }
 }
 
-void World::check_food_eating() {
-    float eat_radius_sq = config_.food_eat_radius * config_.food_eat_radius;
-
-    for (auto& boid : boids_) {
-        if (!boid.alive) continue;
-        if (boid.type == "predator") continue;  // predators don't eat food
-
-        food_.erase(
-            std::remove_if(food_.begin(), food_.end(),
-                [&](const Food& f) {
-                    Vec2 delta;
-                    if (config_.toroidal) {
-                        delta = toroidal_delta(boid.body.position, f.position,
-                                               config_.width, config_.height);
-                    } else {
-                        delta = f.position - boid.body.position;
-                    }
-                    float dist_sq = delta.length_squared();
-
-                    if (dist_sq > eat_radius_sq) return false;
-
-                    if (config_.mouth_enabled) {
-                        Vec2 body_delta = delta.rotated(-boid.body.angle);
-                        float angle = std::atan2(body_delta.x, body_delta.y);
-                        if (!angle_in_arc(angle, 0.0f, config_.mouth_arc_width))
-                            return false;
-                        if (config_.mouth_require_approach && delta.dot(boid.body.velocity) <= 0.0f)
-                            return false;
-                    }
-
-                    boid.energy += f.energy_value;
-                    boid.total_energy_gained += f.energy_value;
-                    return true;  // remove this food
-                }),
-            food_.end());
-    }
-}
-
 void World::deduct_energy(float dt) {
-    for (auto& boid : boids_) {
-        if (!boid.alive) continue;
+    WB_STEP_PHASE(profile_, StepPhase::DeductEnergy);
+    for (int i = 0; i < store_.size(); ++i) {
+        if (!store_.alive[i]) continue;
 
         // Metabolism cost (per-boid rate overrides world default)
-        float rate = (boid.metabolism_rate >= 0.0f) ? boid.metabolism_rate : config_.metabolism_rate;
+        float rate = (store_.metabolism[i] >= 0.0f) ? store_.metabolism[i] : config_.metabolism_rate;
         float metabolism = rate * dt;
-        boid.energy -= metabolism;
-        boid.total_energy_spent += metabolism;
+        store_.energy[i] -= metabolism;
+        store_.energy_spent[i] += metabolism;
 
         // Thrust cost
-        float thrust_cost = config_.thrust_cost * boid.total_thrust() * dt;
-        boid.energy -= thrust_cost;
-        boid.total_energy_spent += thrust_cost;
-
-        // Death
-        if (boid.energy <= 0.0f) {
-            boid.energy = 0.0f;
-            boid.alive = false;
-            // Zero all thrusters
-            for (auto& t : boid.thrusters) t.power = 0.0f;
-        }
+        float thrust_cost = config_.thrust_cost * store_.thrust[i] * dt;
+        store_.energy[i] -= thrust_cost;
+        store_.energy_spent[i] += thrust_cost;
+
+        if (store_.energy[i] <= 0.0f) kill(i);
     }
 }
+
+void World::kill(int i) {
+    store_.energy[i] = 0.0f;
+    store_.alive[i] = 0;
+    for (auto& t : boids_[i].thrusters) t.power = 0.0f;
+    --alive_by_type_[store_.type_id[i]];
+    death_tick_[i] = ticks_;
+}
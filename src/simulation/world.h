@@ -1,16 +1,18 @@
 #pragma once
 
+#include "brain/compiled_network.h"
 #include "simulation/boid.h"
+#include "simulation/boid_store.h"
 #include "simulation/food_source.h"
+#include "simulation/food_store.h"
 #include "simulation/sensor.h"
 #include "simulation/spatial_grid.h"
+#include "simulation/step_profile.h"
 #include <vector>
 #include <random>
+#include <memory>
 
-struct Food {
-    Vec2 position;
-    float energy_value = 10.0f;
-};
+class ThreadPool;
 
 struct WorldConfig {
     float width = 1000.0f;
@@ -20,6 +22,11 @@ struct WorldConfig {
     float angular_drag = 0.1f;
     float grid_cell_size = 100.0f;
 
+    // Worker threads for the per-boid phases of step() (integration, shoaling,
+    // sensors, brains). 1 = serial, 0 = one per hardware thread.
+    // Results are identical for every thread count.
+    int threads = 1;
+
     // Food (flat fields kept for backward compat with tests)
     float food_spawn_rate = 2.0f;      // new food per second
     int food_max = 100;                 // cap on food count
@@ -62,11 +69,26 @@ struct WorldConfig {
     std::vector<SensorChannel> enabled_channels = {
         SensorChannel::Food, SensorChannel::Same, SensorChannel::Opposite
     };
+
+    // Evaluate compound eyes with the trig-free EyeKernel instead of the exact
+    // atan2 path. Faster; readings agree within the tolerance in eye_kernel.h.
+    bool fast_eye_kernel = false;
+
+    // Activation-function accuracy for brains built by the runners
+    // (see brain/activation.h). Exact keeps runs bit-reproducible.
+    ActivationPrecision brain_activation = ActivationPrecision::Exact;
 };
 
 class World {
 public:
-    explicit World(const WorldConfig& config);
+    // Runs the per-boid phases on `pool` when given (config.threads is then
+    // ignored). The pool must outlive the world and run nothing else during
+    // step(), so several worlds stepping at once each need their own. Without
+    // one the world owns a pool of config.threads workers.
+    explicit World(const WorldConfig& config, ThreadPool* pool = nullptr);
+    ~World();
+    World(World&&) noexcept;
+    World& operator=(World&&) noexcept;
 
     void add_boid(Boid boid);
     void add_food(Food food);
@@ -77,27 +99,108 @@ public:
 
     const std::vector<Boid>& get_boids() const;
     std::vector<Boid>& get_boids_mut();
+    // Set one thruster's power without invalidating the cached type/brain
+    // layout that get_boids_mut() forces a rebuild of. Out-of-range is a no-op.
+    void set_thruster_power(int boid_index, int thruster_index, float power);
+    const BoidStore& boid_store() const { return store_; }
     const WorldConfig& get_config() const;
     const SpatialGrid& grid() const;
     const std::vector<Food>& get_food() const;
 
+    // Living boids of one interned type (TYPE_PREY, TYPE_PREDATOR, ...),
+    // kept current as boids are added and die rather than counted on demand.
+    int alive_count(uint8_t type_id) const;
+
+    // Steps taken so far, and how many of them boid i lived through (the
+    // step it died in doesn't count)
+    int tick_count() const { return ticks_; }
+    int survival_ticks(int boid_index) const;
+
+    // Per-phase timing and counters since construction or the last
+    // reset_profile(). Stays zero unless built with WILDBOIDS_PROFILING.
+    const StepProfile& profile() const { return profile_; }
+    void reset_profile() { profile_ = {}; }
+
     // Rebuild grid and re-run sensors for one boid (used for paused-mode editing)
     void refresh_sensors(int boid_index, std::mt19937* rng = nullptr);
 
 private:
     WorldConfig config_;
     std::vector<Boid> boids_;
-    std::vector<Food> food_;
+    BoidStore store_;               // hot per-boid fields, refreshed every step
+    bool store_types_dirty_ = false; // set when boids are handed out mutably
+    int noise_sensor_boids_ = 0;     // boids whose sensors include a noise input
+    std::vector<int> alive_by_type_; // living boids per type id
+    std::vector<int> death_tick_;    // per boid: tick it died in, -1 while alive
+    int ticks_ = 0;
+    FoodStore food_;
     SpatialGrid grid_;
     FoodSource food_source_;
 
+    std::unique_ptr<ThreadPool> own_pool_;              // when no pool was handed in
+    ThreadPool* pool_ = nullptr;                        // null when running serially
+    std::vector<int> eaten_scratch_;                    // food slots eaten by one boid
+    // Prey in catch reach this tick: each predator's list is a run inside
+    // the arena of the worker that handled it
+    struct CatchList {
+        int worker = 0;
+        int begin = 0;
+        int count = 0;
+    };
+    std::vector<CatchList> catch_lists_;                // per boid
+    std::vector<std::vector<int>> catch_arena_;         // per worker
+    std::vector<std::vector<float>> eye_scratch_;       // per-worker EyeKernel accumulators
+
+    StepProfile profile_;
+    // What each worker saw during the neighbour pass (profiling builds only).
+    // Chunk time and a sampled estimate of the sensor stage's time let the
+    // pass's wall time be shared between the Neighbours and Sensors phases.
+    // One cache line each, so workers don't contend on them.
+    struct alignas(64) WorkerCounters {
+        int64_t boid_ns = 0;    // whole chunks
+        int64_t sensor_ns = 0;  // estimated from every SENSOR_SAMPLE_STRIDE-th boid
+        int64_t grid_candidates = 0;
+        int64_t eye_hits = 0;
+        int64_t catch_candidates = 0;
+    };
+    std::vector<WorkerCounters> worker_counters_;
+
+    // Brain evaluation plan. Boids whose CompiledNetworks share a tape are
+    // evaluated in batches; every other brain runs on its own.
+    struct BrainJob {
+        const NetworkTape* tape;  // shared tape, or null for a run of solo brains
+        int begin;                // range into brain_order_
+        int end;
+    };
+    struct BrainScratch {
+        std::vector<float> matrix;                     // NetworkTape batch state
+        std::vector<NetworkTape::BatchItem> items;
+        std::vector<float> commands;                   // thruster commands
+    };
+    std::vector<int> brain_order_;
+    std::vector<BrainJob> brain_jobs_;
+    bool brain_jobs_dirty_ = true;
+    std::vector<BrainScratch> brain_scratch_;          // per worker
+
+    // Run fn(boid_index, worker) for every boid, across the pool if there is one.
+    template <typename Fn>
+    void for_each_boid(Fn&& fn);
+    // The same, one fn(begin, end, worker) call per chunk of boids
+    template <typename Fn>
+    void for_each_boid_chunk(Fn&& fn);
+
     void wrap_position(Vec2& pos) const;
+    void integrate(float dt);
+    void sync_store();
+    void refresh_boid_metadata();
+    void write_back_store();
     void rebuild_grid();
-    void run_sensors(std::mt19937* rng);
+    void interact(std::mt19937* rng);
+    void plan_brain_jobs();
     void run_brains();
     void spawn_food(float dt, std::mt19937& rng);
     void check_food_eating();
     void check_predation();
+    void kill(int i);
     void deduct_energy(float dt);
-    void compute_shoaling();
 };
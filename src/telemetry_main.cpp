@@ -0,0 +1,58 @@
+#include "io/telemetry.h"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// Export a headless run's telemetry file (--telemetry) as CSV.
+
+static void print_usage(const char* prog) {
+    std::cerr << "Usage: " << prog << " FILE [options]\n"
+              << "  --table NAME       generations (default) or individuals\n"
+              << "  --output PATH      Write CSV to PATH instead of stdout\n"
+              << "  --help             Show this help\n";
+}
+
+int main(int argc, char* argv[]) {
+    std::string input;
+    std::string table = "generations";
+    std::string output;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--help") == 0) {
+            print_usage(argv[0]);
+            return 0;
+        } else if (std::strcmp(argv[i], "--table") == 0 && i + 1 < argc) {
+            table = argv[++i];
+        } else if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else if (input.empty() && argv[i][0] != '-') {
+            input = argv[i];
+        } else {
+            std::cerr << "Unknown option: " << argv[i] << "\n";
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (input.empty()) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    try {
+        if (output.empty()) {
+            export_telemetry_csv(input, table, std::cout);
+        } else {
+            std::ofstream file(output);
+            if (!file.is_open()) {
+                std::cerr << "Could not open file for writing: " << output << "\n";
+                return 1;
+            }
+            export_telemetry_csv(input, table, file);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
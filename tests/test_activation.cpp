@@ -0,0 +1,91 @@
+#include <catch2/catch_test_macros.hpp>
+#include "brain/activation.h"
+#include "brain/compiled_network.h"
+#include "brain/neat_network.h"
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+// The formulas NeatNetwork uses, as the reference for every tier
+static float reference(ActivationFn fn, float x) {
+    switch (fn) {
+        case ActivationFn::Sigmoid: return 1.0f / (1.0f + std::exp(-x));
+        case ActivationFn::Tanh: return std::tanh(x);
+        case ActivationFn::ReLU: return std::max(0.0f, x);
+        case ActivationFn::Linear: return x;
+    }
+    return x;
+}
+
+// Largest absolute error of a tier over a dense sweep of [-lo, hi]
+static float max_error(ActivationFn fn, ActivationPrecision precision, float lo, float hi) {
+    const int n = 200001;
+    std::vector<float> xs(n), v(n);
+    for (int i = 0; i < n; ++i) xs[i] = v[i] = lo + (hi - lo) * static_cast<float>(i) / (n - 1);
+    apply_activation(fn, v.data(), n, precision);
+    float worst = 0.0f;
+    for (int i = 0; i < n; ++i) worst = std::max(worst, std::abs(v[i] - reference(fn, xs[i])));
+    return worst;
+}
+
+TEST_CASE("Activation: exact tier is bit-identical to the reference", "[activation]") {
+    for (auto fn : {ActivationFn::Sigmoid, ActivationFn::Tanh, ActivationFn::ReLU, ActivationFn::Linear}) {
+        CHECK(max_error(fn, ActivationPrecision::Exact, -30.0f, 30.0f) == 0.0f);
+    }
+}
+
+TEST_CASE("Activation: fast tier error bounds", "[activation]") {
+    CHECK(max_error(ActivationFn::Sigmoid, ActivationPrecision::Fast, -30.0f, 30.0f) <= 1e-6f);
+    CHECK(max_error(ActivationFn::Tanh, ActivationPrecision::Fast, -30.0f, 30.0f) <= 1e-6f);
+    CHECK(max_error(ActivationFn::ReLU, ActivationPrecision::Fast, -30.0f, 30.0f) == 0.0f);
+    CHECK(max_error(ActivationFn::Linear, ActivationPrecision::Fast, -30.0f, 30.0f) == 0.0f);
+}
+
+TEST_CASE("Activation: fastest tier error bounds", "[activation]") {
+    CHECK(max_error(ActivationFn::Sigmoid, ActivationPrecision::Fastest, -30.0f, 30.0f) <= 2e-4f);
+    CHECK(max_error(ActivationFn::Tanh, ActivationPrecision::Fastest, -30.0f, 30.0f) <= 2e-4f);
+    CHECK(max_error(ActivationFn::ReLU, ActivationPrecision::Fastest, -30.0f, 30.0f) == 0.0f);
+}
+
+TEST_CASE("Activation: approximate tiers saturate cleanly at extreme inputs", "[activation]") {
+    for (auto p : {ActivationPrecision::Fast, ActivationPrecision::Fastest}) {
+        for (float x : {-1e30f, -500.0f, -88.0f, 88.0f, 500.0f, 1e30f}) {
+            float s = activate(ActivationFn::Sigmoid, x, p);
+            float t = activate(ActivationFn::Tanh, x, p);
+            CHECK(std::isfinite(s));
+            CHECK(std::isfinite(t));
+            CHECK(std::abs(s - reference(ActivationFn::Sigmoid, x)) <= 1e-6f);
+            CHECK(std::abs(t - reference(ActivationFn::Tanh, x)) <= 1e-6f);
+        }
+    }
+}
+
+TEST_CASE("Activation: precision names round-trip and bad names throw", "[activation]") {
+    for (auto p : {ActivationPrecision::Exact, ActivationPrecision::Fast, ActivationPrecision::Fastest}) {
+        CHECK(parse_activation_precision(activation_precision_name(p)) == p);
+    }
+    CHECK_THROWS(parse_activation_precision("approximate"));
+    CHECK_THROWS(parse_activation_precision(""));
+}
+
+TEST_CASE("Activation: fast CompiledNetwork tracks NeatNetwork", "[activation]") {
+    // input -> tanh hidden -> sigmoid output, plus a direct link
+    NeatGenome g({{0, NodeType::Input, ActivationFn::Linear},
+                  {1, NodeType::Input, ActivationFn::Linear},
+                  {2, NodeType::Output, ActivationFn::Sigmoid, 0.2f},
+                  {3, NodeType::Hidden, ActivationFn::Tanh, -0.1f}},
+                 {{1, 0, 3, 1.5f, true, false},
+                  {2, 1, 3, -0.7f, true, false},
+                  {3, 3, 2, 2.0f, true, false},
+                  {4, 0, 2, 0.4f, true, false}});
+    NeatNetwork reference_net(g);
+    CompiledNetwork fast(g, ActivationPrecision::Fast);
+
+    for (int i = 0; i < 50; ++i) {
+        float in[2] = {std::sin(0.3f * i), std::cos(0.7f * i)};
+        float expected = 0.0f, actual = 0.0f;
+        reference_net.activate(in, 2, &expected, 1);
+        fast.activate(in, 2, &actual, 1);
+        CHECK(std::abs(actual - expected) <= 5e-6f);
+    }
+}
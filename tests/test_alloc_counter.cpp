@@ -0,0 +1,94 @@
+#include <catch2/catch_test_macros.hpp>
+#include "simulation/alloc_counter.h"
+#include "brain/compiled_network.h"
+#include "io/boid_spec.h"
+#include "simulation/world.h"
+#include "io/data_path.h"
+#include <filesystem>
+#include <memory>
+#include <random>
+
+static int* volatile g_sink = nullptr;  // keeps test allocations observable
+
+TEST_CASE("AllocationCounter counts operator new calls", "[alloc_counter]") {
+    AllocationCounter counter;
+    CHECK(counter.count() == 0);
+
+    g_sink = new int(3);
+    delete g_sink;
+    g_sink = new int[16];
+    delete[] g_sink;
+    CHECK(counter.count() == 2);
+
+    counter.restart();
+    CHECK(counter.count() == 0);
+}
+
+// Prey with their own brains, predators cloned from one shared tape (the
+// batched brain path), uniform food and shoaling.
+static World make_steady_world(int threads, bool fast_eyes, std::mt19937& rng) {
+    WorldConfig cfg;
+    cfg.width = 800;
+    cfg.height = 800;
+    cfg.threads = threads;
+    cfg.food_max = 80;
+    cfg.food_spawn_rate = 30.0f;
+    cfg.predator_catch_radius = 10.0f;
+    cfg.prey_shoaling.radius = 40.0f;
+    cfg.prey_shoaling.max_reduction = 0.3f;
+    cfg.fast_eye_kernel = fast_eyes;
+    World world(cfg);
+    world.pre_seed_food(rng);
+
+    BoidSpec prey = load_boid_spec(data_path("simple_boid.json"));
+    BoidSpec pred = load_boid_spec(data_path("simple_predator.json"));
+    std::uniform_real_distribution<float> pos(0.0f, 800.0f);
+    std::uniform_real_distribution<float> w(-2.0f, 2.0f);
+
+    int next_innov = 1;
+    NeatGenome pred_genome = NeatGenome::minimal(sensor_input_count(pred),
+                                                 static_cast<int>(pred.thrusters.size()), next_innov);
+    for (size_t c = 0; c < pred_genome.connections().size(); ++c) pred_genome.set_weight(c, w(rng));
+    auto pred_tape = std::make_shared<const NetworkTape>(pred_genome);
+
+    for (int i = 0; i < 200; ++i) {
+        bool is_prey = i < 170;
+        BoidSpec& spec = is_prey ? prey : pred;
+        Boid b = create_boid_from_spec(spec);
+        if (is_prey) {
+            next_innov = 1;
+            NeatGenome g = NeatGenome::minimal(sensor_input_count(spec),
+                                               static_cast<int>(spec.thrusters.size()), next_innov);
+            for (size_t c = 0; c < g.connections().size(); ++c) g.set_weight(c, w(rng));
+            b.brain = std::make_unique<CompiledNetwork>(g);
+        } else {
+            b.brain = std::make_unique<CompiledNetwork>(pred_tape);
+        }
+        b.body.position = {pos(rng), pos(rng)};
+        b.body.angle = w(rng);
+        world.add_boid(std::move(b));
+    }
+    return world;
+}
+
+static void check_steady_state_allocations(int threads, bool fast_eyes) {
+    std::mt19937 rng(17);
+    World world = make_steady_world(threads, fast_eyes, rng);
+    for (int t = 0; t < 120; ++t) world.step(1.0f / 120.0f, &rng);  // warm-up
+
+    AllocationCounter counter;
+    for (int t = 0; t < 240; ++t) world.step(1.0f / 120.0f, &rng);
+    CHECK(counter.count() == 0);
+}
+
+TEST_CASE("World::step does not allocate once warmed up (serial)", "[alloc_counter][world]") {
+    check_steady_state_allocations(1, false);
+}
+
+TEST_CASE("World::step does not allocate once warmed up (4 threads)", "[alloc_counter][world]") {
+    check_steady_state_allocations(4, false);
+}
+
+TEST_CASE("World::step does not allocate with the fast eye kernel", "[alloc_counter][world]") {
+    check_steady_state_allocations(4, true);
+}
@@ -3,22 +3,15 @@
 #include "io/boid_spec.h"
 #include "brain/neat_genome.h"
 #include "brain/neat_network.h"
+#include "brain/compiled_network.h"
 #include "simulation/world.h"
+#include "io/data_path.h"
 #include <filesystem>
 #include <cmath>
+#include <random>
 
 using Catch::Matchers::WithinAbs;
 
-static std::string data_path(const std::string& filename) {
-    for (const auto& prefix : {"data/", "../data/", "../../data/"}) {
-        std::string path = std::string(prefix) + filename;
-        if (std::filesystem::exists(path)) return path;
-    }
-    const char* env = std::getenv("WILDBOIDS_DATA_DIR");
-    if (env) return std::string(env) + "/" + filename;
-    return "data/" + filename;
-}
-
 TEST_CASE("Brain-driven boid: minimal genome gives sigmoid(0) thruster power", "[boid_brain]") {
     BoidSpec spec = load_boid_spec(data_path("simple_boid.json"));
 
@@ -119,7 +112,7 @@ TEST_CASE("Brain responds to sensor input: boid ahead drives thruster output", "
     // input1→out0 is at index n_outputs * 1 = 6
     int same_ch_input = 1; // eye 0, same channel
     int first_output_conn = same_ch_input * n_outputs; // connection to thruster 0
-    genome.connections[first_output_conn].weight = 5.0f;
+    genome.set_weight(first_output_conn, 5.0f);
     spec.genome = genome;
 
     // Boid A at (400, 350) facing forward (+Y)
@@ -164,9 +157,9 @@ TEST_CASE("Full pipeline: brain-driven boid accelerates forward", "[boid_brain]"
 
     // Zero all weights, then give the rear thruster output node a large positive bias
     // Output nodes start at index n_inputs in minimal topology
-    genome.nodes[n_inputs].bias = 5.0f;     // rear thruster
+    genome.set_bias(n_inputs, 5.0f);     // rear thruster
     // Give front thruster (output node n_inputs+3) a large negative bias → power near 0
-    genome.nodes[n_inputs + 3].bias = -5.0f;
+    genome.set_bias(n_inputs + 3, -5.0f);
     spec.genome = genome;
 
     Boid boid = create_boid_from_spec(spec);
@@ -205,3 +198,46 @@ TEST_CASE("Brain-driven boid: spec with genome creates brain automatically", "[b
     Boid boid_with_brain = create_boid_from_spec(spec);
     CHECK(boid_with_brain.brain != nullptr);
 }
+
+TEST_CASE("Boids sharing a compiled tape step identically to separate brains", "[boid_brain]") {
+    BoidSpec spec = load_boid_spec(data_path("simple_boid.json"));
+    int n_inputs = sensor_input_count(spec);
+    int n_outputs = static_cast<int>(spec.thrusters.size());
+    int next_innov = 1;
+    NeatGenome genome = NeatGenome::minimal(n_inputs, n_outputs, next_innov);
+    std::mt19937 wrng(3);
+    std::normal_distribution<float> weight(0.0f, 1.0f);
+    for (size_t c = 0; c < genome.connections().size(); ++c) genome.set_weight(c, weight(wrng));
+    auto tape = std::make_shared<const NetworkTape>(genome);
+
+    auto run = [&](bool shared) {
+        WorldConfig config;
+        config.width = 800;
+        config.height = 800;
+        config.metabolism_rate = 2.0f;  // some boids starve, exercising the dead-boid skip
+        World world(config);
+        std::mt19937 rng(11);
+        std::uniform_real_distribution<float> d(0.0f, 800.0f);
+        for (int i = 0; i < 150; ++i) {
+            Boid boid = create_boid_from_spec(spec);
+            boid.brain = shared ? std::make_unique<CompiledNetwork>(tape)
+                                : std::make_unique<CompiledNetwork>(genome);
+            boid.body.position = {d(rng), d(rng)};
+            boid.body.angle = d(rng);
+            boid.energy = d(rng) * 0.005f;
+            world.add_boid(std::move(boid));
+        }
+        std::mt19937 step_rng(5);
+        for (int t = 0; t < 60; ++t) world.step(1.0f / 120.0f, &step_rng);
+        std::vector<float> state;
+        for (const auto& b : world.get_boids()) {
+            state.push_back(b.body.position.x);
+            state.push_back(b.body.position.y);
+            state.push_back(b.energy);
+            for (const auto& t : b.thrusters) state.push_back(t.power);
+        }
+        return state;
+    };
+
+    CHECK(run(true) == run(false));
+}
@@ -3,25 +3,13 @@
 #include "io/boid_spec.h"
 #include "brain/neat_genome.h"
 #include "brain/neat_network.h"
+#include "io/data_path.h"
 #include <filesystem>
+#include <fstream>
+#include <sstream>
 
 using Catch::Matchers::WithinAbs;
 
-// Tests need to find data/simple_boid.json. CMake runs tests from the build dir,
-// so we locate the project root via the source dir set at configure time.
-// For now, use a relative path that works when running from the project root.
-static std::string data_path(const std::string& filename) {
-    // Try a few common locations
-    for (const auto& prefix : {"data/", "../data/", "../../data/"}) {
-        std::string path = std::string(prefix) + filename;
-        if (std::filesystem::exists(path)) return path;
-    }
-    // Fallback: use WILDBOIDS_DATA_DIR if set via CMake
-    const char* env = std::getenv("WILDBOIDS_DATA_DIR");
-    if (env) return std::string(env) + "/" + filename;
-    return "data/" + filename;
-}
-
 TEST_CASE("Load simple_boid.json", "[boid_spec]") {
     BoidSpec spec = load_boid_spec(data_path("simple_boid.json"));
 
@@ -134,10 +122,10 @@ TEST_CASE("Genome round-trip: save and reload preserves genome", "[boid_spec]")
     int next_innov = 1;
     NeatGenome genome = NeatGenome::minimal(10, 6, next_innov);
     // Set some non-zero weights to verify they round-trip
-    genome.connections[0].weight = 1.5f;
-    genome.connections[3].weight = -0.7f;
-    genome.connections[5].enabled = false;
-    genome.nodes[10].bias = 0.25f; // first output node
+    genome.set_weight(0, 1.5f);
+    genome.set_weight(3, -0.7f);
+    genome.set_enabled(5, false);
+    genome.set_bias(10, 0.25f); // first output node
     spec.genome = genome;
 
     std::string tmp_path = "test_genome_roundtrip.json";
@@ -147,22 +135,22 @@ TEST_CASE("Genome round-trip: save and reload preserves genome", "[boid_spec]")
     REQUIRE(reloaded.genome.has_value());
 
     const auto& rg = *reloaded.genome;
-    REQUIRE(rg.nodes.size() == genome.nodes.size());
-    REQUIRE(rg.connections.size() == genome.connections.size());
-
-    for (size_t i = 0; i < genome.nodes.size(); ++i) {
-        CHECK(rg.nodes[i].id == genome.nodes[i].id);
-        CHECK(rg.nodes[i].type == genome.nodes[i].type);
-        CHECK(rg.nodes[i].activation == genome.nodes[i].activation);
-        CHECK_THAT(rg.nodes[i].bias, WithinAbs(genome.nodes[i].bias, 1e-4f));
+    REQUIRE(rg.nodes().size() == genome.nodes().size());
+    REQUIRE(rg.connections().size() == genome.connections().size());
+
+    for (size_t i = 0; i < genome.nodes().size(); ++i) {
+        CHECK(rg.nodes()[i].id == genome.nodes()[i].id);
+        CHECK(rg.nodes()[i].type == genome.nodes()[i].type);
+        CHECK(rg.nodes()[i].activation == genome.nodes()[i].activation);
+        CHECK_THAT(rg.nodes()[i].bias, WithinAbs(genome.nodes()[i].bias, 1e-4f));
     }
 
-    for (size_t i = 0; i < genome.connections.size(); ++i) {
-        CHECK(rg.connections[i].innovation == genome.connections[i].innovation);
-        CHECK(rg.connections[i].source == genome.connections[i].source);
-        CHECK(rg.connections[i].target == genome.connections[i].target);
-        CHECK_THAT(rg.connections[i].weight, WithinAbs(genome.connections[i].weight, 1e-4f));
-        CHECK(rg.connections[i].enabled == genome.connections[i].enabled);
+    for (size_t i = 0; i < genome.connections().size(); ++i) {
+        CHECK(rg.connections()[i].innovation == genome.connections()[i].innovation);
+        CHECK(rg.connections()[i].source == genome.connections()[i].source);
+        CHECK(rg.connections()[i].target == genome.connections()[i].target);
+        CHECK_THAT(rg.connections()[i].weight, WithinAbs(genome.connections()[i].weight, 1e-4f));
+        CHECK(rg.connections()[i].enabled == genome.connections()[i].enabled);
     }
 
     std::filesystem::remove(tmp_path);
@@ -173,8 +161,8 @@ TEST_CASE("Genome round-trip: network produces identical outputs", "[boid_spec]"
 
     int next_innov = 1;
     NeatGenome genome = NeatGenome::minimal(10, 6, next_innov);
-    genome.connections[0].weight = 2.0f;
-    genome.connections[7].weight = -1.5f;
+    genome.set_weight(0, 2.0f);
+    genome.set_weight(7, -1.5f);
     spec.genome = genome;
 
     std::string tmp_path = "test_genome_net_roundtrip.json";
@@ -352,3 +340,61 @@ TEST_CASE("Loading spec without longRangeEyes gives empty vector", "[boid_spec][
 
     std::filesystem::remove(tmp_path);
 }
+
+static std::string read_file(const std::string& path) {
+    std::ifstream file(path);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+TEST_CASE("Binary spec: JSON to binary and back reproduces the JSON", "[boid_spec][binary]") {
+    for (const char* name : {"simple_boid.json", "simple_predator.json",
+                             "4thruster_foodonly_simple_boid.json"}) {
+        BoidSpec spec = load_boid_spec(data_path(name));
+        int next_innov = 1;
+        NeatGenome genome = NeatGenome::minimal(sensor_input_count(spec),
+                                                static_cast<int>(spec.thrusters.size()), next_innov);
+        std::vector<ConnectionGene> connections(genome.connections().begin(),
+                                                genome.connections().end());
+        connections[0].weight = 1.25f;
+        connections[1].enabled = false;
+        connections[2].recurrent = true;
+        std::vector<NodeGene> nodes(genome.nodes().begin(), genome.nodes().end());
+        nodes.push_back({999, NodeType::Hidden, ActivationFn::Tanh, -0.5f});
+        spec.genome = NeatGenome(nodes, connections);
+        if (spec.compound_eyes.has_value()) {
+            spec.morphology_genome = MorphologyGenome{{{{0.1f, -0.2f}, {0.6f, 0.4f}}}};
+        }
+
+        std::string json_path = "test_binary_spec_a.json";
+        std::string bin_path = "test_binary_spec.wbs";
+        std::string back_path = "test_binary_spec_b.json";
+        save_boid_spec(spec, json_path);
+        BoidSpec from_json = load_boid_spec(json_path);
+        save_boid_spec_binary(from_json, bin_path);
+        CHECK(is_binary_boid_spec(bin_path));
+        CHECK_FALSE(is_binary_boid_spec(json_path));
+
+        // The binary file loads to exactly what the JSON loads to
+        save_boid_spec(from_json, json_path);
+        save_boid_spec(load_boid_spec(bin_path), back_path);
+        CHECK(read_file(back_path) == read_file(json_path));
+
+        std::filesystem::remove(json_path);
+        std::filesystem::remove(bin_path);
+        std::filesystem::remove(back_path);
+    }
+}
+
+TEST_CASE("Binary spec: truncated file throws", "[boid_spec][binary]") {
+    BoidSpec spec = load_boid_spec(data_path("simple_boid.json"));
+    std::string tmp_path = "test_binary_truncated.wbs";
+    save_boid_spec_binary(spec, tmp_path);
+    CHECK(load_boid_spec(tmp_path).thrusters.size() == spec.thrusters.size());
+
+    std::filesystem::resize_file(tmp_path, std::filesystem::file_size(tmp_path) - 1);
+    CHECK_THROWS(load_boid_spec(tmp_path));
+
+    std::filesystem::remove(tmp_path);
+}
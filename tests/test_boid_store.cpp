@@ -0,0 +1,111 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "simulation/boid_store.h"
+#include "simulation/world.h"
+
+using Catch::Matchers::WithinAbs;
+
+static Boid make_boid(const std::string& type, Vec2 pos) {
+    Boid b;
+    b.type = type;
+    b.body.position = pos;
+    b.thrusters.push_back({{0, -0.5f}, {0, 1}, 10.0f, 0.5f});
+    return b;
+}
+
+TEST_CASE("BoidStore interns prey and predator to fixed ids", "[boid_store]") {
+    BoidStore store;
+    store.push_back(make_boid("predator", {0, 0}));
+    store.push_back(make_boid("prey", {0, 0}));
+    store.push_back(make_boid("scavenger", {0, 0}));
+    store.push_back(make_boid("scavenger", {0, 0}));
+
+    CHECK(store.type_id[0] == TYPE_PREDATOR);
+    CHECK(store.type_id[1] == TYPE_PREY);
+    CHECK(store.type_id[2] == store.type_id[3]);
+    CHECK(store.type_id[2] > TYPE_PREDATOR);
+    CHECK(store.type_name(store.type_id[2]) == "scavenger");
+}
+
+TEST_CASE("BoidStore refuses a 257th type instead of wrapping", "[boid_store]") {
+    BoidStore store;
+    for (int t = 2; t < 256; ++t) store.intern_type("type" + std::to_string(t));
+    CHECK(store.intern_type("type255") == 255);
+    CHECK_THROWS(store.intern_type("one_too_many"));
+    CHECK(store.intern_type("prey") == TYPE_PREY);
+}
+
+TEST_CASE("BoidStore copies hot fields from a boid", "[boid_store]") {
+    BoidStore store;
+    Boid b = make_boid("prey", {12, 34});
+    b.body.velocity = {1, 2};
+    b.body.angle = 0.5f;
+    b.energy = 42.0f;
+    b.metabolism_rate = 0.3f;
+    store.push_back(b);
+
+    CHECK_THAT(store.position[0].x, WithinAbs(12.0f, 1e-6f));
+    CHECK_THAT(store.velocity[0].y, WithinAbs(2.0f, 1e-6f));
+    CHECK_THAT(store.angle[0], WithinAbs(0.5f, 1e-6f));
+    CHECK_THAT(store.energy[0], WithinAbs(42.0f, 1e-6f));
+    CHECK_THAT(store.metabolism[0], WithinAbs(0.3f, 1e-6f));
+    CHECK_THAT(store.thrust[0], WithinAbs(5.0f, 1e-6f));  // 0.5 power * 10 max
+    CHECK(store.alive[0] == 1);
+}
+
+TEST_CASE("World keeps get_boids() in sync with the store after a step", "[boid_store][world]") {
+    WorldConfig cfg;
+    cfg.width = 500;
+    cfg.height = 500;
+    cfg.metabolism_rate = 1.0f;
+    cfg.thrust_cost = 0.1f;
+    World world(cfg);
+
+    world.add_boid(make_boid("prey", {100, 100}));
+    world.add_boid(make_boid("predator", {300, 300}));
+
+    for (int t = 0; t < 10; ++t) world.step(0.1f);
+
+    const auto& boids = world.get_boids();
+    const auto& store = world.boid_store();
+    REQUIRE(store.size() == 2);
+    for (int i = 0; i < 2; ++i) {
+        CHECK(store.position[i].x == boids[i].body.position.x);
+        CHECK(store.position[i].y == boids[i].body.position.y);
+        CHECK(store.energy[i] == boids[i].energy);
+        CHECK(store.energy_spent[i] == boids[i].total_energy_spent);
+        CHECK((store.alive[i] != 0) == boids[i].alive);
+    }
+    CHECK(boids[0].energy < 100.0f);
+}
+
+TEST_CASE("Edits through get_boids_mut() are picked up by the next step", "[boid_store][world]") {
+    WorldConfig cfg;
+    cfg.predator_catch_radius = 10.0f;
+    World world(cfg);
+
+    world.add_boid(make_boid("prey", {100, 100}));
+    world.add_boid(make_boid("prey", {104, 100}));
+
+    // Turn the second boid into a predator — it should now catch the first
+    world.get_boids_mut()[1].type = "predator";
+    world.step(0.01f);
+
+    CHECK_FALSE(world.get_boids()[0].alive);
+    CHECK(world.get_boids()[1].total_energy_gained > 0.0f);
+}
+
+TEST_CASE("Dead boids stay dead and keep zero energy", "[boid_store][world]") {
+    WorldConfig cfg;
+    cfg.metabolism_rate = 100.0f;
+    World world(cfg);
+    world.add_boid(make_boid("prey", {100, 100}));
+
+    world.step(1.0f);  // drains all energy in one step
+
+    const auto& b = world.get_boids()[0];
+    CHECK_FALSE(b.alive);
+    CHECK(b.energy == 0.0f);
+    CHECK(b.thrusters[0].power == 0.0f);
+    CHECK(world.boid_store().alive[0] == 0);
+}
@@ -0,0 +1,187 @@
+#include <catch2/catch_test_macros.hpp>
+#include "io/checkpoint.h"
+#include <cmath>
+#include <filesystem>
+
+static constexpr char MAGIC[5] = "TEST";
+
+static PopulationParams small_params() {
+    PopulationParams params;
+    params.population_size = 30;
+    params.add_node_prob = 0.2f;
+    params.add_connection_prob = 0.3f;
+    return params;
+}
+
+static MorphologyEvolutionConfig small_morphology() {
+    MorphologyEvolutionConfig config;
+    config.enabled = true;
+    config.groups = {{4, 360.0f, 100.0f}};
+    return config;
+}
+
+// Fitness that depends only on the genome, so runs can be compared
+static void step(Population& pop) {
+    pop.evaluate([](int, const NeatGenome& g) {
+        float f = static_cast<float>(g.nodes().size());
+        for (const auto& c : g.connections()) f += std::abs(c.weight);
+        return f;
+    });
+    pop.advance_generation();
+}
+
+static void check_same_genomes(const Population& a, const Population& b) {
+    REQUIRE(a.size() == b.size());
+    for (int i = 0; i < a.size(); ++i) {
+        const auto& ga = a.genome(i);
+        const auto& gb = b.genome(i);
+        REQUIRE(ga.nodes().size() == gb.nodes().size());
+        for (size_t k = 0; k < ga.nodes().size(); ++k) {
+            CHECK(ga.nodes()[k].id == gb.nodes()[k].id);
+            CHECK(ga.nodes()[k].type == gb.nodes()[k].type);
+            CHECK(ga.nodes()[k].bias == gb.nodes()[k].bias);
+        }
+        REQUIRE(ga.connections().size() == gb.connections().size());
+        for (size_t k = 0; k < ga.connections().size(); ++k) {
+            CHECK(ga.connections()[k].innovation == gb.connections()[k].innovation);
+            CHECK(ga.connections()[k].source == gb.connections()[k].source);
+            CHECK(ga.connections()[k].target == gb.connections()[k].target);
+            CHECK(ga.connections()[k].weight == gb.connections()[k].weight);
+            CHECK(ga.connections()[k].enabled == gb.connections()[k].enabled);
+        }
+        CHECK(a.morphology(i).groups[0].angles == b.morphology(i).groups[0].angles);
+    }
+}
+
+TEST_CASE("Checkpoint: a restored population carries on identically", "[checkpoint]") {
+    std::string tmp_path = "test_checkpoint_population.bin";
+    int next = 1;
+    NeatGenome seed = NeatGenome::minimal(3, 2, next);
+
+    std::mt19937 rng(7);
+    Population original(seed, small_params(), rng);
+    original.enable_morphology(small_morphology());
+    for (int g = 0; g < 4; ++g) step(original);
+
+    {
+        BinaryWriter out(tmp_path, MAGIC, 1);
+        write_rng(out, rng);
+        write_population(out, original);
+        out.finish();
+    }
+
+    std::mt19937 other_rng(999);
+    Population restored(seed, small_params(), other_rng);
+    restored.enable_morphology(small_morphology());
+    {
+        BinaryReader in(tmp_path, MAGIC);
+        CHECK(in.version() == 1);
+        read_rng(in, other_rng);
+        read_population(in, restored);
+    }
+
+    CHECK(restored.generation() == original.generation());
+    CHECK(restored.species_count() == original.species_count());
+    for (int s = 0; s < original.species_count(); ++s) {
+        CHECK(restored.species()[s].id == original.species()[s].id);
+        CHECK(restored.species()[s].members == original.species()[s].members);
+        CHECK(restored.species()[s].stagnation_count == original.species()[s].stagnation_count);
+    }
+    check_same_genomes(original, restored);
+
+    for (int g = 0; g < 4; ++g) {
+        step(original);
+        step(restored);
+    }
+    CHECK(restored.innovation_tracker().next_innovation() ==
+          original.innovation_tracker().next_innovation());
+    check_same_genomes(original, restored);
+
+    std::filesystem::remove(tmp_path);
+}
+
+TEST_CASE("Checkpoint: an island's innovation class survives a restore", "[checkpoint]") {
+    std::string tmp_path = "test_checkpoint_island.bin";
+    int next = 1;
+    NeatGenome seed = NeatGenome::minimal(3, 2, next);
+
+    std::mt19937 rng(11);
+    Population original(seed, small_params(), rng);
+    original.enable_morphology(small_morphology());
+    original.set_innovation_class(1, 3);
+    for (int g = 0; g < 3; ++g) step(original);
+    {
+        BinaryWriter out(tmp_path, MAGIC, 1);
+        write_rng(out, rng);
+        write_population(out, original);
+        out.finish();
+    }
+
+    std::mt19937 other_rng(999);
+    Population restored(seed, small_params(), other_rng);
+    restored.enable_morphology(small_morphology());
+    restored.set_innovation_class(1, 3);
+    {
+        BinaryReader in(tmp_path, MAGIC);
+        read_rng(in, other_rng);
+        read_population(in, restored);
+    }
+
+    for (int g = 0; g < 3; ++g) {
+        step(original);
+        step(restored);
+    }
+    CHECK(restored.innovation_tracker().next_innovation() % 3 == 1);
+    CHECK(restored.innovation_tracker().next_innovation() ==
+          original.innovation_tracker().next_innovation());
+    check_same_genomes(original, restored);
+
+    std::filesystem::remove(tmp_path);
+}
+
+TEST_CASE("Checkpoint: mismatched population size is rejected", "[checkpoint]") {
+    std::string tmp_path = "test_checkpoint_size.bin";
+    int next = 1;
+    NeatGenome seed = NeatGenome::minimal(3, 2, next);
+    std::mt19937 rng(1);
+    Population pop(seed, small_params(), rng);
+    {
+        BinaryWriter out(tmp_path, MAGIC, 1);
+        write_population(out, pop);
+        out.finish();
+    }
+
+    PopulationParams bigger = small_params();
+    bigger.population_size = 40;
+    Population other(seed, bigger, rng);
+    BinaryReader in(tmp_path, MAGIC);
+    CHECK_THROWS(read_population(in, other));
+    CHECK(other.size() == 40);
+
+    std::filesystem::remove(tmp_path);
+}
+
+TEST_CASE("Checkpoint: bad magic and truncated files throw", "[checkpoint]") {
+    std::string tmp_path = "test_checkpoint_truncated.bin";
+    int next = 1;
+    NeatGenome genome = NeatGenome::minimal(4, 3, next);
+    {
+        BinaryWriter out(tmp_path, MAGIC, 1);
+        write_genome(out, genome);
+        out.finish();
+    }
+
+    CHECK_THROWS(BinaryReader(tmp_path, "NOPE"));
+    {
+        BinaryReader in(tmp_path, MAGIC);
+        NeatGenome loaded = read_genome(in);
+        CHECK(loaded.connections().size() == genome.connections().size());
+    }
+
+    auto size = std::filesystem::file_size(tmp_path);
+    std::filesystem::resize_file(tmp_path, size - 3);
+    BinaryReader in(tmp_path, MAGIC);
+    CHECK_THROWS(read_genome(in));
+
+    std::filesystem::remove(tmp_path);
+}
@@ -0,0 +1,138 @@
+#include <catch2/catch_test_macros.hpp>
+#include "brain/compiled_network.h"
+#include "brain/neat_network.h"
+#include "brain/mutation.h"
+#include <random>
+#include <vector>
+
+// Grow a random genome with hidden nodes, recurrent links, disabled
+// connections and mixed activations.
+static NeatGenome random_genome(int n_in, int n_out, int steps, std::mt19937& rng) {
+    int next_innov = 1;
+    NeatGenome g = NeatGenome::minimal(n_in, n_out, next_innov);
+    InnovationTracker tracker(next_innov);
+    std::uniform_real_distribution<float> u(0.0f, 1.0f);
+    std::uniform_real_distribution<float> w(-2.0f, 2.0f);
+
+    for (int s = 0; s < steps; ++s) {
+        float r = u(rng);
+        if (r < 0.3f) mutate_add_node(g, rng, tracker);
+        else if (r < 0.7f) mutate_add_connection(g, rng, tracker, 20, true);
+        else if (r < 0.8f) mutate_toggle_connection(g, rng);
+        else mutate_weights(g, rng);
+    }
+    // Activations are structural, so the varied genome is rebuilt from its genes
+    std::uniform_int_distribution<int> act(0, 3);
+    std::vector<NodeGene> nodes(g.nodes().begin(), g.nodes().end());
+    for (auto& node : nodes) {
+        if (node.type == NodeType::Input) continue;
+        node.activation = static_cast<ActivationFn>(act(rng));
+        node.bias = w(rng);
+    }
+    std::vector<ConnectionGene> connections(g.connections().begin(), g.connections().end());
+    for (auto& c : connections) c.weight = w(rng);
+    return NeatGenome(nodes, connections);
+}
+
+TEST_CASE("CompiledNetwork: minimal genome gives sigmoid(0) outputs", "[compiled_network]") {
+    int next_innov = 1;
+    NeatGenome g = NeatGenome::minimal(3, 2, next_innov);
+    CompiledNetwork net(g);
+    CHECK(net.input_count() == 3);
+    CHECK(net.output_count() == 2);
+
+    float inputs[] = {1.0f, 0.5f, 0.0f};
+    float outputs[2] = {};
+    net.activate(inputs, 3, outputs, 2);
+    CHECK(outputs[0] == 0.5f);
+    CHECK(outputs[1] == 0.5f);
+}
+
+TEST_CASE("CompiledNetwork: bit-identical to NeatNetwork on random genomes", "[compiled_network]") {
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> in(-1.0f, 1.0f);
+
+    for (int trial = 0; trial < 60; ++trial) {
+        NeatGenome g = random_genome(6, 4, 10 + trial, rng);
+        NeatNetwork reference(g);
+        CompiledNetwork compiled(g);
+
+        for (int tick = 0; tick < 30; ++tick) {
+            float inputs[6];
+            for (float& x : inputs) x = in(rng);
+            float expected[4], actual[4];
+            reference.activate(inputs, 6, expected, 4);
+            compiled.activate(inputs, 6, actual, 4);
+            for (int k = 0; k < 4; ++k) REQUIRE(actual[k] == expected[k]);
+        }
+    }
+}
+
+TEST_CASE("CompiledNetwork: recurrent state survives ticks and clears on reset", "[compiled_network]") {
+    // input(0) -> hidden(2) -> output(1), hidden self-loop
+    NeatGenome g({{0, NodeType::Input, ActivationFn::Linear},
+                  {1, NodeType::Output, ActivationFn::Linear},
+                  {2, NodeType::Hidden, ActivationFn::Linear}},
+                 {{1, 0, 2, 1.0f, true, false},
+                  {2, 2, 1, 1.0f, true, false},
+                  {3, 2, 2, 1.0f, true, true}});
+    NeatNetwork reference(g);
+    CompiledNetwork compiled(g);
+
+    float one = 1.0f;
+    float expected = 0.0f, actual = 0.0f;
+    for (int tick = 0; tick < 4; ++tick) {
+        reference.activate(&one, 1, &expected, 1);
+        compiled.activate(&one, 1, &actual, 1);
+        CHECK(actual == expected);
+    }
+    CHECK(actual == 4.0f);  // accumulator: 1 + prev
+
+    compiled.reset();
+    compiled.activate(&one, 1, &actual, 1);
+    CHECK(actual == 1.0f);
+}
+
+TEST_CASE("CompiledNetwork: mismatched input/output counts are zero-filled", "[compiled_network]") {
+    std::mt19937 rng(7);
+    NeatGenome g = random_genome(3, 2, 20, rng);
+    NeatNetwork reference(g);
+    CompiledNetwork compiled(g);
+
+    float inputs[2] = {0.3f, -0.7f};
+    float expected[4], actual[4];
+    reference.activate(inputs, 2, expected, 4);
+    compiled.activate(inputs, 2, actual, 4);
+    for (int k = 0; k < 4; ++k) CHECK(actual[k] == expected[k]);
+    CHECK(actual[2] == 0.0f);
+    CHECK(actual[3] == 0.0f);
+}
+
+TEST_CASE("NetworkTape: batched evaluation matches per-instance activation", "[compiled_network]") {
+    std::mt19937 rng(99);
+    std::uniform_real_distribution<float> in(-1.0f, 1.0f);
+    NeatGenome g = random_genome(5, 3, 40, rng);
+    auto tape = std::make_shared<const NetworkTape>(g);
+
+    const int count = 37;
+    std::vector<CompiledNetwork> solo, batched;
+    for (int b = 0; b < count; ++b) {
+        solo.emplace_back(tape);
+        batched.emplace_back(tape);
+    }
+
+    std::vector<float> scratch;
+    for (int tick = 0; tick < 20; ++tick) {
+        std::vector<float> inputs(count * 5);
+        for (float& x : inputs) x = in(rng);
+        std::vector<float> expected(count * 3), actual(count * 3);
+
+        std::vector<NetworkTape::BatchItem> items;
+        for (int b = 0; b < count; ++b) {
+            solo[b].activate(&inputs[b * 5], 5, &expected[b * 3], 3);
+            items.push_back({batched[b].state(), &inputs[b * 5], 5, &actual[b * 3], 3});
+        }
+        tape->activate_batch(items.data(), count, scratch);
+        REQUIRE(actual == expected);
+    }
+}
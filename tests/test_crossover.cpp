@@ -19,20 +19,20 @@ static NeatGenome make_minimal(int n_in = 3, int n_out = 2) {
 TEST_CASE("Crossover: identical parents produce identical offspring", "[crossover]") {
     NeatGenome parent = make_minimal();
     // Give connections some weights
-    for (int i = 0; i < static_cast<int>(parent.connections.size()); ++i) {
-        parent.connections[i].weight = static_cast<float>(i) * 0.1f;
+    for (int i = 0; i < static_cast<int>(parent.connections().size()); ++i) {
+        parent.set_weight(i, static_cast<float>(i) * 0.1f);
     }
 
     std::mt19937 rng(42);
     NeatGenome child = crossover(parent, parent, rng);
 
-    CHECK(child.nodes.size() == parent.nodes.size());
-    CHECK(child.connections.size() == parent.connections.size());
+    CHECK(child.nodes().size() == parent.nodes().size());
+    CHECK(child.connections().size() == parent.connections().size());
 
     // All weights should match one of the parents (which are identical)
-    for (size_t i = 0; i < child.connections.size(); ++i) {
-        CHECK_THAT(child.connections[i].weight,
-                   WithinAbs(parent.connections[i].weight, 1e-6f));
+    for (size_t i = 0; i < child.connections().size(); ++i) {
+        CHECK_THAT(child.connections()[i].weight,
+                   WithinAbs(parent.connections()[i].weight, 1e-6f));
     }
 }
 
@@ -41,16 +41,16 @@ TEST_CASE("Crossover: fitter parent's excess genes inherited", "[crossover]") {
     NeatGenome other = make_minimal(2, 1);
 
     // Add an extra connection to the fitter parent (excess gene)
-    fitter.nodes.push_back({10, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
-    fitter.connections.push_back({100, 0, 10, 1.5f, true});
-    fitter.connections.push_back({101, 10, 2, 2.0f, true});
+    fitter.add_node({10, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
+    fitter.add_connection({100, 0, 10, 1.5f, true});
+    fitter.add_connection({101, 10, 2, 2.0f, true});
 
     std::mt19937 rng(42);
     NeatGenome child = crossover(fitter, other, rng);
 
     // Child should have the excess connections (innovation 100, 101)
     bool has_100 = false, has_101 = false;
-    for (const auto& c : child.connections) {
+    for (const auto& c : child.connections()) {
         if (c.innovation == 100) has_100 = true;
         if (c.innovation == 101) has_101 = true;
     }
@@ -59,7 +59,7 @@ TEST_CASE("Crossover: fitter parent's excess genes inherited", "[crossover]") {
 
     // Child should have the hidden node
     bool has_hidden = false;
-    for (const auto& n : child.nodes) {
+    for (const auto& n : child.nodes()) {
         if (n.id == 10) has_hidden = true;
     }
     CHECK(has_hidden);
@@ -70,14 +70,14 @@ TEST_CASE("Crossover: other parent's excess genes NOT inherited", "[crossover]")
     NeatGenome other = make_minimal(2, 1);
 
     // Add excess genes only to the other (less fit) parent
-    other.nodes.push_back({10, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
-    other.connections.push_back({100, 0, 10, 1.5f, true});
+    other.add_node({10, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
+    other.add_connection({100, 0, 10, 1.5f, true});
 
     std::mt19937 rng(42);
     NeatGenome child = crossover(fitter, other, rng);
 
     // Child should NOT have innovation 100
-    for (const auto& c : child.connections) {
+    for (const auto& c : child.connections()) {
         CHECK(c.innovation != 100);
     }
 }
@@ -87,15 +87,15 @@ TEST_CASE("Crossover: matching genes from roughly 50/50 parents", "[crossover]")
     NeatGenome parent_b = make_minimal(2, 1);
 
     // Set distinct weights so we can tell which parent a gene came from
-    for (auto& c : parent_a.connections) c.weight = 1.0f;
-    for (auto& c : parent_b.connections) c.weight = -1.0f;
+    for (size_t c = 0; c < parent_a.connections().size(); ++c) parent_a.set_weight(c, 1.0f);
+    for (size_t c = 0; c < parent_b.connections().size(); ++c) parent_b.set_weight(c, -1.0f);
 
     // Run crossover many times and count how often we get each parent's weight
     int from_a = 0, from_b = 0;
     for (int trial = 0; trial < 1000; ++trial) {
         std::mt19937 rng(trial);
         NeatGenome child = crossover(parent_a, parent_b, rng);
-        for (const auto& c : child.connections) {
+        for (const auto& c : child.connections()) {
             if (c.weight == 1.0f) ++from_a;
             else if (c.weight == -1.0f) ++from_b;
         }
@@ -112,7 +112,7 @@ TEST_CASE("Crossover: disabled gene handling", "[crossover]") {
     NeatGenome parent_b = make_minimal(2, 1);
 
     // Disable connection 1 in parent_a
-    parent_a.connections[0].enabled = false;
+    parent_a.set_enabled(0, false);
 
     // Run many trials — should be disabled ~75% of the time
     int disabled_count = 0;
@@ -120,7 +120,7 @@ TEST_CASE("Crossover: disabled gene handling", "[crossover]") {
     for (int trial = 0; trial < total; ++trial) {
         std::mt19937 rng(trial);
         NeatGenome child = crossover(parent_a, parent_b, rng);
-        if (!child.connections[0].enabled) ++disabled_count;
+        if (!child.connections()[0].enabled) ++disabled_count;
     }
 
     float rate = static_cast<float>(disabled_count) / static_cast<float>(total);
@@ -149,7 +149,7 @@ TEST_CASE("Crossover: different hidden nodes produce valid offspring", "[crossov
 
     // Should have all input + output nodes
     int inputs = 0, outputs = 0;
-    for (const auto& n : child.nodes) {
+    for (const auto& n : child.nodes()) {
         if (n.type == NodeType::Input) ++inputs;
         if (n.type == NodeType::Output) ++outputs;
     }
@@ -158,14 +158,14 @@ TEST_CASE("Crossover: different hidden nodes produce valid offspring", "[crossov
 
     // No duplicate node IDs
     std::set<int> ids;
-    for (const auto& n : child.nodes) {
+    for (const auto& n : child.nodes()) {
         CHECK(ids.count(n.id) == 0);
         ids.insert(n.id);
     }
 
     // No duplicate innovation numbers
     std::set<int> innovs;
-    for (const auto& c : child.connections) {
+    for (const auto& c : child.connections()) {
         CHECK(innovs.count(c.innovation) == 0);
         innovs.insert(c.innovation);
     }
@@ -214,7 +214,38 @@ TEST_CASE("Crossover: nodes sorted by id", "[crossover]") {
     std::mt19937 rng(0);
     NeatGenome child = crossover(parent, parent, rng);
 
-    for (size_t i = 1; i < child.nodes.size(); ++i) {
-        CHECK(child.nodes[i].id > child.nodes[i - 1].id);
+    for (size_t i = 1; i < child.nodes().size(); ++i) {
+        CHECK(child.nodes()[i].id > child.nodes()[i - 1].id);
     }
 }
+
+TEST_CASE("Crossover: child shares the fitter parent's topology when wired alike", "[crossover]") {
+    NeatGenome fitter = make_minimal(3, 2);
+    InnovationTracker tracker(100);
+    std::mt19937 rng_m(7);
+    mutate_add_node(fitter, rng_m, tracker);
+    NeatGenome other = fitter;
+    mutate_weights(fitter, rng_m);
+    mutate_weights(other, rng_m);
+    mutate_add_node(other, rng_m, tracker);  // disjoint genes on the other side
+
+    std::mt19937 rng(1);
+    NeatGenome child = crossover(fitter, other, rng);
+    CHECK(child.shares_topology(fitter));
+    REQUIRE(child.connections().size() == fitter.connections().size());
+    for (size_t i = 0; i < child.connections().size(); ++i) {
+        float w = child.connections()[i].weight;
+        CHECK((w == fitter.connections()[i].weight || w == other.connections()[i].weight));
+    }
+
+    // Matching gene wired differently in the other parent: own topology
+    NeatGenome rewired({other.nodes().begin(), other.nodes().end()}, {});
+    for (const auto& c : other.connections()) {
+        ConnectionGene gene = c;
+        if (gene.innovation == fitter.connections()[0].innovation) gene.recurrent = true;
+        rewired.add_connection(gene);
+    }
+    NeatGenome mixed = crossover(fitter, rewired, rng);
+    CHECK_FALSE(mixed.shares_topology(fitter));
+    CHECK(mixed.connections().size() == fitter.connections().size());
+}
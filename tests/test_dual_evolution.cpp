@@ -188,9 +188,9 @@ TEST_CASE("Dual evolution: both populations produce fitness vectors of correct s
     // Perturb weights
     std::normal_distribution<float> noise(0.0f, 0.5f);
     for (auto& g : prey_genomes)
-        for (auto& c : g.connections) c.weight += noise(rng);
+        for (size_t c = 0; c < g.connections().size(); ++c) g.set_weight(c, g.connection(c).weight + noise(rng));
     for (auto& g : pred_genomes)
-        for (auto& c : g.connections) c.weight += noise(rng);
+        for (size_t c = 0; c < g.connections().size(); ++c) g.set_weight(c, g.connection(c).weight + noise(rng));
 
     auto result = run_dual_generation(prey_genomes, pred_genomes, prey_spec, pred_spec,
                                        config, 1000, rng);
@@ -209,11 +209,11 @@ TEST_CASE("Dual evolution: predators can catch prey and gain fitness", "[coevolu
 
     // Create "mover" genomes that thrust forward
     NeatGenome mover = NeatGenome::minimal(10, 4, next_innov);
-    for (auto& c : mover.connections) {
-        if (c.target == 10) {  // rear thruster
-            c.weight = 3.0f;
+    for (size_t c = 0; c < mover.connections().size(); ++c) {
+        if (mover.connection(c).target == 10) {  // rear thruster
+            mover.set_weight(c, 3.0f);
         } else {
-            c.weight = 0.0f;
+            mover.set_weight(c, 0.0f);
         }
     }
 
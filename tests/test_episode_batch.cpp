@@ -0,0 +1,110 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "simulation/episode_batch.h"
+#include <atomic>
+#include <random>
+
+using Catch::Matchers::WithinAbs;
+
+// A stand-in for one generation's world run: every value comes from the
+// episode rng, and the amount of work varies per episode so chunks finish
+// out of order on a multi-threaded pool.
+static GenerationResult fake_episode(std::mt19937& rng, int /*worker*/) {
+    GenerationResult r;
+    std::uniform_real_distribution<float> dist(0.0f, 10.0f);
+    int spin = static_cast<int>(rng() % 2000);
+    float noise = 0.0f;
+    for (int i = 0; i < spin; ++i) noise += dist(rng);
+    for (int i = 0; i < 6; ++i) {
+        r.prey_fitness.push_back(dist(rng) + noise * 1e-6f);
+        r.prey_outcomes.push_back({dist(rng), dist(rng), dist(rng)});
+    }
+    for (int i = 0; i < 3; ++i) {
+        r.predator_fitness.push_back(dist(rng));
+        r.predator_outcomes.push_back({dist(rng), dist(rng), dist(rng)});
+    }
+    r.prey_survivors = static_cast<int>(rng() % 6);
+    r.predator_survivors = static_cast<int>(rng() % 3);
+    r.ticks_run = dist(rng) * 100.0f;
+    return r;
+}
+
+TEST_CASE("Episode batch results are identical for any pool size", "[episode_batch]") {
+    std::vector<GenerationResult> reference;
+    for (int threads : {1, 2, 3, 4}) {
+        ThreadPool pool(threads);
+        std::mt19937 rng(99);
+        std::vector<GenerationResult> batch = run_episode_batch(9, pool, rng, fake_episode);
+        REQUIRE(batch.size() == 9);
+        if (reference.empty()) {
+            reference = batch;
+            continue;
+        }
+        for (size_t e = 0; e < batch.size(); ++e) {
+            CHECK(batch[e].prey_fitness == reference[e].prey_fitness);
+            CHECK(batch[e].predator_fitness == reference[e].predator_fitness);
+            CHECK(batch[e].prey_survivors == reference[e].prey_survivors);
+            CHECK(batch[e].ticks_run == reference[e].ticks_run);
+            for (size_t i = 0; i < batch[e].prey_outcomes.size(); ++i) {
+                CHECK(batch[e].prey_outcomes[i].energy_gained == reference[e].prey_outcomes[i].energy_gained);
+                CHECK(batch[e].prey_outcomes[i].survival_ticks == reference[e].prey_outcomes[i].survival_ticks);
+            }
+        }
+    }
+}
+
+TEST_CASE("Episode batch workers stay within the pool and never overlap", "[episode_batch]") {
+    ThreadPool pool(3);
+    std::vector<std::atomic<int>> busy(pool.size());
+    std::atomic<bool> overlap{false}, out_of_range{false};
+    std::mt19937 rng(1);
+    run_episode_batch(12, pool, rng, [&](std::mt19937& episode_rng, int worker) {
+        if (worker < 0 || worker >= pool.size()) {
+            out_of_range = true;
+            return GenerationResult{};
+        }
+        if (busy[worker]++ != 0) overlap = true;
+        GenerationResult r = fake_episode(episode_rng, worker);
+        --busy[worker];
+        return r;
+    });
+    CHECK_FALSE(out_of_range);
+    CHECK_FALSE(overlap);
+}
+
+TEST_CASE("run_episodes averages are identical for any pool size", "[episode_batch]") {
+    ThreadPool serial_pool(1), threaded_pool(4);
+    std::mt19937 rng_a(5), rng_b(5);
+    GenerationResult a = run_episodes(7, serial_pool, rng_a, fake_episode);
+    GenerationResult b = run_episodes(7, threaded_pool, rng_b, fake_episode);
+
+    CHECK(a.prey_fitness == b.prey_fitness);
+    CHECK(a.predator_fitness == b.predator_fitness);
+    CHECK(a.prey_survivors == b.prey_survivors);
+    CHECK(a.predator_survivors == b.predator_survivors);
+    CHECK(a.ticks_run == b.ticks_run);
+    for (size_t i = 0; i < a.predator_outcomes.size(); ++i) {
+        CHECK(a.predator_outcomes[i].energy_spent == b.predator_outcomes[i].energy_spent);
+    }
+    CHECK(rng_a() == rng_b());
+}
+
+TEST_CASE("average_episodes takes the per-individual mean", "[episode_batch]") {
+    std::vector<GenerationResult> batch(2);
+    batch[0].prey_fitness = {1.0f, 4.0f};
+    batch[1].prey_fitness = {3.0f, 0.0f};
+    batch[0].prey_outcomes = {{2.0f, 0.0f, 10.0f}, {0.0f, 0.0f, 0.0f}};
+    batch[1].prey_outcomes = {{4.0f, 0.0f, 30.0f}, {0.0f, 0.0f, 0.0f}};
+    batch[0].prey_survivors = 1;
+    batch[1].prey_survivors = 2;
+    batch[0].ticks_run = 100.0f;
+    batch[1].ticks_run = 200.0f;
+
+    GenerationResult mean = average_episodes(std::move(batch));
+    CHECK_THAT(mean.prey_fitness[0], WithinAbs(2.0, 1e-6));
+    CHECK_THAT(mean.prey_fitness[1], WithinAbs(2.0, 1e-6));
+    CHECK_THAT(mean.prey_outcomes[0].energy_gained, WithinAbs(3.0, 1e-6));
+    CHECK_THAT(mean.prey_outcomes[0].survival_ticks, WithinAbs(20.0, 1e-6));
+    CHECK(mean.prey_survivors == 2);  // 1.5 rounds away from zero
+    CHECK_THAT(mean.ticks_run, WithinAbs(150.0, 1e-4));
+}
@@ -131,8 +131,8 @@ TEST_CASE("Evolution: evaluation harness produces non-zero fitness", "[evolution
     for (int i = 0; i < 10; ++i) {
         NeatGenome g = seed;
         std::normal_distribution<float> noise(0.0f, 0.5f);
-        for (auto& c : g.connections) {
-            c.weight += noise(rng);
+        for (size_t c = 0; c < g.connections().size(); ++c) {
+            g.set_weight(c, g.connection(c).weight + noise(rng));
         }
         genomes.push_back(std::move(g));
     }
@@ -162,18 +162,18 @@ TEST_CASE("Evolution: moving boids outperform stationary ones", "[evolution]") {
 
     // "Mover" genome: strong positive weight from any input to rear thruster (output 0)
     NeatGenome mover = NeatGenome::minimal(10, 4, next_innov);
-    for (auto& c : mover.connections) {
-        if (c.target == 10) {  // output node 0 = rear thruster (node ids: inputs 0-9, outputs 10-13)
-            c.weight = 3.0f;  // sigmoid(3) ≈ 0.95 → strong forward thrust
+    for (size_t c = 0; c < mover.connections().size(); ++c) {
+        if (mover.connection(c).target == 10) {  // output node 0 = rear thruster (node ids: inputs 0-9, outputs 10-13)
+            mover.set_weight(c, 3.0f);  // sigmoid(3) ≈ 0.95 → strong forward thrust
         } else {
-            c.weight = 0.0f;  // sigmoid(0) = 0.5 → moderate other thrusters
+            mover.set_weight(c, 0.0f);  // sigmoid(0) = 0.5 → moderate other thrusters
         }
     }
 
     // "Sitter" genome: all weights strongly negative → all thrusters near 0
     NeatGenome sitter = NeatGenome::minimal(10, 4, next_innov);
-    for (auto& c : sitter.connections) {
-        c.weight = -5.0f;  // sigmoid(-5) ≈ 0.007 → nearly zero thrust
+    for (size_t c = 0; c < sitter.connections().size(); ++c) {
+        sitter.set_weight(c, -5.0f);  // sigmoid(-5) ≈ 0.007 → nearly zero thrust
     }
 
     std::mt19937 rng(42);
@@ -0,0 +1,159 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "simulation/eye_kernel.h"
+#include "simulation/sensory_system.h"
+#include "simulation/boid.h"
+#include "simulation/world.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+using Catch::Matchers::WithinAbs;
+
+static constexpr float PI = static_cast<float>(M_PI);
+static constexpr float DEG = PI / 180.0f;
+
+static CompoundEyeConfig make_eyes() {
+    CompoundEyeConfig eyes;
+    eyes.channels = {SensorChannel::Food, SensorChannel::Same, SensorChannel::Opposite};
+    for (int e = 0; e < 6; ++e) {
+        eyes.eyes.push_back({e, (e * 60.0f - 150.0f) * DEG, 70.0f * DEG, 120.0f});
+    }
+    eyes.long_range_eyes.push_back({6, 0.0f, 20.0f * DEG, 250.0f});
+    return eyes;
+}
+
+// Distance in radians from `bearing` to the nearest arc edge of any eye
+static float nearest_edge(const CompoundEyeConfig& cfg, float bearing) {
+    float best = 10.0f;
+    auto check = [&](const EyeSpec& eye) {
+        for (float edge : {eye.center_angle - eye.arc_width * 0.5f,
+                           eye.center_angle + eye.arc_width * 0.5f}) {
+            float d = std::remainder(bearing - edge, 2.0f * PI);
+            best = std::min(best, std::abs(d));
+        }
+    };
+    for (const auto& eye : cfg.eyes) check(eye);
+    for (const auto& eye : cfg.long_range_eyes) check(eye);
+    return best;
+}
+
+// Feed the same targets through EyeKernel and the exact see_target() path
+static void compare_with_exact(const CompoundEyeConfig& cfg, const std::vector<Vec2>& targets,
+                               const std::vector<int>& channels) {
+    SensorySystem sys(cfg);
+    std::vector<float> exact(sys.input_count());
+    sys.begin_compound(exact.data());
+
+    const EyeKernel& kernel = sys.eye_kernel();
+    std::vector<float> scratch(kernel.scratch_size(), 0.0f);
+    for (size_t t = 0; t < targets.size(); ++t) {
+        Vec2 d = targets[t];
+        float dist_sq = d.length_squared();
+        sys.see_target(exact.data(), channels[t], std::atan2(d.x, d.y), dist_sq);
+        kernel.see(scratch.data(), channels[t], d, dist_sq);
+    }
+    std::vector<float> fast(sys.input_count());
+    kernel.write_outputs(scratch.data(), fast.data());
+
+    for (int k = 0; k < kernel.scratch_size(); ++k) {
+        CHECK_THAT(fast[k], WithinAbs(exact[k], 1e-5));
+    }
+}
+
+TEST_CASE("EyeKernel matches the exact eye path away from arc edges", "[eye_kernel]") {
+    CompoundEyeConfig cfg = make_eyes();
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> ang(-PI, PI);
+    std::uniform_real_distribution<float> dist(0.0f, 300.0f);
+    std::uniform_int_distribution<int> ch(0, 2);
+
+    for (int trial = 0; trial < 50; ++trial) {
+        std::vector<Vec2> targets;
+        std::vector<int> channels;
+        while (targets.size() < 20) {
+            float a = ang(rng);
+            if (nearest_edge(cfg, a) < 1e-3f) continue;
+            float r = dist(rng);
+            targets.push_back({r * std::sin(a), r * std::cos(a)});
+            channels.push_back(ch(rng));
+        }
+        compare_with_exact(cfg, targets, channels);
+    }
+}
+
+TEST_CASE("EyeKernel full-circle eye sees every direction", "[eye_kernel]") {
+    CompoundEyeConfig cfg;
+    cfg.channels = {SensorChannel::Same};
+    cfg.eyes.push_back({0, 0.0f, 2.0f * PI, 100.0f});
+    EyeKernel kernel(cfg);
+
+    for (float a : {0.0f, 0.5f * PI, PI, -0.75f * PI}) {
+        std::vector<float> scratch(kernel.scratch_size(), 0.0f);
+        Vec2 d{50.0f * std::sin(a), 50.0f * std::cos(a)};
+        kernel.see(scratch.data(), 0, d, d.length_squared());
+        CHECK_THAT(scratch[0], WithinAbs(0.5f, 1e-5));
+    }
+}
+
+TEST_CASE("EyeKernel treats a coincident target as dead ahead", "[eye_kernel]") {
+    CompoundEyeConfig cfg = make_eyes();
+    std::vector<Vec2> targets = {{0.0f, 0.0f}};
+    std::vector<int> channels = {1};
+    compare_with_exact(cfg, targets, channels);
+
+    EyeKernel kernel(cfg);
+    std::vector<float> scratch(kernel.scratch_size(), 0.0f);
+    kernel.see(scratch.data(), 0, {0.0f, 0.0f}, 0.0f);
+    // Forward-facing eyes (centres at -30 and +30 degrees, 70 wide) and the long-range eye
+    CHECK(scratch[2] == 1.0f);
+    CHECK(scratch[3] == 1.0f);
+    CHECK(scratch[6] == 1.0f);
+    CHECK(scratch[0] == 0.0f);
+}
+
+TEST_CASE("World with fast eye kernel stays within tolerance of exact", "[eye_kernel]") {
+    auto run = [](bool fast) {
+        WorldConfig config;
+        config.width = 600;
+        config.height = 600;
+        config.grid_cell_size = 100.0f;
+        config.fast_eye_kernel = fast;
+        World world(config);
+
+        CompoundEyeConfig eyes = make_eyes();
+        std::mt19937 rng(9);
+        std::uniform_real_distribution<float> d(0.0f, 600.0f);
+        for (int i = 0; i < 60; ++i) {
+            Boid b;
+            b.type = i < 45 ? "prey" : "predator";
+            b.body.position = {d(rng), d(rng)};
+            b.body.angle = d(rng);
+            b.body.mass = 1;
+            b.body.moment_of_inertia = 1;
+            b.energy = 100.0f;
+            b.initial_energy = 100.0f;
+            b.sensors.emplace(eyes);
+            world.add_boid(std::move(b));
+        }
+        for (int i = 0; i < 80; ++i) world.add_food(Food{{d(rng), d(rng)}, 1.0f});
+        world.step(0);
+
+        std::vector<std::vector<float>> outputs;
+        for (const auto& b : world.get_boids()) outputs.push_back(b.sensor_outputs);
+        return outputs;
+    };
+
+    auto exact = run(false);
+    auto fast = run(true);
+    REQUIRE(exact.size() == fast.size());
+    int mismatches = 0;
+    for (size_t i = 0; i < exact.size(); ++i) {
+        REQUIRE(exact[i].size() == fast[i].size());
+        for (size_t k = 0; k < exact[i].size(); ++k) {
+            if (std::abs(exact[i][k] - fast[i][k]) > 1e-5f) ++mismatches;
+        }
+    }
+    // Only a target within rounding of an arc edge could differ; none do for this seed
+    CHECK(mismatches == 0);
+}
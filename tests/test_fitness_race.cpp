@@ -0,0 +1,40 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "brain/fitness_race.h"
+#include <cmath>
+
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("Fitness race: cut keeps the best fraction", "[fitness_race]") {
+    FitnessRace race(8);
+    for (int i = 0; i < 8; ++i) race.add_sample(i, static_cast<float>((i * 3) % 8));
+    // Means: 0 3 6 1 4 7 2 5
+
+    race.cut(0.5f);
+    CHECK(race.contenders() == std::vector<int>{2, 4, 5, 7});
+
+    race.cut(0.3f);  // ceil(1.2) = 2
+    CHECK(race.contenders() == std::vector<int>{2, 5});
+
+    race.cut(0.0f);  // never empties the race
+    CHECK(race.contenders() == std::vector<int>{5});
+}
+
+TEST_CASE("Fitness race: scores average every sample taken", "[fitness_race]") {
+    FitnessRace race(3);
+    race.add_sample(0, 4.0f);
+    race.add_sample(1, 1.0f);
+    race.add_sample(2, 2.0f);
+    race.cut(0.5f);
+    for (int idx : race.contenders()) race.add_sample(idx, 2.0f);
+
+    CHECK(race.samples(0) == 2);
+    CHECK(race.samples(1) == 1);
+    CHECK_THAT(race.mean(0), WithinAbs(3.0f, 1e-6f));
+    CHECK_THAT(race.mean(2), WithinAbs(2.0f, 1e-6f));
+    CHECK(std::isnan(race.confidence(1)));
+
+    // Two samples 4 and 2: s = sqrt(2), half-width = 12.706 * s / sqrt(2)
+    CHECK_THAT(race.confidence(0), WithinAbs(12.706f, 1e-3f));
+    CHECK_THAT(race.confidence(2), WithinAbs(0.0f, 1e-6f));
+}
@@ -0,0 +1,176 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "simulation/food_store.h"
+#include "simulation/sensory_system.h"
+#include "simulation/toroidal.h"
+#include "simulation/world.h"
+#include <algorithm>
+#include <random>
+
+using Catch::Matchers::WithinAbs;
+
+static std::vector<int> slots_near(const FoodStore& store, Vec2 pos, float radius) {
+    std::vector<int> out;
+    store.for_each_near(pos, radius, [&](int slot, const Food&) { out.push_back(slot); });
+    return out;
+}
+
+// Items actually within radius (toroidal), as callers of for_each_near would filter
+static int count_within(const FoodStore& store, Vec2 pos, float radius, float w, float h) {
+    int n = 0;
+    store.for_each_near(pos, radius, [&](int, const Food& f) {
+        if (toroidal_delta(pos, f.position, w, h).length_squared() <= radius * radius) ++n;
+    });
+    return n;
+}
+
+TEST_CASE("FoodStore add and remove keep items dense", "[food_store]") {
+    FoodStore store(400, 400, 100);
+    store.add(Food{{10, 10}, 1.0f});
+    store.add(Food{{20, 20}, 2.0f});
+    store.add(Food{{30, 30}, 3.0f});
+    REQUIRE(store.size() == 3);
+
+    auto near = slots_near(store, {10, 10}, 50);
+    REQUIRE(near.size() == 3);
+
+    // Remove the first item; the rest stay reachable through their slots
+    int first = -1;
+    for (int s : near) if (store.at_slot(s).energy_value == 1.0f) first = s;
+    store.remove(first);
+    CHECK(store.size() == 2);
+
+    float total = 0;
+    for (const auto& f : store.items()) total += f.energy_value;
+    CHECK_THAT(total, WithinAbs(5.0f, 1e-6f));
+    for (int s : slots_near(store, {10, 10}, 50)) {
+        CHECK(store.at_slot(s).energy_value != 1.0f);
+    }
+}
+
+TEST_CASE("FoodStore reuses freed slots and keeps serials increasing", "[food_store]") {
+    FoodStore store(400, 400, 100);
+    store.add(Food{{10, 10}, 1.0f});
+    store.add(Food{{300, 300}, 2.0f});
+    int a = -1;
+    for (int s : slots_near(store, {10, 10}, 1)) if (store.at_slot(s).energy_value == 1.0f) a = s;
+    uint64_t old_serial = store.serial(a);
+
+    store.remove(a);
+    store.add(Food{{10, 10}, 3.0f});
+    int b = -1;
+    for (int s : slots_near(store, {10, 10}, 1)) if (store.at_slot(s).energy_value == 3.0f) b = s;
+    CHECK(b == a);
+    CHECK(store.serial(b) > old_serial);
+    CHECK(store.at_slot(b).energy_value == 3.0f);
+}
+
+TEST_CASE("FoodStore indexes items appended by a food source", "[food_store]") {
+    FoodStore store(400, 400, 100);
+    store.append_target().push_back(Food{{50, 50}, 1.0f});
+    store.append_target().push_back(Food{{350, 350}, 1.0f});
+    store.index_appended();
+
+    CHECK(store.size() == 2);
+    CHECK(slots_near(store, {50, 50}, 10).size() == 2);  // 4x4 cells: neighbourhood wraps to both
+    CHECK(count_within(store, {50, 50}, 10, 400, 400) == 1);
+    CHECK(count_within(store, {350, 350}, 10, 400, 400) == 1);
+}
+
+TEST_CASE("FoodStore neighbourhood wraps and never repeats an item", "[food_store]") {
+    // 3x3 cells: a large radius would cover every column more than once if unclamped
+    FoodStore store(300, 300, 100);
+    store.add(Food{{5, 5}, 1.0f});
+    store.add(Food{{295, 150}, 1.0f});
+
+    auto near = slots_near(store, {150, 150}, 250);
+    std::sort(near.begin(), near.end());
+    CHECK(std::adjacent_find(near.begin(), near.end()) == near.end());
+    CHECK(near.size() == 2);
+
+    // Item across the x seam from a point near x = 0
+    CHECK(count_within(store, {2, 150}, 10, 300, 300) == 1);
+}
+
+TEST_CASE("FoodStore finds every item within radius on a partial-cell world", "[food_store]") {
+    // 1050 / 100 gives a partial edge cell; cells are stretched to divide the world evenly
+    FoodStore store(1050, 1050, 100);
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> d(0.0f, 1050.0f);
+    std::vector<Vec2> positions;
+    for (int i = 0; i < 500; ++i) {
+        Vec2 p{d(rng), d(rng)};
+        positions.push_back(p);
+        store.add(Food{p, 1.0f});
+    }
+
+    for (int q = 0; q < 50; ++q) {
+        Vec2 centre{d(rng), d(rng)};
+        float radius = 120.0f;
+        int expected = 0;
+        for (const auto& p : positions) {
+            if (toroidal_delta(centre, p, 1050, 1050).length_squared() <= radius * radius) ++expected;
+        }
+        CHECK(count_within(store, centre, radius, 1050, 1050) == expected);
+    }
+}
+
+TEST_CASE("Compound-eye food channel matches brute force with a food index", "[food_store][sensor]") {
+    WorldConfig config;
+    config.width = 800;
+    config.height = 800;
+    World world(config);
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> d(0.0f, 800.0f);
+    for (int i = 0; i < 300; ++i) world.add_food(Food{{d(rng), d(rng)}, 1.0f});
+
+    CompoundEyeConfig eyes;
+    eyes.channels = {SensorChannel::Food};
+    for (int e = 0; e < 8; ++e) {
+        eyes.eyes.push_back({e, (e * 45.0f - 180.0f) * 3.14159265f / 180.0f,
+                             60.0f * 3.14159265f / 180.0f, 150.0f});
+    }
+    SensorySystem sys(eyes);
+
+    FoodStore index(800, 800, 100);
+    for (const auto& f : world.get_food()) index.add(f);
+
+    std::vector<Boid> boids(1);
+    boids[0].type = "prey";
+    for (int trial = 0; trial < 20; ++trial) {
+        boids[0].body.position = {d(rng), d(rng)};
+        boids[0].body.angle = d(rng);
+
+        std::vector<float> brute(sys.input_count()), indexed(sys.input_count());
+        sys.perceive(boids, world.grid(), config, 0, world.get_food(), brute.data());
+        sys.perceive(boids, world.grid(), config, 0, world.get_food(), indexed.data(),
+                     nullptr, &index);
+        CHECK(brute == indexed);
+    }
+}
+
+TEST_CASE("Eating through the food index removes only food within reach", "[food_store][world]") {
+    WorldConfig config;
+    config.width = 400;
+    config.height = 400;
+    config.food_eat_radius = 10.0f;
+    config.metabolism_rate = 0.0f;
+    config.thrust_cost = 0.0f;
+    World world(config);
+
+    Boid b;
+    b.type = "prey";
+    b.energy = 10.0f;
+    b.body.position = {200, 200};
+    world.add_boid(std::move(b));
+
+    world.add_food(Food{{205, 200}, 3.0f});
+    world.add_food(Food{{200, 195}, 4.0f});
+    world.add_food(Food{{250, 250}, 5.0f});
+    world.step(0.0f);
+
+    REQUIRE(world.get_food().size() == 1);
+    CHECK(world.get_food()[0].energy_value == 5.0f);
+    CHECK_THAT(world.get_boids()[0].energy, WithinAbs(17.0f, 1e-5f));
+}
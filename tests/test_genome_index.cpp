@@ -0,0 +1,194 @@
+#include <catch2/catch_test_macros.hpp>
+#include "brain/genome_index.h"
+#include "brain/mutation.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Feed-forward reachability by scanning the connection list
+static bool scan_reaches(const NeatGenome& g, int from, int to) {
+    std::vector<int> stack = {from};
+    std::vector<int> seen;
+    while (!stack.empty()) {
+        int current = stack.back();
+        stack.pop_back();
+        if (current == to) return true;
+        if (std::find(seen.begin(), seen.end(), current) != seen.end()) continue;
+        seen.push_back(current);
+        for (const auto& c : g.connections()) {
+            if (c.enabled && !c.recurrent && c.source == current) stack.push_back(c.target);
+        }
+    }
+    return false;
+}
+
+static void random_structural_step(NeatGenome& g, std::mt19937& rng,
+                                   InnovationTracker& tracker, bool allow_recurrent,
+                                   bool allow_toggle = true) {
+    std::uniform_real_distribution<float> u(0.0f, 1.0f);
+    float r = u(rng);
+    if (r < 0.3f) mutate_add_node(g, rng, tracker);
+    else if (r < 0.75f) mutate_add_connection(g, rng, tracker, 20, allow_recurrent);
+    else if (r < 0.9f && allow_toggle) mutate_toggle_connection(g, rng);
+    else mutate_delete_connection(g, rng);
+}
+
+static int max_id(const NeatGenome& g) {
+    int m = 0;
+    for (const auto& n : g.nodes()) m = std::max(m, n.id);
+    return m;
+}
+
+static void check_matches_genome(const GenomeIndex& index, const NeatGenome& g) {
+    int top = max_id(g);
+    CHECK(index.max_node_id() == top);
+    for (int a = 0; a <= top; ++a) {
+        for (int b = 0; b <= top; ++b) {
+            bool edge = std::any_of(g.connections().begin(), g.connections().end(),
+                [&](const ConnectionGene& c) { return c.source == a && c.target == b; });
+            CHECK(index.has_connection(a, b) == edge);
+            CHECK(index.reaches(a, b) == scan_reaches(g, a, b));
+        }
+    }
+}
+
+TEST_CASE("GenomeIndex: built index answers like a connection scan", "[genome_index]") {
+    int next = 1;
+    NeatGenome g = NeatGenome::minimal(3, 2, next);
+    InnovationTracker tracker(next);
+    std::mt19937 rng(5);
+    for (int s = 0; s < 60; ++s) random_structural_step(g, rng, tracker, true);
+
+    GenomeIndex index(g);
+    check_matches_genome(index, g);
+}
+
+TEST_CASE("GenomeIndex: incremental updates match a fresh build", "[genome_index]") {
+    for (bool allow_recurrent : {true, false}) {
+        int next = 1;
+        NeatGenome g = NeatGenome::minimal(4, 3, next);
+        InnovationTracker tracker(next);
+        g.build_index();
+        std::mt19937 rng(allow_recurrent ? 11 : 12);
+
+        for (int s = 0; s < 200; ++s) {
+            random_structural_step(g, rng, tracker, allow_recurrent);
+            if (s % 20 == 19) {
+                check_matches_genome(*g.index, g);
+                GenomeIndex fresh(g);
+                CHECK(g.index->orphan_count() == fresh.orphan_count());
+            }
+        }
+    }
+}
+
+TEST_CASE("GenomeIndex: indexed and unindexed mutation give the same genome", "[genome_index]") {
+    for (bool allow_recurrent : {true, false}) {
+        int next = 1;
+        NeatGenome plain = NeatGenome::minimal(3, 2, next);
+        NeatGenome indexed = plain;
+        indexed.build_index();
+        InnovationTracker t1(next), t2(next);
+        std::mt19937 r1(77), r2(77);
+
+        for (int s = 0; s < 300; ++s) {
+            random_structural_step(plain, r1, t1, allow_recurrent);
+            random_structural_step(indexed, r2, t2, allow_recurrent);
+        }
+
+        REQUIRE(plain.nodes().size() == indexed.nodes().size());
+        for (size_t i = 0; i < plain.nodes().size(); ++i) {
+            CHECK(plain.nodes()[i].id == indexed.nodes()[i].id);
+        }
+        REQUIRE(plain.connections().size() == indexed.connections().size());
+        for (size_t i = 0; i < plain.connections().size(); ++i) {
+            const auto& a = plain.connections()[i];
+            const auto& b = indexed.connections()[i];
+            CHECK(a.innovation == b.innovation);
+            CHECK(a.source == b.source);
+            CHECK(a.target == b.target);
+            CHECK(a.enabled == b.enabled);
+            CHECK(a.recurrent == b.recurrent);
+        }
+    }
+}
+
+TEST_CASE("GenomeIndex: recurrent mutations keep the feed-forward graph ordered", "[genome_index]") {
+    int next = 1;
+    NeatGenome g = NeatGenome::minimal(3, 2, next);
+    InnovationTracker tracker(next);
+    g.build_index();
+    std::mt19937 rng(3);
+
+    for (int s = 0; s < 300; ++s) {
+        random_structural_step(g, rng, tracker, true, false);
+        REQUIRE(g.index->ordered());
+    }
+    // Every non-recurrent connection goes forward: its target never reaches its source
+    for (const auto& c : g.connections()) {
+        if (c.enabled && !c.recurrent) CHECK_FALSE(scan_reaches(g, c.target, c.source));
+    }
+}
+
+TEST_CASE("GenomeIndex: a feed-forward cycle drops the order until it is broken", "[genome_index]") {
+    NeatGenome g;
+    g.add_node({0, NodeType::Input, ActivationFn::Linear, 0.0f});
+    g.add_node({1, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
+    g.add_node({2, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
+    g.add_connection({1, 0, 1, 1.0f, true, false});
+    g.add_connection({2, 1, 2, 1.0f, true, false});
+    GenomeIndex index(g);
+    REQUIRE(index.ordered());
+    CHECK_FALSE(index.reaches(2, 1));
+
+    ConnectionGene back{3, 2, 1, 1.0f, true, false};
+    index.add_connection(back);
+    CHECK_FALSE(index.ordered());
+    CHECK(index.reaches(2, 1));
+    CHECK(index.reaches(1, 2));
+
+    index.remove_connection(back);
+    CHECK(index.ordered());
+    CHECK_FALSE(index.reaches(2, 1));
+}
+
+TEST_CASE("GenomeIndex: tracks orphaned hidden nodes", "[genome_index]") {
+    NeatGenome g;
+    g.add_node({0, NodeType::Input, ActivationFn::Linear, 0.0f});
+    g.add_node({1, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
+    g.add_node({5, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
+    g.add_connection({1, 0, 5, 1.0f, true, false});
+    GenomeIndex index(g);
+    CHECK(index.orphan_count() == 0);
+    CHECK(index.max_node_id() == 5);
+
+    index.remove_connection(g.connections()[0]);
+    CHECK(index.orphan_count() == 1);
+    CHECK(index.is_orphan(5));
+    CHECK_FALSE(index.is_orphan(0));
+
+    index.remove_node(5);
+    CHECK(index.orphan_count() == 0);
+    CHECK(index.max_node_id() == 1);
+}
+
+TEST_CASE("GenomeIndex: copies share the index until one changes structure", "[genome_index]") {
+    int next = 1;
+    NeatGenome parent = NeatGenome::minimal(3, 2, next);
+    InnovationTracker tracker(next);
+    std::mt19937 rng(21);
+    parent.build_index();
+    for (int s = 0; s < 30; ++s) random_structural_step(parent, rng, tracker, true);
+
+    NeatGenome child = parent;
+    CHECK(child.index == parent.index);
+
+    // Weight changes leave the shared index alone
+    mutate_weights(child, rng);
+    CHECK(child.index == parent.index);
+
+    REQUIRE(mutate_add_node(child, rng, tracker));
+    CHECK(child.index != parent.index);
+    check_matches_genome(*parent.index, parent);
+    check_matches_genome(*child.index, child);
+}
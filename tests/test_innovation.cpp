@@ -53,3 +53,27 @@ TEST_CASE("InnovationTracker: next_innovation reflects state", "[innovation]") {
     tracker.get_or_create(0, 7);
     CHECK(tracker.next_innovation() == 2);
 }
+
+TEST_CASE("InnovationTracker: a class numbers in its own residue", "[innovation]") {
+    // Class 2 of 3, starting at or after 10
+    InnovationTracker tracker(10, 3, 2);
+    CHECK(tracker.next_innovation() == 11);
+    CHECK(tracker.get_or_create(0, 7) == 11);
+    CHECK(tracker.get_or_create(1, 7) == 14);
+    CHECK(tracker.get_or_create(0, 7) == 11);
+    CHECK(tracker.next_innovation() == 17);
+
+    // Hidden node ids: next id above the genome's largest, in the same class
+    CHECK(tracker.new_node_id(4) == 5);
+    CHECK(tracker.new_node_id(5) == 8);
+
+    // Negative starts (provisional numbering) land in the class too
+    InnovationTracker provisional(-100, 3, 2);
+    CHECK(((provisional.next_innovation() % 3) + 3) % 3 == 2);
+    CHECK(provisional.next_innovation() >= -100);
+    CHECK(provisional.next_innovation() < -97);
+
+    // The default single class numbers densely
+    InnovationTracker dense(1);
+    CHECK(dense.new_node_id(4) == 5);
+}
@@ -0,0 +1,173 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "brain/island_migration.h"
+#include <cmath>
+#include <map>
+#include <memory>
+
+using Catch::Matchers::WithinAbs;
+
+// Islands of 10 genomes; island i's genome idx scores 100*(i+1) + idx, so every
+// fitness value says which island and slot it came from.
+struct Archipelago {
+    std::vector<std::mt19937> rngs;
+    std::vector<std::unique_ptr<Population>> pops;
+    std::vector<Population*> ptrs;
+
+    explicit Archipelago(int n) : rngs(n) {
+        PopulationParams params;
+        params.population_size = 10;
+        int next = 1;
+        NeatGenome seed = NeatGenome::minimal(3, 2, next);
+        for (int i = 0; i < n; ++i) {
+            rngs[i].seed(static_cast<unsigned>(10 + i));
+            pops.push_back(std::make_unique<Population>(seed, params, rngs[i]));
+            float base = 100.0f * (i + 1);
+            pops[i]->evaluate([base](int idx, const NeatGenome&) { return base + idx; });
+            ptrs.push_back(pops[i].get());
+        }
+    }
+};
+
+static float champion_fitness(int island) { return 100.0f * (island + 1) + 9.0f; }
+
+TEST_CASE("Migration sources follow the topology", "[island_migration]") {
+    CHECK(migration_sources(0, 4, MigrationTopology::Ring) == std::vector<int>{3});
+    CHECK(migration_sources(2, 4, MigrationTopology::Ring) == std::vector<int>{1});
+    CHECK(migration_sources(1, 4, MigrationTopology::Full) == std::vector<int>{0, 2, 3});
+    CHECK(migration_sources(0, 1, MigrationTopology::Full).empty());
+}
+
+TEST_CASE("Migration is due every interval, only with several islands", "[island_migration]") {
+    IslandConfig cfg;
+    cfg.count = 3;
+    cfg.migration_interval = 5;
+    CHECK_FALSE(migration_due(cfg, 0));
+    CHECK(migration_due(cfg, 4));
+    CHECK(migration_due(cfg, 9));
+    CHECK_FALSE(migration_due(cfg, 10));
+
+    cfg.migration_interval = 0;
+    CHECK_FALSE(migration_due(cfg, 4));
+
+    cfg.migration_interval = 5;
+    cfg.count = 1;
+    CHECK_FALSE(migration_due(cfg, 4));
+}
+
+TEST_CASE("Ring migration sends each champion to the next island", "[island_migration]") {
+    Archipelago islands(3);
+    std::vector<NeatGenome> champions;
+    for (auto* p : islands.ptrs) champions.push_back(p->genome(p->top_indices(1)[0]));
+
+    IslandConfig cfg;
+    cfg.count = 3;
+    cfg.migrants = 1;
+    cfg.topology = MigrationTopology::Ring;
+    migrate(islands.ptrs, {}, cfg);
+
+    for (int j = 0; j < 3; ++j) {
+        int from = (j + 2) % 3;
+        const Population& pop = *islands.ptrs[j];
+        // The weakest slot (0) now holds the previous island's champion
+        CHECK_THAT(pop.fitness(0), WithinAbs(champion_fitness(from), 1e-6));
+        REQUIRE(pop.genome(0).connections().size() == champions[from].connections().size());
+        for (size_t c = 0; c < champions[from].connections().size(); ++c) {
+            CHECK(pop.genome(0).connections()[c].weight == champions[from].connections()[c].weight);
+        }
+        // Its own champion stays, and nothing else moved
+        CHECK_THAT(pop.fitness(9), WithinAbs(champion_fitness(j), 1e-6));
+        CHECK_THAT(pop.fitness(1), WithinAbs(100.0f * (j + 1) + 1.0f, 1e-6));
+    }
+}
+
+TEST_CASE("Full migration sends each champion to every other island", "[island_migration]") {
+    Archipelago islands(3);
+
+    IslandConfig cfg;
+    cfg.count = 3;
+    cfg.migrants = 1;
+    cfg.topology = MigrationTopology::Full;
+    migrate(islands.ptrs, {}, cfg);
+
+    for (int j = 0; j < 3; ++j) {
+        std::vector<int> from;
+        for (int i = 0; i < 3; ++i) if (i != j) from.push_back(i);
+        const Population& pop = *islands.ptrs[j];
+        // Sources arrive in island order into the two weakest slots
+        CHECK_THAT(pop.fitness(0), WithinAbs(champion_fitness(from[0]), 1e-6));
+        CHECK_THAT(pop.fitness(1), WithinAbs(champion_fitness(from[1]), 1e-6));
+        CHECK_THAT(pop.fitness(2), WithinAbs(100.0f * (j + 1) + 2.0f, 1e-6));
+    }
+}
+
+TEST_CASE("Migration moves predators between the same islands as prey", "[island_migration]") {
+    Archipelago prey(2), predators(2);
+    std::vector<Population*> pred_ptrs = {predators.ptrs[0], nullptr};
+
+    IslandConfig cfg;
+    cfg.count = 2;
+    cfg.migrants = 2;
+    migrate(prey.ptrs, pred_ptrs, cfg);
+
+    // Island 1 has no predators: it neither sends nor receives any
+    CHECK_THAT(predators.ptrs[1]->fitness(0), WithinAbs(200.0, 1e-6));
+    // Island 0's predators received nothing (island 1 sent none) and kept theirs
+    CHECK_THAT(predators.ptrs[0]->fitness(0), WithinAbs(100.0, 1e-6));
+    // Prey swapped their top two both ways
+    CHECK_THAT(prey.ptrs[0]->fitness(0), WithinAbs(209.0, 1e-6));
+    CHECK_THAT(prey.ptrs[0]->fitness(1), WithinAbs(208.0, 1e-6));
+    CHECK_THAT(prey.ptrs[1]->fitness(0), WithinAbs(109.0, 1e-6));
+}
+
+TEST_CASE("Migrants keep consistent innovation numbers across islands", "[island_migration]") {
+    const int n = 3;
+    PopulationParams params;
+    params.population_size = 30;
+    params.add_node_prob = 0.3f;
+    params.add_connection_prob = 0.5f;
+    int next = 1;
+    NeatGenome seed = NeatGenome::minimal(3, 2, next);
+    const int seed_innovations = next - 1;
+
+    std::vector<std::mt19937> rngs(n);
+    std::vector<std::unique_ptr<Population>> pops;
+    std::vector<Population*> prey, predators(n, nullptr);
+    for (int i = 0; i < n; ++i) {
+        rngs[i].seed(static_cast<unsigned>(20 + i));
+        pops.push_back(std::make_unique<Population>(seed, params, rngs[i]));
+        pops[i]->set_innovation_class(i, n);
+        prey.push_back(pops[i].get());
+    }
+
+    IslandConfig cfg;
+    cfg.count = n;
+    cfg.migrants = 3;
+    for (int gen = 0; gen < 8; ++gen) {
+        for (auto* p : prey) {
+            p->evaluate([](int, const NeatGenome& g) {
+                float f = 0.0f;
+                for (const auto& c : g.connections()) f += std::abs(c.weight);
+                return f;
+            });
+        }
+        migrate(prey, predators, cfg);
+        for (auto* p : prey) p->advance_generation();
+    }
+
+    // Every innovation names one source→target pair across the archipelago,
+    // and genes born on one island keep that island's class elsewhere
+    std::map<int, std::pair<int,int>> by_innovation;
+    int foreign = 0;
+    for (int i = 0; i < n; ++i) {
+        for (const auto& g : prey[i]->genomes()) {
+            for (const auto& c : g.connections()) {
+                auto pair = std::make_pair(c.source, c.target);
+                auto [it, inserted] = by_innovation.emplace(c.innovation, pair);
+                CHECK(it->second == pair);
+                if (c.innovation > seed_innovations && c.innovation % n != i) ++foreign;
+            }
+        }
+    }
+    CHECK(foreign > 0);  // migrants did carry genes across
+}
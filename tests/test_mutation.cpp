@@ -20,14 +20,14 @@ static NeatGenome make_minimal(int n_in = 3, int n_out = 2) {
 TEST_CASE("mutate_weights: weights change", "[mutation]") {
     NeatGenome genome = make_minimal();
     // Set all weights to 0
-    for (auto& c : genome.connections) c.weight = 0.0f;
+    for (size_t c = 0; c < genome.connections().size(); ++c) genome.set_weight(c, 0.0f);
 
     std::mt19937 rng(42);
     mutate_weights(genome, rng);
 
     // At least some weights should have changed
     bool any_changed = false;
-    for (const auto& c : genome.connections) {
+    for (const auto& c : genome.connections()) {
         if (c.weight != 0.0f) { any_changed = true; break; }
     }
     CHECK(any_changed);
@@ -35,12 +35,12 @@ TEST_CASE("mutate_weights: weights change", "[mutation]") {
 
 TEST_CASE("mutate_weights: with zero probabilities, weights unchanged", "[mutation]") {
     NeatGenome genome = make_minimal();
-    for (auto& c : genome.connections) c.weight = 1.0f;
+    for (size_t c = 0; c < genome.connections().size(); ++c) genome.set_weight(c, 1.0f);
 
     std::mt19937 rng(42);
     mutate_weights(genome, rng, 0.0f, 0.3f, 0.0f);
 
-    for (const auto& c : genome.connections) {
+    for (const auto& c : genome.connections()) {
         CHECK_THAT(c.weight, WithinAbs(1.0f, 1e-6f));
     }
 }
@@ -54,14 +54,14 @@ TEST_CASE("mutate_add_connection: adds a new connection", "[mutation]") {
     InnovationTracker tracker(next);
 
     // Insert a hidden node so there are unconnected pairs
-    genome.nodes.push_back({10, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
+    genome.add_node({10, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
 
-    size_t before = genome.connections.size();
+    size_t before = genome.connections().size();
     std::mt19937 rng(42);
     bool added = mutate_add_connection(genome, rng, tracker);
 
     CHECK(added);
-    CHECK(genome.connections.size() == before + 1);
+    CHECK(genome.connections().size() == before + 1);
 }
 
 TEST_CASE("mutate_add_connection: fully connected returns false", "[mutation]") {
@@ -77,7 +77,7 @@ TEST_CASE("mutate_add_connection: fully connected returns false", "[mutation]")
 
 TEST_CASE("mutate_add_connection: no duplicate connections", "[mutation]") {
     NeatGenome genome = make_minimal(3, 2);
-    genome.nodes.push_back({10, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
+    genome.add_node({10, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
 
     InnovationTracker tracker(100);
     std::mt19937 rng(42);
@@ -88,7 +88,7 @@ TEST_CASE("mutate_add_connection: no duplicate connections", "[mutation]") {
     }
 
     std::set<std::pair<int,int>> pairs;
-    for (const auto& c : genome.connections) {
+    for (const auto& c : genome.connections()) {
         auto p = std::make_pair(c.source, c.target);
         CHECK(pairs.count(p) == 0);
         pairs.insert(p);
@@ -97,7 +97,7 @@ TEST_CASE("mutate_add_connection: no duplicate connections", "[mutation]") {
 
 TEST_CASE("mutate_add_connection: doesn't connect to input nodes", "[mutation]") {
     NeatGenome genome = make_minimal(3, 2);
-    genome.nodes.push_back({10, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
+    genome.add_node({10, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
 
     InnovationTracker tracker(100);
     std::mt19937 rng(42);
@@ -106,11 +106,11 @@ TEST_CASE("mutate_add_connection: doesn't connect to input nodes", "[mutation]")
         mutate_add_connection(genome, rng, tracker);
     }
 
-    for (const auto& c : genome.connections) {
+    for (const auto& c : genome.connections()) {
         // Target should never be an input node
-        auto it = std::find_if(genome.nodes.begin(), genome.nodes.end(),
+        auto it = std::find_if(genome.nodes().begin(), genome.nodes().end(),
             [&](const NodeGene& n) { return n.id == c.target; });
-        CHECK(it->type != NodeType::Input);
+        CHECK((*it).type != NodeType::Input);
     }
 }
 
@@ -121,18 +121,18 @@ TEST_CASE("mutate_add_node: splits a connection", "[mutation]") {
     InnovationTracker tracker(100);
     std::mt19937 rng(42);
 
-    size_t nodes_before = genome.nodes.size();
-    size_t conns_before = genome.connections.size();
+    size_t nodes_before = genome.nodes().size();
+    size_t conns_before = genome.connections().size();
 
     bool added = mutate_add_node(genome, rng, tracker);
 
     CHECK(added);
-    CHECK(genome.nodes.size() == nodes_before + 1);
+    CHECK(genome.nodes().size() == nodes_before + 1);
     // One disabled, two new = net +2
-    CHECK(genome.connections.size() == conns_before + 2);
+    CHECK(genome.connections().size() == conns_before + 2);
 
     // The new node should be Hidden
-    CHECK(genome.nodes.back().type == NodeType::Hidden);
+    CHECK(genome.nodes().back().type == NodeType::Hidden);
 }
 
 TEST_CASE("mutate_add_node: original connection is disabled", "[mutation]") {
@@ -142,7 +142,7 @@ TEST_CASE("mutate_add_node: original connection is disabled", "[mutation]") {
 
     // Record enabled count before
     int enabled_before = 0;
-    for (const auto& c : genome.connections) {
+    for (const auto& c : genome.connections()) {
         if (c.enabled) ++enabled_before;
     }
 
@@ -150,7 +150,7 @@ TEST_CASE("mutate_add_node: original connection is disabled", "[mutation]") {
 
     // One old connection disabled, two new enabled → net +1 enabled
     int enabled_after = 0;
-    for (const auto& c : genome.connections) {
+    for (const auto& c : genome.connections()) {
         if (c.enabled) ++enabled_after;
     }
     CHECK(enabled_after == enabled_before + 1);
@@ -159,7 +159,7 @@ TEST_CASE("mutate_add_node: original connection is disabled", "[mutation]") {
 TEST_CASE("mutate_add_node: preserves behaviour (weight 1.0 in, original out)", "[mutation]") {
     NeatGenome genome = make_minimal(2, 1);
     // Set the first connection's weight to 3.5
-    genome.connections[0].weight = 3.5f;
+    genome.set_weight(0, 3.5f);
 
     InnovationTracker tracker(100);
     // Use a fixed seed that will pick connection 0
@@ -168,8 +168,8 @@ TEST_CASE("mutate_add_node: preserves behaviour (weight 1.0 in, original out)",
     mutate_add_node(genome, rng, tracker);
 
     // Find the two new connections (last two added)
-    auto& new_conn1 = genome.connections[genome.connections.size() - 2];
-    auto& new_conn2 = genome.connections[genome.connections.size() - 1];
+    ConnectionGene new_conn1 = genome.connections()[genome.connections().size() - 2];
+    ConnectionGene new_conn2 = genome.connections()[genome.connections().size() - 1];
 
     // One should have weight 1.0, the other should have the original weight
     // source→new has weight 1.0, new→target has original weight
@@ -181,7 +181,7 @@ TEST_CASE("mutate_add_node: preserves behaviour (weight 1.0 in, original out)",
 
 TEST_CASE("mutate_add_node: no enabled connections returns false", "[mutation]") {
     NeatGenome genome = make_minimal(2, 1);
-    for (auto& c : genome.connections) c.enabled = false;
+    for (size_t c = 0; c < genome.connections().size(); ++c) genome.set_enabled(c, false);
 
     InnovationTracker tracker(100);
     std::mt19937 rng(42);
@@ -194,7 +194,7 @@ TEST_CASE("mutate_add_node: no enabled connections returns false", "[mutation]")
 TEST_CASE("mutate_toggle_connection: flips enabled state", "[mutation]") {
     NeatGenome genome = make_minimal(2, 1);
     // All start enabled
-    for (const auto& c : genome.connections) {
+    for (const auto& c : genome.connections()) {
         REQUIRE(c.enabled);
     }
 
@@ -203,7 +203,7 @@ TEST_CASE("mutate_toggle_connection: flips enabled state", "[mutation]") {
 
     // Exactly one should now be disabled
     int disabled = 0;
-    for (const auto& c : genome.connections) {
+    for (const auto& c : genome.connections()) {
         if (!c.enabled) ++disabled;
     }
     CHECK(disabled == 1);
@@ -213,13 +213,13 @@ TEST_CASE("mutate_toggle_connection: flips enabled state", "[mutation]") {
 
 TEST_CASE("mutate_delete_connection: removes a connection", "[mutation]") {
     NeatGenome genome = make_minimal(3, 2);
-    size_t before = genome.connections.size();
+    size_t before = genome.connections().size();
 
     std::mt19937 rng(42);
     bool deleted = mutate_delete_connection(genome, rng);
 
     CHECK(deleted);
-    CHECK(genome.connections.size() == before - 1);
+    CHECK(genome.connections().size() == before - 1);
 }
 
 TEST_CASE("mutate_delete_connection: orphaned hidden node is removed", "[mutation]") {
@@ -229,18 +229,16 @@ TEST_CASE("mutate_delete_connection: orphaned hidden node is removed", "[mutatio
 
     // Add a hidden node (splits a connection)
     mutate_add_node(genome, rng, tracker);
-    size_t nodes_with_hidden = genome.nodes.size();
+    size_t nodes_with_hidden = genome.nodes().size();
     CHECK(nodes_with_hidden == 4); // 2 input + 1 output + 1 hidden
 
     // Find and delete both connections involving the hidden node
-    int hidden_id = genome.nodes.back().id;
+    int hidden_id = genome.nodes().back().id;
     // Remove connections touching the hidden node
-    genome.connections.erase(
-        std::remove_if(genome.connections.begin(), genome.connections.end(),
-            [&](const ConnectionGene& c) {
-                return c.source == hidden_id || c.target == hidden_id;
-            }),
-        genome.connections.end());
+    for (size_t i = genome.connections().size(); i-- > 0;) {
+        ConnectionGene c = genome.connection(i);
+        if (c.source == hidden_id || c.target == hidden_id) genome.remove_connection(i);
+    }
 
     // Now manually trigger orphan cleanup by calling delete on any remaining connection
     // Actually, let's do it properly: the orphan cleanup happens inside mutate_delete_connection.
@@ -254,7 +252,7 @@ TEST_CASE("mutate_delete_connection: orphaned hidden node is removed", "[mutatio
 
     // Find the hidden node
     hidden_id = -1;
-    for (const auto& n : genome.nodes) {
+    for (const auto& n : genome.nodes()) {
         if (n.type == NodeType::Hidden) { hidden_id = n.id; break; }
     }
     REQUIRE(hidden_id >= 0);
@@ -262,10 +260,10 @@ TEST_CASE("mutate_delete_connection: orphaned hidden node is removed", "[mutatio
     // Delete connections involving hidden node until it becomes orphaned
     while (true) {
         bool found = false;
-        for (int i = 0; i < static_cast<int>(genome.connections.size()); ++i) {
-            if (genome.connections[i].source == hidden_id ||
-                genome.connections[i].target == hidden_id) {
-                genome.connections.erase(genome.connections.begin() + i);
+        for (int i = 0; i < static_cast<int>(genome.connections().size()); ++i) {
+            if (genome.connections()[i].source == hidden_id ||
+                genome.connections()[i].target == hidden_id) {
+                genome.remove_connection(i);
                 found = true;
                 break;
             }
@@ -275,14 +273,14 @@ TEST_CASE("mutate_delete_connection: orphaned hidden node is removed", "[mutatio
 
     // Hidden node still exists but is orphaned — call delete to trigger cleanup
     // Need at least one connection to delete
-    if (!genome.connections.empty()) {
+    if (!genome.connections().empty()) {
         // Add dummy connection to delete
         mutate_delete_connection(genome, rng2);
     }
 
     // After deletion + cleanup, hidden node should be gone
     bool hidden_exists = false;
-    for (const auto& n : genome.nodes) {
+    for (const auto& n : genome.nodes()) {
         if (n.id == hidden_id) { hidden_exists = true; break; }
     }
     CHECK_FALSE(hidden_exists);
@@ -290,8 +288,8 @@ TEST_CASE("mutate_delete_connection: orphaned hidden node is removed", "[mutatio
 
 TEST_CASE("mutate_delete_connection: empty genome returns false", "[mutation]") {
     NeatGenome genome;
-    genome.nodes.push_back({0, NodeType::Input, ActivationFn::Linear, 0.0f});
-    genome.nodes.push_back({1, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
+    genome.add_node({0, NodeType::Input, ActivationFn::Linear, 0.0f});
+    genome.add_node({1, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
 
     std::mt19937 rng(42);
     CHECK_FALSE(mutate_delete_connection(genome, rng));
@@ -347,8 +345,8 @@ TEST_CASE("Many mutations produce diverse genomes", "[mutation]") {
             if (coin(rng) < 0.2f) mutate_delete_connection(genome, rng);
         }
 
-        node_counts.push_back(genome.nodes.size());
-        conn_counts.push_back(genome.connections.size());
+        node_counts.push_back(genome.nodes().size());
+        conn_counts.push_back(genome.connections().size());
     }
 
     // Should have some structural diversity
@@ -363,8 +361,8 @@ TEST_CASE("Many mutations produce diverse genomes", "[mutation]") {
 TEST_CASE("mutate_add_connection: allow_recurrent=false produces no recurrent connections", "[mutation]") {
     NeatGenome genome = make_minimal(3, 2);
     // Add hidden nodes to create room for connections
-    genome.nodes.push_back({10, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
-    genome.nodes.push_back({11, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
+    genome.add_node({10, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
+    genome.add_node({11, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
 
     InnovationTracker tracker(100);
     std::mt19937 rng(42);
@@ -373,7 +371,7 @@ TEST_CASE("mutate_add_connection: allow_recurrent=false produces no recurrent co
         mutate_add_connection(genome, rng, tracker, 20, false);
     }
 
-    for (const auto& c : genome.connections) {
+    for (const auto& c : genome.connections()) {
         CHECK_FALSE(c.recurrent);
     }
 }
@@ -395,7 +393,7 @@ TEST_CASE("mutate_add_connection: allow_recurrent=true produces some recurrent c
     }
 
     int recurrent_count = 0;
-    for (const auto& c : genome.connections) {
+    for (const auto& c : genome.connections()) {
         if (c.recurrent) ++recurrent_count;
     }
     CHECK(recurrent_count > 0);
@@ -404,42 +402,42 @@ TEST_CASE("mutate_add_connection: allow_recurrent=true produces some recurrent c
 TEST_CASE("mutate_add_node: splitting recurrent connection propagates recurrent flag", "[mutation]") {
     // Build a genome: input(0) → hidden(3) → output(2), plus output(2) → hidden(3) (recurrent)
     NeatGenome genome;
-    genome.nodes.push_back({0, NodeType::Input, ActivationFn::Linear, 0.0f});
-    genome.nodes.push_back({2, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
-    genome.nodes.push_back({3, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
+    genome.add_node({0, NodeType::Input, ActivationFn::Linear, 0.0f});
+    genome.add_node({2, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
+    genome.add_node({3, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
 
     // Feed-forward path: input → hidden → output
-    genome.connections.push_back({1, 0, 3, 1.0f, true, false});  // input→hidden (ff)
-    genome.connections.push_back({2, 3, 2, 1.0f, true, false});  // hidden→output (ff)
+    genome.add_connection({1, 0, 3, 1.0f, true, false});  // input→hidden (ff)
+    genome.add_connection({2, 3, 2, 1.0f, true, false});  // hidden→output (ff)
     // Recurrent: output → hidden
-    genome.connections.push_back({3, 2, 3, 0.5f, true, true});   // output→hidden (recurrent)
+    genome.add_connection({3, 2, 3, 0.5f, true, true});   // output→hidden (recurrent)
 
     InnovationTracker tracker(100);
 
     // Force split the recurrent connection (index 2: output→hidden)
     // We'll do it manually to target the specific connection
     // Save values
-    int src_id = genome.connections[2].source;  // output(2)
-    int tgt_id = genome.connections[2].target;  // hidden(3)
-    REQUIRE(genome.connections[2].recurrent);
+    int src_id = genome.connections()[2].source;  // output(2)
+    int tgt_id = genome.connections()[2].target;  // hidden(3)
+    REQUIRE(genome.connections()[2].recurrent);
 
     // Disable original
-    genome.connections[2].enabled = false;
+    genome.set_enabled(2, false);
 
     // Split: output(2) → new(4) → hidden(3)
-    genome.nodes.push_back({4, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
+    genome.add_node({4, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
     // Use mutate_add_node indirectly by setting up the same scenario
     // Actually, let's just call mutate_add_node with a rigged RNG that picks connection index 2
     // Simpler: reconstruct and use the function directly
 
     // Reset and test via the actual function
     genome = NeatGenome{};
-    genome.nodes.push_back({0, NodeType::Input, ActivationFn::Linear, 0.0f});
-    genome.nodes.push_back({2, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
-    genome.nodes.push_back({3, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
-    genome.connections.push_back({1, 0, 3, 1.0f, true, false});
-    genome.connections.push_back({2, 3, 2, 1.0f, true, false});
-    genome.connections.push_back({3, 2, 3, 0.5f, true, true});
+    genome.add_node({0, NodeType::Input, ActivationFn::Linear, 0.0f});
+    genome.add_node({2, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
+    genome.add_node({3, NodeType::Hidden, ActivationFn::Sigmoid, 0.0f});
+    genome.add_connection({1, 0, 3, 1.0f, true, false});
+    genome.add_connection({2, 3, 2, 1.0f, true, false});
+    genome.add_connection({3, 2, 3, 0.5f, true, true});
 
     // Only the recurrent connection should be split if the RNG picks it.
     // Try many times — at least once we should split connection index 2.
@@ -451,12 +449,12 @@ TEST_CASE("mutate_add_node: splitting recurrent connection propagates recurrent
         mutate_add_node(g, rng, t);
 
         // Check if connection index 2 (the recurrent one) was disabled
-        if (!g.connections[2].enabled) {
+        if (!g.connections()[2].enabled) {
             tested_recurrent_split = true;
 
             // The two new connections are the last two
-            auto& c1 = g.connections[g.connections.size() - 2]; // output(2) → new
-            auto& c2 = g.connections[g.connections.size() - 1]; // new → hidden(3)
+            ConnectionGene c1 = g.connections()[g.connections().size() - 2]; // output(2) → new
+            ConnectionGene c2 = g.connections()[g.connections().size() - 1]; // new → hidden(3)
 
             // output(2) → new: output is downstream, so this must be recurrent
             CHECK(c1.source == 2);
@@ -492,7 +490,7 @@ TEST_CASE("Recurrent genome round-trip through save/load", "[mutation]") {
 
     // Verify we have at least one recurrent connection
     int recurrent_count = 0;
-    for (const auto& c : genome.connections) {
+    for (const auto& c : genome.connections()) {
         if (c.recurrent) ++recurrent_count;
     }
     REQUIRE(recurrent_count > 0);
@@ -520,10 +518,10 @@ TEST_CASE("Recurrent genome round-trip through save/load", "[mutation]") {
     BoidSpec loaded = load_boid_spec(tmp_path);
 
     REQUIRE(loaded.genome.has_value());
-    CHECK(loaded.genome->connections.size() == genome.connections.size());
+    CHECK(loaded.genome->connections().size() == genome.connections().size());
 
     // Verify recurrent flags match
-    for (size_t i = 0; i < genome.connections.size(); ++i) {
-        CHECK(loaded.genome->connections[i].recurrent == genome.connections[i].recurrent);
+    for (size_t i = 0; i < genome.connections().size(); ++i) {
+        CHECK(loaded.genome->connections()[i].recurrent == genome.connections()[i].recurrent);
     }
 }
@@ -6,10 +6,10 @@ TEST_CASE("Minimal genome: correct node count and types", "[neat_genome]") {
     int next_innov = 1;
     NeatGenome g = NeatGenome::minimal(7, 4, next_innov);
 
-    REQUIRE(g.nodes.size() == 11); // 7 input + 4 output
+    REQUIRE(g.nodes().size() == 11); // 7 input + 4 output
 
     int input_count = 0, output_count = 0, hidden_count = 0;
-    for (const auto& n : g.nodes) {
+    for (const auto& n : g.nodes()) {
         switch (n.type) {
             case NodeType::Input:  ++input_count;  break;
             case NodeType::Output: ++output_count; break;
@@ -27,10 +27,10 @@ TEST_CASE("Minimal genome: fully connected input→output", "[neat_genome]") {
     NeatGenome g = NeatGenome::minimal(7, 4, next_innov);
 
     // 7 inputs × 4 outputs = 28 connections
-    REQUIRE(g.connections.size() == 28);
+    REQUIRE(g.connections().size() == 28);
 
     // All connections should be enabled
-    for (const auto& c : g.connections) {
+    for (const auto& c : g.connections()) {
         CHECK(c.enabled);
     }
 }
@@ -40,7 +40,7 @@ TEST_CASE("Minimal genome: unique innovation numbers", "[neat_genome]") {
     NeatGenome g = NeatGenome::minimal(7, 4, next_innov);
 
     std::set<int> innovations;
-    for (const auto& c : g.connections) {
+    for (const auto& c : g.connections()) {
         innovations.insert(c.innovation);
     }
 
@@ -55,7 +55,7 @@ TEST_CASE("Minimal genome: connections link inputs to outputs only", "[neat_geno
     NeatGenome g = NeatGenome::minimal(3, 2, next_innov);
 
     // Input ids: 0, 1, 2. Output ids: 3, 4.
-    for (const auto& c : g.connections) {
+    for (const auto& c : g.connections()) {
         // Source must be an input node (id < 3)
         CHECK(c.source < 3);
         // Target must be an output node (id >= 3)
@@ -68,9 +68,9 @@ TEST_CASE("Minimal genome: node ids are sequential", "[neat_genome]") {
     int next_innov = 1;
     NeatGenome g = NeatGenome::minimal(3, 2, next_innov);
 
-    REQUIRE(g.nodes.size() == 5);
+    REQUIRE(g.nodes().size() == 5);
     for (int i = 0; i < 5; ++i) {
-        CHECK(g.nodes[i].id == i);
+        CHECK(g.nodes()[i].id == i);
     }
 }
 
@@ -78,7 +78,7 @@ TEST_CASE("Minimal genome: input nodes have Linear activation", "[neat_genome]")
     int next_innov = 1;
     NeatGenome g = NeatGenome::minimal(3, 2, next_innov);
 
-    for (const auto& n : g.nodes) {
+    for (const auto& n : g.nodes()) {
         if (n.type == NodeType::Input) {
             CHECK(n.activation == ActivationFn::Linear);
         }
@@ -89,7 +89,7 @@ TEST_CASE("Minimal genome: output nodes have Sigmoid activation", "[neat_genome]
     int next_innov = 1;
     NeatGenome g = NeatGenome::minimal(3, 2, next_innov);
 
-    for (const auto& n : g.nodes) {
+    for (const auto& n : g.nodes()) {
         if (n.type == NodeType::Output) {
             CHECK(n.activation == ActivationFn::Sigmoid);
         }
@@ -100,7 +100,7 @@ TEST_CASE("Minimal genome: all weights start at zero", "[neat_genome]") {
     int next_innov = 1;
     NeatGenome g = NeatGenome::minimal(7, 4, next_innov);
 
-    for (const auto& c : g.connections) {
+    for (const auto& c : g.connections()) {
         CHECK(c.weight == 0.0f);
     }
 }
@@ -110,7 +110,63 @@ TEST_CASE("Minimal genome: innovation counter is consumed correctly", "[neat_gen
     NeatGenome g = NeatGenome::minimal(2, 3, next_innov);
 
     // 2×3 = 6 connections, starting at innovation 100
-    CHECK(g.connections[0].innovation == 100);
-    CHECK(g.connections[5].innovation == 105);
+    CHECK(g.connections()[0].innovation == 100);
+    CHECK(g.connections()[5].innovation == 105);
     CHECK(next_innov == 106);
 }
+
+TEST_CASE("Genome: copies share topology until one changes structure", "[neat_genome]") {
+    int next_innov = 1;
+    NeatGenome a = NeatGenome::minimal(2, 2, next_innov);
+    NeatGenome b = a;
+    REQUIRE(b.shares_topology(a));
+
+    // Values are per genome and leave the topology shared
+    b.set_weight(0, 1.5f);
+    b.set_enabled(1, false);
+    b.set_bias(2, -0.5f);
+    CHECK(b.shares_topology(a));
+    CHECK(a.connections()[0].weight == 0.0f);
+    CHECK(a.connections()[1].enabled);
+    CHECK(a.nodes()[2].bias == 0.0f);
+    CHECK(b.connections()[0].weight == 1.5f);
+    CHECK_FALSE(b.connections()[1].enabled);
+    CHECK(b.nodes()[2].bias == -0.5f);
+
+    // A structural edit copies the topology first
+    b.add_node({4, NodeType::Hidden, ActivationFn::Tanh, 0.25f});
+    b.add_connection({next_innov, 0, 4, 2.0f, true, false});
+    CHECK_FALSE(b.shares_topology(a));
+    CHECK(a.nodes().size() == 4);
+    CHECK(a.connections().size() == 4);
+    CHECK(b.nodes().size() == 5);
+    CHECK(b.connections().size() == 5);
+    CHECK(b.connections()[0].weight == 1.5f);
+    CHECK(b.nodes()[4].activation == ActivationFn::Tanh);
+}
+
+TEST_CASE("Genome: removing genes keeps values aligned", "[neat_genome]") {
+    NeatGenome g({{0, NodeType::Input, ActivationFn::Linear, 0.0f},
+                  {1, NodeType::Output, ActivationFn::Sigmoid, 0.5f},
+                  {2, NodeType::Hidden, ActivationFn::ReLU, -1.0f}},
+                 {{1, 0, 1, 0.1f, true, false},
+                  {2, 0, 2, 0.2f, false, false},
+                  {3, 2, 1, 0.3f, true, true}});
+    NeatGenome copy = g;
+
+    g.remove_connection(1);
+    g.remove_node(1);
+    REQUIRE(g.connections().size() == 2);
+    CHECK(g.connections()[0].weight == 0.1f);
+    CHECK(g.connections()[1].innovation == 3);
+    CHECK(g.connections()[1].weight == 0.3f);
+    CHECK(g.connections()[1].recurrent);
+    REQUIRE(g.nodes().size() == 2);
+    CHECK(g.nodes()[1].id == 2);
+    CHECK(g.nodes()[1].bias == -1.0f);
+
+    // The copy kept the original structure
+    CHECK(copy.connections().size() == 3);
+    CHECK(copy.nodes().size() == 3);
+    CHECK_FALSE(copy.connections()[1].enabled);
+}
@@ -28,7 +28,7 @@ TEST_CASE("NeatNetwork: single large positive weight → output near 1", "[neat_
     int next_innov = 1;
     NeatGenome g = NeatGenome::minimal(2, 1, next_innov);
     // Set weight on first connection (input 0 → output 0) to large positive
-    g.connections[0].weight = 10.0f;
+    g.set_weight(0, 10.0f);
 
     NeatNetwork net(g);
 
@@ -42,7 +42,7 @@ TEST_CASE("NeatNetwork: single large positive weight → output near 1", "[neat_
 TEST_CASE("NeatNetwork: single large negative weight → output near 0", "[neat_network]") {
     int next_innov = 1;
     NeatGenome g = NeatGenome::minimal(2, 1, next_innov);
-    g.connections[0].weight = -10.0f;
+    g.set_weight(0, -10.0f);
 
     NeatNetwork net(g);
 
@@ -59,12 +59,12 @@ TEST_CASE("NeatNetwork: matches DirectWireNetwork for minimal genome", "[neat_ne
 
     // Set some weights
     // Connection layout: input 0→out 0, input 0→out 1, input 1→out 0, input 1→out 1, input 2→out 0, input 2→out 1
-    g.connections[0].weight = 1.0f;   // in0 → out0
-    g.connections[1].weight = -0.5f;  // in0 → out1
-    g.connections[2].weight = 2.0f;   // in1 → out0
-    g.connections[3].weight = 0.3f;   // in1 → out1
-    g.connections[4].weight = -1.0f;  // in2 → out0
-    g.connections[5].weight = 0.7f;   // in2 → out1
+    g.set_weight(0, 1.0f);   // in0 → out0
+    g.set_weight(1, -0.5f);  // in0 → out1
+    g.set_weight(2, 2.0f);   // in1 → out0
+    g.set_weight(3, 0.3f);   // in1 → out1
+    g.set_weight(4, -1.0f);  // in2 → out0
+    g.set_weight(5, 0.7f);   // in2 → out1
 
     NeatNetwork neat_net(g);
 
@@ -90,8 +90,8 @@ TEST_CASE("NeatNetwork: matches DirectWireNetwork for minimal genome", "[neat_ne
 TEST_CASE("NeatNetwork: disabled connection is ignored", "[neat_network]") {
     int next_innov = 1;
     NeatGenome g = NeatGenome::minimal(1, 1, next_innov);
-    g.connections[0].weight = 10.0f;
-    g.connections[0].enabled = false;
+    g.set_weight(0, 10.0f);
+    g.set_enabled(0, false);
 
     NeatNetwork net(g);
 
@@ -107,7 +107,7 @@ TEST_CASE("NeatNetwork: output node bias works", "[neat_network]") {
     int next_innov = 1;
     NeatGenome g = NeatGenome::minimal(1, 1, next_innov);
     // Set bias on the output node (node id 1, index 1)
-    g.nodes[1].bias = 3.0f;
+    g.set_bias(1, 3.0f);
 
     NeatNetwork net(g);
 
@@ -121,14 +121,14 @@ TEST_CASE("NeatNetwork: output node bias works", "[neat_network]") {
 TEST_CASE("NeatNetwork: one hidden node (input → hidden → output)", "[neat_network]") {
     // Manually build a genome: 1 input, 1 hidden, 1 output
     NeatGenome g;
-    g.nodes.push_back({0, NodeType::Input, ActivationFn::Linear, 0.0f});
-    g.nodes.push_back({1, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
-    g.nodes.push_back({2, NodeType::Hidden, ActivationFn::Tanh, 0.0f});
+    g.add_node({0, NodeType::Input, ActivationFn::Linear, 0.0f});
+    g.add_node({1, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
+    g.add_node({2, NodeType::Hidden, ActivationFn::Tanh, 0.0f});
 
     // input(0) → hidden(2), weight = 1.0
-    g.connections.push_back({1, 0, 2, 1.0f, true});
+    g.add_connection({1, 0, 2, 1.0f, true});
     // hidden(2) → output(1), weight = 2.0
-    g.connections.push_back({2, 2, 1, 2.0f, true});
+    g.add_connection({2, 2, 1, 2.0f, true});
 
     NeatNetwork net(g);
 
@@ -147,14 +147,14 @@ TEST_CASE("NeatNetwork: one hidden node (input → hidden → output)", "[neat_n
 TEST_CASE("NeatNetwork: two hidden nodes in chain", "[neat_network]") {
     // input(0) → hidden_a(2) → hidden_b(3) → output(1)
     NeatGenome g;
-    g.nodes.push_back({0, NodeType::Input, ActivationFn::Linear, 0.0f});
-    g.nodes.push_back({1, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
-    g.nodes.push_back({2, NodeType::Hidden, ActivationFn::Tanh, 0.0f});
-    g.nodes.push_back({3, NodeType::Hidden, ActivationFn::ReLU, 0.0f});
+    g.add_node({0, NodeType::Input, ActivationFn::Linear, 0.0f});
+    g.add_node({1, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
+    g.add_node({2, NodeType::Hidden, ActivationFn::Tanh, 0.0f});
+    g.add_node({3, NodeType::Hidden, ActivationFn::ReLU, 0.0f});
 
-    g.connections.push_back({1, 0, 2, 1.5f, true});  // in → hidden_a
-    g.connections.push_back({2, 2, 3, -1.0f, true});  // hidden_a → hidden_b
-    g.connections.push_back({3, 3, 1, 2.0f, true});   // hidden_b → output
+    g.add_connection({1, 0, 2, 1.5f, true});  // in → hidden_a
+    g.add_connection({2, 2, 3, -1.0f, true});  // hidden_a → hidden_b
+    g.add_connection({3, 3, 1, 2.0f, true});   // hidden_b → output
 
     NeatNetwork net(g);
 
@@ -173,15 +173,15 @@ TEST_CASE("NeatNetwork: diamond topology (two paths to output)", "[neat_network]
     // input(0) → hidden_a(2) → output(1)
     //         → hidden_b(3) → output(1)
     NeatGenome g;
-    g.nodes.push_back({0, NodeType::Input, ActivationFn::Linear, 0.0f});
-    g.nodes.push_back({1, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
-    g.nodes.push_back({2, NodeType::Hidden, ActivationFn::Tanh, 0.0f});
-    g.nodes.push_back({3, NodeType::Hidden, ActivationFn::Tanh, 0.0f});
+    g.add_node({0, NodeType::Input, ActivationFn::Linear, 0.0f});
+    g.add_node({1, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
+    g.add_node({2, NodeType::Hidden, ActivationFn::Tanh, 0.0f});
+    g.add_node({3, NodeType::Hidden, ActivationFn::Tanh, 0.0f});
 
-    g.connections.push_back({1, 0, 2, 1.0f, true});   // in → ha
-    g.connections.push_back({2, 0, 3, -1.0f, true});   // in → hb
-    g.connections.push_back({3, 2, 1, 1.0f, true});    // ha → out
-    g.connections.push_back({4, 3, 1, 1.0f, true});    // hb → out
+    g.add_connection({1, 0, 2, 1.0f, true});   // in → ha
+    g.add_connection({2, 0, 3, -1.0f, true});   // in → hb
+    g.add_connection({3, 2, 1, 1.0f, true});    // ha → out
+    g.add_connection({4, 3, 1, 1.0f, true});    // hb → out
 
     NeatNetwork net(g);
 
@@ -201,7 +201,7 @@ TEST_CASE("NeatNetwork: diamond topology (two paths to output)", "[neat_network]
 TEST_CASE("NeatNetwork: reset clears node values", "[neat_network]") {
     int next_innov = 1;
     NeatGenome g = NeatGenome::minimal(1, 1, next_innov);
-    g.connections[0].weight = 5.0f;
+    g.set_weight(0, 5.0f);
 
     NeatNetwork net(g);
 
@@ -221,7 +221,7 @@ TEST_CASE("NeatNetwork: reset clears node values", "[neat_network]") {
 TEST_CASE("NeatNetwork: polymorphic use via ProcessingNetwork", "[neat_network]") {
     int next_innov = 1;
     NeatGenome g = NeatGenome::minimal(2, 2, next_innov);
-    g.connections[0].weight = 3.0f; // in0 → out0
+    g.set_weight(0, 3.0f); // in0 → out0
 
     auto net = std::make_unique<NeatNetwork>(g);
     ProcessingNetwork* brain = net.get();
@@ -239,13 +239,13 @@ TEST_CASE("NeatNetwork: polymorphic use via ProcessingNetwork", "[neat_network]"
 TEST_CASE("Recurrent: self-connection provides memory", "[neat_network][recurrent]") {
     // input(0) → hidden(2) → output(1), plus hidden(2) → hidden(2) recurrent self-connection
     NeatGenome g;
-    g.nodes.push_back({0, NodeType::Input, ActivationFn::Linear, 0.0f});
-    g.nodes.push_back({1, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
-    g.nodes.push_back({2, NodeType::Hidden, ActivationFn::Tanh, 0.0f});
+    g.add_node({0, NodeType::Input, ActivationFn::Linear, 0.0f});
+    g.add_node({1, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
+    g.add_node({2, NodeType::Hidden, ActivationFn::Tanh, 0.0f});
 
-    g.connections.push_back({1, 0, 2, 1.0f, true, false});  // in → hidden (ff)
-    g.connections.push_back({2, 2, 1, 2.0f, true, false});  // hidden → out (ff)
-    g.connections.push_back({3, 2, 2, 0.9f, true, true});   // hidden → hidden (recurrent self)
+    g.add_connection({1, 0, 2, 1.0f, true, false});  // in → hidden (ff)
+    g.add_connection({2, 2, 1, 2.0f, true, false});  // hidden → out (ff)
+    g.add_connection({3, 2, 2, 0.9f, true, true});   // hidden → hidden (recurrent self)
 
     NeatNetwork net(g);
 
@@ -283,13 +283,13 @@ TEST_CASE("Recurrent: self-connection provides memory", "[neat_network][recurren
 TEST_CASE("Recurrent: output-to-hidden reads previous tick", "[neat_network][recurrent]") {
     // input(0) → output(1) feed-forward, output(1) → hidden(2) recurrent, hidden(2) → output(1) ff
     NeatGenome g;
-    g.nodes.push_back({0, NodeType::Input, ActivationFn::Linear, 0.0f});
-    g.nodes.push_back({1, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
-    g.nodes.push_back({2, NodeType::Hidden, ActivationFn::Tanh, 0.0f});
+    g.add_node({0, NodeType::Input, ActivationFn::Linear, 0.0f});
+    g.add_node({1, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
+    g.add_node({2, NodeType::Hidden, ActivationFn::Tanh, 0.0f});
 
-    g.connections.push_back({1, 0, 1, 2.0f, true, false});  // in → out (ff)
-    g.connections.push_back({2, 1, 2, 1.0f, true, true});   // out → hidden (recurrent)
-    g.connections.push_back({3, 2, 1, 1.0f, true, false});  // hidden → out (ff)
+    g.add_connection({1, 0, 1, 2.0f, true, false});  // in → out (ff)
+    g.add_connection({2, 1, 2, 1.0f, true, true});   // out → hidden (recurrent)
+    g.add_connection({3, 2, 1, 1.0f, true, false});  // hidden → out (ff)
 
     NeatNetwork net(g);
 
@@ -319,12 +319,12 @@ TEST_CASE("Recurrent: output-to-hidden reads previous tick", "[neat_network][rec
 TEST_CASE("Recurrent: zero recurrent connections = identical to feed-forward", "[neat_network][recurrent]") {
     // Build a feed-forward network (no recurrent flags set)
     NeatGenome g;
-    g.nodes.push_back({0, NodeType::Input, ActivationFn::Linear, 0.0f});
-    g.nodes.push_back({1, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
-    g.nodes.push_back({2, NodeType::Hidden, ActivationFn::Tanh, 0.0f});
+    g.add_node({0, NodeType::Input, ActivationFn::Linear, 0.0f});
+    g.add_node({1, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
+    g.add_node({2, NodeType::Hidden, ActivationFn::Tanh, 0.0f});
 
-    g.connections.push_back({1, 0, 2, 1.5f, true, false});
-    g.connections.push_back({2, 2, 1, 2.0f, true, false});
+    g.add_connection({1, 0, 2, 1.5f, true, false});
+    g.add_connection({2, 2, 1, 2.0f, true, false});
 
     NeatNetwork net(g);
 
@@ -346,13 +346,13 @@ TEST_CASE("Recurrent: zero recurrent connections = identical to feed-forward", "
 TEST_CASE("Recurrent: reset clears recurrent state", "[neat_network][recurrent]") {
     // Same self-connection network as the memory test
     NeatGenome g;
-    g.nodes.push_back({0, NodeType::Input, ActivationFn::Linear, 0.0f});
-    g.nodes.push_back({1, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
-    g.nodes.push_back({2, NodeType::Hidden, ActivationFn::Tanh, 0.0f});
+    g.add_node({0, NodeType::Input, ActivationFn::Linear, 0.0f});
+    g.add_node({1, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
+    g.add_node({2, NodeType::Hidden, ActivationFn::Tanh, 0.0f});
 
-    g.connections.push_back({1, 0, 2, 1.0f, true, false});
-    g.connections.push_back({2, 2, 1, 2.0f, true, false});
-    g.connections.push_back({3, 2, 2, 0.9f, true, true});  // recurrent self
+    g.add_connection({1, 0, 2, 1.0f, true, false});
+    g.add_connection({2, 2, 1, 2.0f, true, false});
+    g.add_connection({3, 2, 2, 0.9f, true, true});  // recurrent self
 
     NeatNetwork net(g);
 
@@ -378,13 +378,13 @@ TEST_CASE("Recurrent: cycle via recurrent connection activates correctly", "[nea
     // Create a would-be cycle: input(0) → hidden(2) → output(1) → hidden(2)
     // The output→hidden connection is recurrent, breaking the cycle
     NeatGenome g;
-    g.nodes.push_back({0, NodeType::Input, ActivationFn::Linear, 0.0f});
-    g.nodes.push_back({1, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
-    g.nodes.push_back({2, NodeType::Hidden, ActivationFn::Tanh, 0.0f});
+    g.add_node({0, NodeType::Input, ActivationFn::Linear, 0.0f});
+    g.add_node({1, NodeType::Output, ActivationFn::Sigmoid, 0.0f});
+    g.add_node({2, NodeType::Hidden, ActivationFn::Tanh, 0.0f});
 
-    g.connections.push_back({1, 0, 2, 1.0f, true, false});  // in → hidden (ff)
-    g.connections.push_back({2, 2, 1, 1.0f, true, false});  // hidden → out (ff)
-    g.connections.push_back({3, 1, 2, 0.5f, true, true});   // out → hidden (recurrent)
+    g.add_connection({1, 0, 2, 1.0f, true, false});  // in → hidden (ff)
+    g.add_connection({2, 2, 1, 1.0f, true, false});  // hidden → out (ff)
+    g.add_connection({3, 1, 2, 0.5f, true, true});   // out → hidden (recurrent)
 
     // Should construct and activate without crashing
     NeatNetwork net(g);
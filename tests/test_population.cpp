@@ -2,7 +2,9 @@
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include "brain/population.h"
 #include "brain/neat_network.h"
+#include <algorithm>
 #include <cmath>
+#include <map>
 #include <numeric>
 #include <iostream>
 
@@ -98,7 +100,7 @@ TEST_CASE("Population: elitism preserves best genome", "[population]") {
 
     NeatGenome seed = make_minimal(2, 1);
     // Give seed distinctive weights
-    for (auto& c : seed.connections) c.weight = 42.0f;
+    for (size_t c = 0; c < seed.connections().size(); ++c) seed.set_weight(c, 42.0f);
     Population pop(seed, params, rng);
 
     // Evaluate: genome 0 gets highest fitness
@@ -112,7 +114,7 @@ TEST_CASE("Population: elitism preserves best genome", "[population]") {
     bool found_elite = false;
     for (int i = 0; i < pop.size(); ++i) {
         bool matches = true;
-        for (const auto& c : pop.genome(i).connections) {
+        for (const auto& c : pop.genome(i).connections()) {
             if (std::abs(c.weight - 42.0f) > 1e-4f) {
                 matches = false;
                 break;
@@ -150,6 +152,126 @@ TEST_CASE("Population: all genomes build valid networks", "[population]") {
     }
 }
 
+// Run a few generations with structural mutation turned up; fitness comes
+// from the genome itself so it doesn't consume the population's RNG.
+static Population evolve_structurally(int threads, int generations) {
+    PopulationParams params;
+    params.population_size = 80;
+    params.add_node_prob = 0.3f;
+    params.add_connection_prob = 0.5f;
+    params.delete_connection_prob = 0.05f;
+    params.allow_recurrent = true;
+    params.threads = threads;
+    std::mt19937 rng(9);
+    Population pop(make_minimal(), params, rng);
+
+    for (int gen = 0; gen < generations; ++gen) {
+        pop.evaluate([](int, const NeatGenome& g) {
+            float f = 0.0f;
+            for (const auto& c : g.connections()) f += std::abs(c.weight);
+            return f;
+        });
+        pop.advance_generation();
+    }
+    return pop;
+}
+
+TEST_CASE("Population: reproduction does not depend on thread count", "[population]") {
+    Population serial = evolve_structurally(1, 6);
+    Population parallel = evolve_structurally(4, 6);
+
+    REQUIRE(serial.size() == parallel.size());
+    CHECK(serial.species_count() == parallel.species_count());
+    CHECK(serial.innovation_tracker().next_innovation() ==
+          parallel.innovation_tracker().next_innovation());
+    for (int i = 0; i < serial.size(); ++i) {
+        const auto& a = serial.genome(i);
+        const auto& b = parallel.genome(i);
+        REQUIRE(a.nodes().size() == b.nodes().size());
+        REQUIRE(a.connections().size() == b.connections().size());
+        for (size_t k = 0; k < a.connections().size(); ++k) {
+            CHECK(a.connections()[k].innovation == b.connections()[k].innovation);
+            CHECK(a.connections()[k].source == b.connections()[k].source);
+            CHECK(a.connections()[k].target == b.connections()[k].target);
+            CHECK(a.connections()[k].weight == b.connections()[k].weight);
+            CHECK(a.connections()[k].enabled == b.connections()[k].enabled);
+        }
+    }
+}
+
+TEST_CASE("Population: children share topology unless their structure changed", "[population]") {
+    PopulationParams params;
+    params.population_size = 60;
+    std::mt19937 rng(3);
+    Population pop(make_minimal(), params, rng);
+    std::uniform_real_distribution<float> fitness_dist(0.0f, 10.0f);
+    for (int gen = 0; gen < 5; ++gen) {
+        pop.evaluate([&](int, const NeatGenome&) { return fitness_dist(rng); });
+        pop.advance_generation();
+    }
+
+    // Structural mutation is rare at the default rates, so most genomes
+    // reuse a topology another genome already holds
+    std::vector<const NeatGenome*> distinct;
+    for (const auto& g : pop.genomes()) {
+        bool seen = std::any_of(distinct.begin(), distinct.end(),
+                                [&](const NeatGenome* d) { return d->shares_topology(g); });
+        if (!seen) distinct.push_back(&g);
+    }
+    INFO("Distinct topologies: " << distinct.size());
+    CHECK(distinct.size() * 4 < static_cast<size_t>(pop.size()));
+}
+
+TEST_CASE("Population: one innovation number per new pair in a generation", "[population]") {
+    Population pop = evolve_structurally(4, 1);
+
+    // All structure beyond the seed arose in the same generation, so a
+    // source→target pair and its innovation number must map one to one
+    std::map<std::pair<int,int>, int> by_pair;
+    std::map<int, std::pair<int,int>> by_innovation;
+    for (const auto& g : pop.genomes()) {
+        for (const auto& c : g.connections()) {
+            auto pair = std::make_pair(c.source, c.target);
+            CHECK(c.innovation > 0);
+            auto [pit, pnew] = by_pair.emplace(pair, c.innovation);
+            CHECK(pit->second == c.innovation);
+            auto [iit, inew] = by_innovation.emplace(c.innovation, pair);
+            CHECK(iit->second == pair);
+        }
+    }
+}
+
+TEST_CASE("Population: immigrants replace the weakest genomes", "[population]") {
+    PopulationParams params;
+    params.population_size = 20;
+    std::mt19937 rng(42);
+    Population pop(make_minimal(), params, rng);
+    pop.evaluate([](int idx, const NeatGenome&) { return static_cast<float>(idx); });
+
+    auto top = pop.top_indices(3);
+    REQUIRE(top.size() == 3);
+    CHECK(top[0] == 19);
+    CHECK(top[2] == 17);
+
+    NeatGenome migrant = make_minimal();
+    for (size_t c = 0; c < migrant.connections().size(); ++c) migrant.set_weight(c, 1.5f);
+    pop.immigrate({migrant, migrant}, {100.0f, 99.0f});
+
+    // Slots 0 and 1 held the lowest fitness
+    CHECK_THAT(pop.fitness(0), WithinAbs(100.0f, 1e-6f));
+    CHECK_THAT(pop.fitness(1), WithinAbs(99.0f, 1e-6f));
+    CHECK(pop.genome(0).connections()[0].weight == 1.5f);
+    CHECK(pop.best_index() == 0);
+
+    // Every genome still belongs to exactly one species
+    int members = 0;
+    for (const auto& s : pop.species()) members += static_cast<int>(s.members.size());
+    CHECK(members == pop.size());
+
+    pop.advance_generation();
+    CHECK(pop.size() == 20);
+}
+
 // ---- XOR benchmark ----
 // NEAT's classic test: 2 inputs + 1 bias → 1 output.
 // XOR requires at least one hidden node, so this tests that structural
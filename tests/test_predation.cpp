@@ -1,6 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include "simulation/world.h"
+#include "simulation/toroidal.h"
 #include <random>
 
 using Catch::Matchers::WithinAbs;
@@ -233,3 +234,88 @@ TEST_CASE("Predation mouth: disabled reverts to omnidirectional catch", "[predat
 
     CHECK(!world.get_boids()[0].alive);  // prey caught — mouth disabled
 }
+
+TEST_CASE("Predation: catch radius wider than a grid cell", "[predation]") {
+    auto config = predation_config();
+    config.grid_cell_size = 20.0f;
+    config.predator_catch_radius = 45.0f;
+    World world(config);
+
+    world.add_boid(make_boid_at("prey", {100, 100}));
+    world.add_boid(make_boid_at("predator", {140, 100}));  // two cells away, within reach
+
+    world.step(1.0f / 120.0f);
+
+    CHECK(!world.get_boids()[0].alive);
+}
+
+TEST_CASE("Predation: crowded world matches a brute-force reach check", "[predation]") {
+    auto config = predation_config();
+    World world(config);
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> d(0.0f, 800.0f);
+    std::vector<Vec2> prey_pos, pred_pos;
+    for (int i = 0; i < 300; ++i) {
+        Vec2 p{d(rng), d(rng)};
+        prey_pos.push_back(p);
+        world.add_boid(make_boid_at("prey", p));
+    }
+    for (int i = 0; i < 100; ++i) {
+        Vec2 p{d(rng), d(rng)};
+        pred_pos.push_back(p);
+        world.add_boid(make_boid_at("predator", p));
+    }
+
+    world.step(0.0f);
+
+    float r_sq = config.predator_catch_radius * config.predator_catch_radius;
+    for (int i = 0; i < 300; ++i) {
+        bool in_reach = false;
+        for (const auto& p : pred_pos) {
+            if (toroidal_delta(p, prey_pos[i], 800, 800).length_squared() <= r_sq) in_reach = true;
+        }
+        CHECK(world.get_boids()[i].alive == !in_reach);
+    }
+}
+
+TEST_CASE("Predation: alive counts and survival ticks follow deaths", "[predation]") {
+    auto config = predation_config();
+    World world(config);
+
+    world.add_boid(make_boid_at("prey", {100, 100}));
+    world.add_boid(make_boid_at("prey", {400, 400}));
+    world.add_boid(make_boid_at("predator", {110, 100}));
+    CHECK(world.alive_count(TYPE_PREY) == 2);
+    CHECK(world.alive_count(TYPE_PREDATOR) == 1);
+
+    for (int i = 0; i < 5; ++i) world.step(1.0f / 120.0f);
+
+    CHECK(world.alive_count(TYPE_PREY) == 1);
+    CHECK(world.alive_count(TYPE_PREDATOR) == 1);
+    CHECK(world.tick_count() == 5);
+    CHECK(world.survival_ticks(0) == 0);  // caught in the first step
+    CHECK(world.survival_ticks(1) == 5);
+
+    // Reviving through the mutable accessor is picked up on the next step
+    world.get_boids_mut()[0].alive = true;
+    world.get_boids_mut()[0].energy = 100.0f;
+    world.get_boids_mut()[0].body.position = {600, 600};
+    world.step(1.0f / 120.0f);
+    CHECK(world.alive_count(TYPE_PREY) == 2);
+}
+
+TEST_CASE("Predation: starvation lowers the alive count", "[predation]") {
+    auto config = predation_config();
+    config.metabolism_rate = 100.0f;
+    World world(config);
+
+    world.add_boid(make_boid_at("prey", {100, 100}, 1.0f));
+    world.add_boid(make_boid_at("prey", {400, 400}, 1000.0f));
+
+    world.step(1.0f / 60.0f);
+
+    CHECK(!world.get_boids()[0].alive);
+    CHECK(world.alive_count(TYPE_PREY) == 1);
+    CHECK(world.survival_ticks(0) == 0);
+}
@@ -0,0 +1,50 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "simulation/rank_stability.h"
+
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("Rank stability: settles after patience unchanged rankings", "[rank_stability]") {
+    RankStability ranks(0.99f, 2);
+    CHECK(!ranks.observe({1, 2, 3, 4}));
+    CHECK(!ranks.observe({2, 4, 6, 8}));  // same order, different values
+    CHECK(ranks.observe({3, 5, 7, 9}));
+    CHECK_THAT(ranks.last_correlation(), WithinAbs(1.0f, 1e-6f));
+}
+
+TEST_CASE("Rank stability: a reshuffle resets the streak", "[rank_stability]") {
+    RankStability ranks(0.99f, 2);
+    ranks.observe({1, 2, 3, 4});
+    ranks.observe({1, 2, 3, 4});
+    CHECK(!ranks.observe({4, 3, 2, 1}));
+    CHECK_THAT(ranks.last_correlation(), WithinAbs(-1.0f, 1e-6f));
+    CHECK(!ranks.observe({4, 3, 2, 1}));
+    CHECK(ranks.observe({4, 3, 2, 1}));
+}
+
+TEST_CASE("Rank stability: an all-tied snapshot orders nobody", "[rank_stability]") {
+    RankStability ranks(0.99f, 1);
+    ranks.observe({0, 0, 0, 0});
+    CHECK(!ranks.observe({0, 0, 0, 0}));
+    CHECK_THAT(ranks.last_correlation(), WithinAbs(0.0f, 1e-6f));
+    CHECK(!ranks.observe({1, 2, 3, 4}));
+}
+
+TEST_CASE("Rank stability: a large tied block splitting up is not stable", "[rank_stability]") {
+    // Breaking the tie by index would make these two rankings identical
+    RankStability ranks(0.9f, 1);
+    ranks.observe({9, 0, 0, 0, 0, 0, 0, 0});
+    CHECK(!ranks.observe({9, 7, 6, 5, 4, 3, 2, 1}));
+    CHECK(ranks.last_correlation() < 0.6f);
+}
+
+TEST_CASE("Rank stability: ties use mid-ranks", "[rank_stability]") {
+    RankStability ranks(0.99f, 1);
+    ranks.observe({3, 1, 1, 0});
+    // Same ties, so the same mid-ranks
+    CHECK(ranks.observe({5, 2, 2, 1}));
+    CHECK_THAT(ranks.last_correlation(), WithinAbs(1.0f, 1e-6f));
+    // Splitting the tie keeps most of the order: ranks {0,1.5,1.5,3} vs {0,1,2,3}
+    CHECK(!ranks.observe({5, 3, 2, 1}));
+    CHECK_THAT(ranks.last_correlation(), WithinAbs(0.9487f, 1e-3f));
+}
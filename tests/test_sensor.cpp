@@ -5,6 +5,7 @@
 #include "simulation/boid.h"
 #include "simulation/world.h"
 #include <cmath>
+#include <random>
 #include <vector>
 
 using Catch::Matchers::WithinAbs;
@@ -1379,3 +1380,58 @@ TEST_CASE("Compound eye: hunger appended after noise", "[sensor][compound][hunge
     // [4] hunger: 1 - 75/100 = 0.25
     CHECK_THAT(outputs[4], WithinAbs(0.25f, 1e-6f));
 }
+
+// ---- Fused interaction pass ----
+
+static void check_fused_matches_perceive(bool toroidal) {
+    WorldConfig config;
+    config.width = 600;
+    config.height = 600;
+    config.toroidal = toroidal;
+    config.grid_cell_size = 100.0f;
+    config.metabolism_rate = 0.0f;
+    config.thrust_cost = 0.0f;
+    config.predator_catch_radius = 0.0f;  // nothing may change between sensing and the check
+    config.food_eat_radius = 0.0f;
+    config.prey_shoaling.radius = 60.0f;
+    config.prey_shoaling.max_reduction = 0.3f;
+    World world(config);
+
+    CompoundEyeConfig eyes;
+    eyes.channels = {SensorChannel::Food, SensorChannel::Same, SensorChannel::Opposite};
+    for (int e = 0; e < 6; ++e) {
+        eyes.eyes.push_back({e, (e * 60.0f - 150.0f) * DEG, 70.0f * DEG, 120.0f});
+    }
+    eyes.long_range_eyes.push_back({6, 0.0f, 20.0f * DEG, 250.0f});
+    eyes.has_shoaling_sensor = true;
+    eyes.has_hunger_sensor = true;
+
+    std::mt19937 rng(21);
+    std::uniform_real_distribution<float> d(0.0f, 600.0f);
+    for (int i = 0; i < 80; ++i) {
+        Boid b = make_boid({d(rng), d(rng)}, d(rng), i < 60 ? "prey" : "predator");
+        b.energy = 100.0f;
+        b.initial_energy = 100.0f;
+        b.sensors.emplace(eyes);
+        world.add_boid(std::move(b));
+    }
+    for (int i = 0; i < 100; ++i) world.add_food(Food{{d(rng), d(rng)}, 1.0f});
+
+    world.step(0);
+
+    const auto& boids = world.get_boids();
+    for (int i = 0; i < static_cast<int>(boids.size()); ++i) {
+        std::vector<float> expected(boids[i].sensors->input_count());
+        boids[i].sensors->perceive(boids, world.grid(), world.get_config(), i,
+                                   world.get_food(), expected.data());
+        CHECK(boids[i].sensor_outputs == expected);
+    }
+}
+
+TEST_CASE("Fused interaction pass matches perceive() on a torus", "[sensor][compound]") {
+    check_fused_matches_perceive(true);
+}
+
+TEST_CASE("Fused interaction pass matches perceive() in a bounded world", "[sensor][compound]") {
+    check_fused_matches_perceive(false);
+}
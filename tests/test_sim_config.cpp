@@ -1,19 +1,12 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include "io/sim_config.h"
+#include "io/data_path.h"
 #include <filesystem>
 #include <fstream>
 
 using Catch::Matchers::WithinAbs;
 
-static std::string data_path(const std::string& filename) {
-    for (const auto& prefix : {"data/", "../data/", "../../data/"}) {
-        std::string path = std::string(prefix) + filename;
-        if (std::filesystem::exists(path)) return path;
-    }
-    return "data/" + filename;
-}
-
 TEST_CASE("Load sim_config.json", "[sim_config]") {
     SimConfig cfg = load_sim_config(data_path("sim_config.json"));
 
@@ -143,6 +136,43 @@ TEST_CASE("Sim config: fitnessMode net parsed", "[sim_config]") {
     std::filesystem::remove(tmp_path);
 }
 
+TEST_CASE("Sim config: episodes defaults to 1 and is parsed", "[sim_config]") {
+    std::string tmp_path = "test_episodes.json";
+    {
+        std::ofstream f(tmp_path);
+        f << R"({"evolution": {"episodes": 4}})";
+    }
+
+    CHECK(SimConfig{}.episodes == 1);
+    SimConfig cfg = load_sim_config(tmp_path);
+    CHECK(cfg.episodes == 4);
+
+    std::filesystem::remove(tmp_path);
+}
+
+TEST_CASE("Sim config: islands default to one and are parsed", "[sim_config]") {
+    std::string tmp_path = "test_islands.json";
+    {
+        std::ofstream f(tmp_path);
+        f << R"({"evolution": {"islands": {"count": 4, "migrationInterval": 5,
+                                             "migrants": 2, "topology": "full"}}})";
+    }
+
+    SimConfig defaults;
+    CHECK(defaults.islands.count == 1);
+    CHECK(defaults.islands.topology == MigrationTopology::Ring);
+
+    SimConfig cfg = load_sim_config(tmp_path);
+    CHECK(cfg.islands.count == 4);
+    CHECK(cfg.islands.migration_interval == 5);
+    CHECK(cfg.islands.migrants == 2);
+    CHECK(cfg.islands.topology == MigrationTopology::Full);
+
+    CHECK_THROWS(parse_migration_topology("star"));
+
+    std::filesystem::remove(tmp_path);
+}
+
 TEST_CASE("Sim config: fitnessMode gross parsed", "[sim_config]") {
     std::string tmp_path = "test_fitness_gross.json";
     {
@@ -155,3 +185,112 @@ TEST_CASE("Sim config: fitnessMode gross parsed", "[sim_config]") {
 
     std::filesystem::remove(tmp_path);
 }
+
+TEST_CASE("Sim config: brain activation precision", "[sim_config]") {
+    std::string tmp_path = "test_activation_config.json";
+    {
+        std::ofstream f(tmp_path);
+        f << R"({"brain": {"activation": "fastest"}})";
+    }
+    CHECK(load_sim_config(tmp_path).world.brain_activation == ActivationPrecision::Fastest);
+
+    {
+        std::ofstream f(tmp_path);
+        f << R"({"brain": {"activation": "sloppy"}})";
+    }
+    CHECK_THROWS(load_sim_config(tmp_path));
+
+    {
+        std::ofstream f(tmp_path);
+        f << R"({"world": {"width": 500}})";
+    }
+    CHECK(load_sim_config(tmp_path).world.brain_activation == ActivationPrecision::Exact);
+
+    std::filesystem::remove(tmp_path);
+}
+
+TEST_CASE("Sim config: episode length schedule and early stop", "[sim_config]") {
+    std::string tmp_path = "test_episode_length.json";
+    {
+        std::ofstream f(tmp_path);
+        f << R"({"evolution": {"ticksPerGeneration": 6000,
+                 "episodeLength": {"startTicks": 1000, "rampGenerations": 50,
+                                   "earlyStop": true, "checkInterval": 120,
+                                   "minTicks": 480, "rankCorrelation": 0.95,
+                                   "patience": 4}}})";
+    }
+
+    SimConfig defaults;
+    CHECK_FALSE(defaults.episode_length.early_stop);
+    CHECK(ticks_for_generation(defaults, 0) == defaults.ticks_per_generation);
+
+    SimConfig cfg = load_sim_config(tmp_path);
+    CHECK(cfg.episode_length.early_stop);
+    CHECK(cfg.episode_length.check_interval == 120);
+    CHECK(cfg.episode_length.min_ticks == 480);
+    CHECK(cfg.episode_length.rank_correlation == 0.95f);
+    CHECK(cfg.episode_length.patience == 4);
+
+    CHECK(ticks_for_generation(cfg, 0) == 1000);
+    CHECK(ticks_for_generation(cfg, 25) == 3500);
+    CHECK(ticks_for_generation(cfg, 50) == 6000);
+    CHECK(ticks_for_generation(cfg, 500) == 6000);
+
+    std::filesystem::remove(tmp_path);
+}
+
+TEST_CASE("Sim config: eye kernel accepts only exact and fast", "[sim_config]") {
+    CHECK_FALSE(parse_eye_kernel("exact"));
+    CHECK(parse_eye_kernel("fast"));
+    CHECK_THROWS(parse_eye_kernel("Fast"));
+    CHECK_THROWS(parse_eye_kernel("simd"));
+
+    std::string tmp_path = "test_eye_kernel_config.json";
+    {
+        std::ofstream f(tmp_path);
+        f << R"({"sensors": {"eyeKernel": "fast"}})";
+    }
+    CHECK(load_sim_config(tmp_path).world.fast_eye_kernel);
+    {
+        std::ofstream f(tmp_path);
+        f << R"({"sensors": {"eyeKernel": "simd"}})";
+    }
+    CHECK_THROWS(load_sim_config(tmp_path));
+    std::filesystem::remove(tmp_path);
+}
+
+TEST_CASE("Sim config: fewer than one episode is rejected", "[sim_config]") {
+    std::string tmp_path = "test_episodes_config.json";
+    for (const char* text : {R"({"evolution": {"episodes": 0}})",
+                             R"({"evolution": {"episodes": -3}})"}) {
+        {
+            std::ofstream f(tmp_path);
+            f << text;
+        }
+        CHECK_THROWS(load_sim_config(tmp_path));
+    }
+    {
+        std::ofstream f(tmp_path);
+        f << R"({"evolution": {"episodes": 4}})";
+    }
+    CHECK(load_sim_config(tmp_path).episodes == 4);
+    std::filesystem::remove(tmp_path);
+}
+
+TEST_CASE("Sim config: racing", "[sim_config]") {
+    std::string tmp_path = "test_racing.json";
+    {
+        std::ofstream f(tmp_path);
+        f << R"({"evolution": {"racing": {"enabled": true, "rounds": 4, "keepFraction": 0.25}}})";
+    }
+
+    SimConfig defaults;
+    CHECK_FALSE(defaults.racing.enabled);
+
+    SimConfig cfg = load_sim_config(tmp_path);
+    CHECK(cfg.racing.enabled);
+    CHECK(cfg.racing.rounds == 4);
+    CHECK(cfg.racing.keep_fraction == 0.25f);
+
+    std::filesystem::remove(tmp_path);
+}
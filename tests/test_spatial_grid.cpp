@@ -184,3 +184,63 @@ TEST_CASE("World grid is consistent after multiple steps", "[spatial_grid]") {
     world.grid().query(pos, CELL, results);
     REQUIRE(std::find(results.begin(), results.end(), 0) != results.end());
 }
+
+TEST_CASE("Grid build() matches incremental insert()", "[spatial_grid]") {
+    std::mt19937 rng(9);
+    std::uniform_real_distribution<float> d(0.0f, W);
+    std::vector<Vec2> positions(200);
+    std::vector<uint8_t> include(200);
+    for (int i = 0; i < 200; ++i) {
+        positions[i] = {d(rng), d(rng)};
+        include[i] = (i % 3 != 0);
+    }
+
+    SpatialGrid built(W, H, CELL, true);
+    built.build(positions, include);
+    SpatialGrid inserted(W, H, CELL, true);
+    for (int i = 0; i < 200; ++i) {
+        if (include[i]) inserted.insert(i, positions[i]);
+    }
+
+    for (int q = 0; q < 20; ++q) {
+        Vec2 p{d(rng), d(rng)};
+        std::vector<int> a, b;
+        built.query(p, 150.0f, a);
+        inserted.query(p, 150.0f, b);
+        CHECK(a == b);
+        for (int idx : a) CHECK(include[idx]);
+    }
+}
+
+TEST_CASE("Grid for_each_cell hands out ascending spans per cell", "[spatial_grid]") {
+    SpatialGrid grid(W, H, CELL, true);
+    grid.insert(5, {150, 150});
+    grid.insert(2, {160, 160});
+    grid.insert(9, {170, 120});
+    grid.insert(1, {650, 650});
+
+    int cells = 0;
+    std::vector<int> seen;
+    grid.for_each_cell({150, 150}, 10.0f, [&](std::span<const int> cell) {
+        ++cells;
+        seen.insert(seen.end(), cell.begin(), cell.end());
+    });
+    CHECK(cells == 1);  // empty cells are skipped
+    CHECK(seen == std::vector<int>{5, 2, 9});  // insertion order within the cell
+}
+
+TEST_CASE("Grid query on a small torus returns each boid once", "[spatial_grid]") {
+    // 3x3 cells: a radius spanning two cells each way would wrap onto the same columns
+    SpatialGrid grid(300, 300, 100, true);
+    grid.insert(0, {50, 50});
+    grid.insert(1, {250, 250});
+
+    std::vector<int> results;
+    grid.query({150, 150}, 200.0f, results);
+    std::sort(results.begin(), results.end());
+    CHECK(results == std::vector<int>{0, 1});
+
+    int visits = 0;
+    grid.for_each({50, 50}, 250.0f, [&](int) { ++visits; });
+    CHECK(visits == 2);
+}
@@ -3,6 +3,9 @@
 #include "brain/speciation.h"
 #include "brain/mutation.h"
 #include "brain/innovation_tracker.h"
+#include "simulation/thread_pool.h"
+#include <algorithm>
+#include <random>
 
 using Catch::Matchers::WithinAbs;
 
@@ -24,8 +27,8 @@ TEST_CASE("Compatibility: weight difference only", "[speciation]") {
     NeatGenome b = make_minimal();
 
     // Set all weights in a to 1.0, in b to 0.0
-    for (auto& c : a.connections) c.weight = 1.0f;
-    for (auto& c : b.connections) c.weight = 0.0f;
+    for (size_t c = 0; c < a.connections().size(); ++c) a.set_weight(c, 1.0f);
+    for (size_t c = 0; c < b.connections().size(); ++c) b.set_weight(c, 0.0f);
 
     CompatibilityParams params;
     params.c1 = 0; params.c2 = 0; params.c3 = 1.0f;
@@ -40,7 +43,7 @@ TEST_CASE("Compatibility: excess genes increase distance", "[speciation]") {
     NeatGenome b = make_minimal(2, 1);
 
     // Add excess gene to a (innovation beyond b's max)
-    a.connections.push_back({100, 0, 2, 0.0f, true});
+    a.add_connection({100, 0, 2, 0.0f, true});
 
     CompatibilityParams params;
     params.c1 = 1.0f; params.c2 = 0; params.c3 = 0;
@@ -57,9 +60,9 @@ TEST_CASE("Compatibility: disjoint genes increase distance", "[speciation]") {
 
     // Give b a high innovation gene so a's middle innovations become disjoint
     // a has innovations [1, 2], add innovation 50 to both, then add innovation 3 only to a
-    a.connections.push_back({3, 0, 2, 0.0f, true});
-    a.connections.push_back({50, 1, 2, 0.0f, true});
-    b.connections.push_back({50, 1, 2, 0.0f, true});
+    a.add_connection({3, 0, 2, 0.0f, true});
+    a.add_connection({50, 1, 2, 0.0f, true});
+    b.add_connection({50, 1, 2, 0.0f, true});
 
     CompatibilityParams params;
     params.c1 = 0; params.c2 = 1.0f; params.c3 = 0;
@@ -156,3 +159,81 @@ TEST_CASE("assign_species: empty species are removed", "[speciation]") {
     for (const auto& s : species) total += static_cast<int>(s.members.size());
     CHECK(total == 1);
 }
+
+// ---- sorted signatures and parallel assignment ----
+
+// Genomes that have drifted apart through structural and weight mutations
+static std::vector<NeatGenome> make_diverse(int count, std::mt19937& rng) {
+    InnovationTracker tracker(100);
+    std::vector<NeatGenome> genomes;
+    for (int i = 0; i < count; ++i) {
+        NeatGenome g = make_minimal(4, 3);
+        int steps = i % 7;
+        for (int s = 0; s < steps; ++s) {
+            mutate_add_node(g, rng, tracker);
+            mutate_add_connection(g, rng, tracker);
+        }
+        mutate_weights(g, rng, 0.9f, 1.0f, 0.2f);
+        genomes.push_back(std::move(g));
+    }
+    return genomes;
+}
+
+TEST_CASE("Compatibility: signature distance ignores connection order", "[speciation]") {
+    std::mt19937 rng(5);
+    auto genomes = make_diverse(12, rng);
+    CompatibilityParams params;
+
+    for (size_t i = 0; i < genomes.size(); ++i) {
+        for (size_t j = 0; j < genomes.size(); ++j) {
+            std::vector<ConnectionGene> connections(genomes[j].connections().begin(),
+                                                    genomes[j].connections().end());
+            std::shuffle(connections.begin(), connections.end(), rng);
+            NeatGenome shuffled({genomes[j].nodes().begin(), genomes[j].nodes().end()}, connections);
+            float d = compatibility_distance(genomes[i], genomes[j], params);
+            CHECK(compatibility_distance(GeneSignature(genomes[i]), GeneSignature(shuffled), params) == d);
+            CHECK(compatibility_distance(genomes[j], genomes[i], params) == d);
+        }
+    }
+}
+
+TEST_CASE("Compatibility: signature is sorted and unique", "[speciation]") {
+    std::mt19937 rng(9);
+    NeatGenome last = make_diverse(7, rng).back();
+    std::vector<ConnectionGene> connections(last.connections().begin(), last.connections().end());
+    std::reverse(connections.begin(), connections.end());
+    NeatGenome g({last.nodes().begin(), last.nodes().end()}, connections);
+    GeneSignature sig(g);
+    CHECK(sig.gene_count == static_cast<int>(g.connections().size()));
+    REQUIRE(sig.innovations.size() == sig.weights.size());
+    CHECK(std::is_sorted(sig.innovations.begin(), sig.innovations.end()));
+    CHECK(std::adjacent_find(sig.innovations.begin(), sig.innovations.end()) == sig.innovations.end());
+}
+
+TEST_CASE("assign_species: parallel pass matches serial", "[speciation]") {
+    std::mt19937 rng(21);
+    auto genomes = make_diverse(300, rng);
+    CompatibilityParams params;
+
+    // Seed both runs with the same pre-existing species
+    std::vector<Species> serial, parallel;
+    int next_serial = 1, next_parallel = 1;
+    assign_species(serial, std::vector<NeatGenome>(genomes.begin(), genomes.begin() + 40),
+                   params, 0.8f, next_serial);
+    parallel = serial;
+    next_parallel = next_serial;
+
+    ThreadPool pool(4);
+    assign_species(serial, genomes, params, 0.8f, next_serial);
+    assign_species(parallel, genomes, params, 0.8f, next_parallel, &pool);
+
+    REQUIRE(serial.size() > 3);
+    REQUIRE(serial.size() == parallel.size());
+    CHECK(next_serial == next_parallel);
+    for (size_t s = 0; s < serial.size(); ++s) {
+        CHECK(serial[s].id == parallel[s].id);
+        CHECK(serial[s].members == parallel[s].members);
+        CHECK(serial[s].representative.innovations == parallel[s].representative.innovations);
+        CHECK(serial[s].representative.weights == parallel[s].representative.weights);
+    }
+}
@@ -0,0 +1,148 @@
+#include <catch2/catch_test_macros.hpp>
+#include "io/telemetry.h"
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+static TelemetryBatch make_batch(int gen, int individuals) {
+    TelemetryBatch batch;
+    GenerationTelemetry row;
+    row.generation = gen;
+    row.best_fitness = 2.5f;
+    row.mean_fitness = 1.0f;
+    row.species_count = 3;
+    batch.generations.push_back(row);
+    for (int i = 0; i < individuals; ++i) {
+        IndividualTelemetry ind;
+        ind.generation = gen;
+        ind.population = TelemetryPopulation::Predator;
+        ind.index = i;
+        ind.species_id = 7;
+        ind.fitness = 0.5f * i;
+        ind.episodes = 2;
+        ind.nodes = 10 + i;
+        ind.eye_angle_spread = std::nanf("");
+        batch.individuals.push_back(ind);
+    }
+    return batch;
+}
+
+static int count_lines(const std::string& s) {
+    int lines = 0;
+    for (char c : s) lines += c == '\n';
+    return lines;
+}
+
+TEST_CASE("Telemetry: batches written in the background export as CSV", "[telemetry]") {
+    std::string tmp_path = "test_telemetry.bin";
+    {
+        TelemetryWriter writer(tmp_path);
+        for (int gen = 0; gen < 5; ++gen) writer.submit(make_batch(gen, 4));
+        writer.close();
+    }
+
+    std::ostringstream generations;
+    export_telemetry_csv(tmp_path, "generations", generations);
+    CHECK(generations.str().rfind("island,generation,population,best_fitness,", 0) == 0);
+    CHECK(count_lines(generations.str()) == 1 + 5);
+    CHECK(generations.str().find("\n0,4,0,2.5,1,3,0,0,") != std::string::npos);
+
+    std::ostringstream individuals;
+    export_telemetry_csv(tmp_path, "individuals", individuals);
+    CHECK(count_lines(individuals.str()) == 1 + 5 * 4);
+    // island, generation, population, index, species_id, fitness, episodes, ..., nodes, ...,
+    // NaN left empty
+    CHECK(individuals.str().find("\n0,2,1,3,7,1.5,2,0,0,0,0,13,0,,0\n") != std::string::npos);
+
+    CHECK_THROWS(export_telemetry_csv(tmp_path, "nope", individuals));
+    std::filesystem::remove(tmp_path);
+}
+
+TEST_CASE("Telemetry: a truncated file keeps its complete chunks", "[telemetry]") {
+    std::string tmp_path = "test_telemetry_truncated.bin";
+    {
+        TelemetryWriter writer(tmp_path);
+        writer.submit(make_batch(0, 3));
+        writer.submit(make_batch(1, 3));
+    }
+
+    std::filesystem::resize_file(tmp_path, std::filesystem::file_size(tmp_path) - 6);
+    std::ostringstream individuals;
+    export_telemetry_csv(tmp_path, "individuals", individuals);
+    CHECK(count_lines(individuals.str()) == 1 + 3);
+
+    std::filesystem::remove(tmp_path);
+}
+
+TEST_CASE("Telemetry: floats export with enough digits to read back exactly", "[telemetry]") {
+    std::string tmp_path = "test_telemetry_precision.bin";
+    {
+        TelemetryWriter writer(tmp_path);
+        TelemetryBatch batch = make_batch(0, 0);
+        batch.generations[0].best_fitness = 1.0f / 3.0f;
+        writer.submit(batch);
+    }
+
+    std::ostringstream generations;
+    export_telemetry_csv(tmp_path, "generations", generations);
+    std::string csv = generations.str();
+    size_t row = csv.find("\n0,0,0,");
+    REQUIRE(row != std::string::npos);
+    float best = std::stof(csv.substr(row + 7));
+    CHECK(best == 1.0f / 3.0f);
+
+    std::filesystem::remove(tmp_path);
+}
+
+TEST_CASE("Telemetry: a resumed run appends after the generations it keeps", "[telemetry]") {
+    std::string tmp_path = "test_telemetry_resume.bin";
+    {
+        TelemetryWriter writer(tmp_path);
+        for (int gen = 0; gen < 4; ++gen) writer.submit(make_batch(gen, 2));
+    }
+    // Damage the tail, as a crash mid-write would
+    std::filesystem::resize_file(tmp_path, std::filesystem::file_size(tmp_path) - 6);
+
+    // Resume from a checkpoint taken before generation 2: rows of 2 and 3 go
+    {
+        TelemetryWriter writer(tmp_path, 2);
+        for (int gen = 2; gen < 5; ++gen) writer.submit(make_batch(gen, 2));
+    }
+
+    std::ostringstream generations;
+    export_telemetry_csv(tmp_path, "generations", generations);
+    CHECK(count_lines(generations.str()) == 1 + 5);
+    for (int gen = 0; gen < 5; ++gen) {
+        std::string row = "\n0," + std::to_string(gen) + ",0,2.5,";
+        size_t first = generations.str().find(row);
+        CHECK(first != std::string::npos);
+        CHECK(generations.str().find(row, first + 1) == std::string::npos);
+    }
+    std::ostringstream individuals;
+    export_telemetry_csv(tmp_path, "individuals", individuals);
+    CHECK(count_lines(individuals.str()) == 1 + 5 * 2);
+
+    std::filesystem::remove(tmp_path);
+}
+
+TEST_CASE("Telemetry: resuming creates a missing file and refuses a foreign one", "[telemetry]") {
+    std::string tmp_path = "test_telemetry_resume_new.bin";
+    std::filesystem::remove(tmp_path);
+    {
+        TelemetryWriter writer(tmp_path, 3);
+        writer.submit(make_batch(3, 1));
+    }
+    std::ostringstream generations;
+    export_telemetry_csv(tmp_path, "generations", generations);
+    CHECK(count_lines(generations.str()) == 1 + 1);
+    std::filesystem::remove(tmp_path);
+
+    {
+        std::ofstream other(tmp_path, std::ios::binary);
+        other << "not telemetry";
+    }
+    CHECK_THROWS(TelemetryWriter(tmp_path, 1));
+    std::filesystem::remove(tmp_path);
+}
@@ -0,0 +1,160 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "simulation/thread_pool.h"
+#include "simulation/rng_stream.h"
+#include "io/boid_spec.h"
+#include "brain/neat_genome.h"
+#include "simulation/world.h"
+#include "io/data_path.h"
+#include <filesystem>
+#include <random>
+
+// ---- ThreadPool ----
+
+TEST_CASE("ThreadPool visits every index exactly once", "[thread_pool]") {
+    ThreadPool pool(4);
+    REQUIRE(pool.size() == 4);
+
+    std::vector<int> hits(1000, 0);
+    pool.parallel_for(1000, 7, [&](int begin, int end, int) {
+        for (int i = begin; i < end; ++i) ++hits[i];
+    });
+    for (int h : hits) CHECK(h == 1);
+}
+
+TEST_CASE("ThreadPool worker ids stay within size()", "[thread_pool]") {
+    ThreadPool pool(3);
+    std::vector<int> worker_of(300, -1);
+    pool.parallel_for(300, 1, [&](int begin, int end, int worker) {
+        for (int i = begin; i < end; ++i) worker_of[i] = worker;
+    });
+    for (int w : worker_of) {
+        CHECK(w >= 0);
+        CHECK(w < pool.size());
+    }
+}
+
+TEST_CASE("ThreadPool can be reused for many loops", "[thread_pool]") {
+    ThreadPool pool(4);
+    long long total = 0;
+    for (int round = 0; round < 200; ++round) {
+        std::vector<int> v(64, 0);
+        pool.parallel_for(64, 4, [&](int begin, int end, int) {
+            for (int i = begin; i < end; ++i) v[i] = i;
+        });
+        for (int x : v) total += x;
+    }
+    CHECK(total == 200LL * (63 * 64 / 2));
+}
+
+TEST_CASE("ThreadPool with one thread runs inline", "[thread_pool]") {
+    ThreadPool pool(1);
+    CHECK(pool.size() == 1);
+    int calls = 0;
+    pool.parallel_for(10, 2, [&](int begin, int end, int worker) {
+        CHECK(begin == 0);
+        CHECK(end == 10);
+        CHECK(worker == 0);
+        ++calls;
+    });
+    CHECK(calls == 1);
+}
+
+// ---- rng_stream ----
+
+TEST_CASE("stream_uniform is a pure function of seed and stream", "[thread_pool]") {
+    CHECK(stream_bits(1, 2) == stream_bits(1, 2));
+    CHECK(stream_bits(1, 2) != stream_bits(1, 3));
+    CHECK(stream_bits(1, 2) != stream_bits(2, 2));
+    for (uint64_t s = 0; s < 1000; ++s) {
+        float v = stream_uniform(99, s, -1.0f, 1.0f);
+        CHECK(v >= -1.0f);
+        CHECK(v < 1.0f);
+    }
+}
+
+// ---- World determinism across thread counts ----
+
+static World make_busy_world(int threads, std::mt19937& rng, ThreadPool* pool = nullptr) {
+    WorldConfig cfg;
+    cfg.width = 600;
+    cfg.height = 600;
+    cfg.toroidal = true;
+    cfg.threads = threads;
+    cfg.food_max = 60;
+    cfg.food_spawn_rate = 20.0f;
+    cfg.predator_catch_radius = 8.0f;
+    cfg.prey_shoaling.radius = 40.0f;
+    cfg.prey_shoaling.max_reduction = 0.3f;
+    World world(cfg, pool);
+    world.pre_seed_food(rng);
+
+    BoidSpec prey = load_boid_spec(data_path("simple_boid.json"));
+    BoidSpec pred = load_boid_spec(data_path("simple_predator.json"));
+    std::uniform_real_distribution<float> pos(0.0f, 600.0f);
+    std::uniform_real_distribution<float> w(-2.0f, 2.0f);
+
+    for (int i = 0; i < 150; ++i) {
+        BoidSpec& spec = (i < 120) ? prey : pred;
+        int next_innov = 1;
+        spec.genome = NeatGenome::minimal(sensor_input_count(spec),
+                                          static_cast<int>(spec.thrusters.size()), next_innov);
+        for (size_t c = 0; c < spec.genome->connections().size(); ++c) {
+            spec.genome->set_weight(c, w(rng));
+        }
+        Boid b = create_boid_from_spec(spec);
+        b.body.position = {pos(rng), pos(rng)};
+        b.body.angle = w(rng);
+        world.add_boid(std::move(b));
+    }
+    return world;
+}
+
+TEST_CASE("World::step gives identical results for 1 and 4 threads", "[thread_pool][world]") {
+    std::mt19937 rng_a(7), rng_b(7);
+    World serial = make_busy_world(1, rng_a);
+    World threaded = make_busy_world(4, rng_b);
+
+    for (int t = 0; t < 300; ++t) {
+        serial.step(1.0f / 120.0f, &rng_a);
+        threaded.step(1.0f / 120.0f, &rng_b);
+    }
+
+    const auto& a = serial.get_boids();
+    const auto& b = threaded.get_boids();
+    REQUIRE(a.size() == b.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        CHECK(a[i].body.position.x == b[i].body.position.x);
+        CHECK(a[i].body.position.y == b[i].body.position.y);
+        CHECK(a[i].body.angle == b[i].body.angle);
+        CHECK(a[i].energy == b[i].energy);
+        CHECK(a[i].alive == b[i].alive);
+        CHECK(a[i].total_energy_gained == b[i].total_energy_gained);
+        CHECK(a[i].sensor_outputs == b[i].sensor_outputs);
+    }
+    CHECK(serial.get_food().size() == threaded.get_food().size());
+    CHECK(rng_a() == rng_b());
+}
+
+TEST_CASE("Worlds can share an external pool one after another", "[thread_pool][world]") {
+    std::mt19937 rng_ref(11);
+    World reference = make_busy_world(1, rng_ref);
+    for (int t = 0; t < 100; ++t) reference.step(1.0f / 120.0f, &rng_ref);
+
+    // The same pool serves every world in turn; config.threads is ignored
+    ThreadPool pool(3);
+    for (int episode = 0; episode < 3; ++episode) {
+        std::mt19937 rng(11);
+        World world = make_busy_world(1, rng, &pool);
+        for (int t = 0; t < 100; ++t) world.step(1.0f / 120.0f, &rng);
+
+        const auto& a = reference.get_boids();
+        const auto& b = world.get_boids();
+        REQUIRE(a.size() == b.size());
+        for (size_t i = 0; i < a.size(); ++i) {
+            CHECK(a[i].body.position.x == b[i].body.position.x);
+            CHECK(a[i].energy == b[i].energy);
+            CHECK(a[i].sensor_outputs == b[i].sensor_outputs);
+        }
+    }
+}
@@ -0,0 +1,120 @@
+#include <catch2/catch_test_macros.hpp>
+#include "simulation/trace.h"
+#include "simulation/thread_pool.h"
+#include <nlohmann/json.hpp>
+#include <filesystem>
+#include <fstream>
+#include <set>
+
+static nlohmann::json load_trace(const std::string& path) {
+    std::ifstream file(path);
+    return nlohmann::json::parse(file);
+}
+
+TEST_CASE("Trace: spans from every thread land in one timeline", "[trace]") {
+    std::string tmp_path = "test_trace.json";
+    { TraceSpan before("not_traced", "test"); }
+
+    set_trace_thread_name("test main");
+    trace_start(tmp_path);
+    CHECK(trace_enabled());
+    CHECK_THROWS(trace_start(tmp_path));
+    {
+        TraceSpan outer("outer", "test", "gen", 7);
+        ThreadPool pool(3);
+        pool.parallel_for(64, 1, [](int, int, int) { TraceSpan span("work", "test"); });
+    }
+    trace_flush();
+    { TraceSpan late("after_flush", "test"); }
+    trace_stop();
+    CHECK_FALSE(trace_enabled());
+    { TraceSpan after("not_traced", "test"); }
+
+    auto trace = load_trace(tmp_path);
+    int outer = 0, work = 0, after_flush = 0, untraced = 0;
+    std::set<int> work_threads;
+    bool named_main = false;
+    for (const auto& e : trace["traceEvents"]) {
+        if (e["ph"] == "M") {
+            if (e["args"]["name"] == "test main") named_main = true;
+            continue;
+        }
+        CHECK(e["ph"] == "X");
+        CHECK(e["dur"].get<double>() >= 0.0);
+        std::string name = e["name"];
+        if (name == "outer") {
+            ++outer;
+            CHECK(e["args"]["gen"] == 7);
+        }
+        if (name == "work") {
+            ++work;
+            work_threads.insert(e["tid"].get<int>());
+        }
+        if (name == "after_flush") ++after_flush;
+        if (name == "not_traced") ++untraced;
+    }
+    CHECK(outer == 1);
+    CHECK(work == 64);
+    CHECK(after_flush == 1);
+    CHECK(untraced == 0);
+    CHECK(named_main);
+    CHECK(!work_threads.empty());
+
+    std::filesystem::remove(tmp_path);
+}
+
+TEST_CASE("Trace: end() records a span once, before its scope closes", "[trace]") {
+    std::string tmp_path = "test_trace_end.json";
+    trace_start(tmp_path);
+    {
+        TraceSpan first("first", "test");
+        first.end();
+        first.end();
+        TraceSpan second("second", "test");
+    }
+    trace_stop();
+
+    auto trace = load_trace(tmp_path);
+    int first = 0;
+    double first_end = 0.0, second_start = 0.0;
+    for (const auto& e : trace["traceEvents"]) {
+        if (e["ph"] != "X") continue;
+        if (e["name"] == "first") {
+            ++first;
+            first_end = e["ts"].get<double>() + e["dur"].get<double>();
+        }
+        if (e["name"] == "second") second_start = e["ts"].get<double>();
+    }
+    CHECK(first == 1);
+    CHECK(first_end <= second_start);
+
+    std::filesystem::remove(tmp_path);
+}
+
+TEST_CASE("Trace: pools built again and again reuse their workers' rows", "[trace]") {
+    std::string tmp_path = "test_trace_pools.json";
+    trace_start(tmp_path);
+    for (int round = 0; round < 20; ++round) {
+        ThreadPool pool(3);
+        pool.parallel_for(64, 1, [](int, int, int) { TraceSpan span("work", "test"); });
+    }
+    trace_stop();
+
+    auto trace = load_trace(tmp_path);
+    int rows = 0, work = 0;
+    std::set<int> tids;
+    for (const auto& e : trace["traceEvents"]) {
+        if (e["ph"] == "M") {
+            ++rows;
+            continue;
+        }
+        if (e["name"] == "work") ++work;
+        tids.insert(e["tid"].get<int>());
+    }
+    // The calling thread plus one row per pool slot, however many pools ran
+    CHECK(work == 20 * 64);
+    CHECK(rows <= 3);
+    CHECK(tids.size() <= 3);
+
+    std::filesystem::remove(tmp_path);
+}
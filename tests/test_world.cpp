@@ -24,6 +24,29 @@ TEST_CASE("World steps boid physics", "[world]") {
     CHECK(world.get_boids()[0].body.position.y > 0);
 }
 
+TEST_CASE("set_thruster_power edits one thruster and ignores bad indices", "[world]") {
+    WorldConfig cfg;
+    cfg.toroidal = false;
+    cfg.linear_drag = 0;
+    cfg.angular_drag = 0;
+    World world(cfg);
+
+    Boid b;
+    b.body.mass = 1.0f;
+    b.thrusters.push_back({{0, -0.5f}, {0, 1}, 50.0f, 0.0f});
+    world.add_boid(std::move(b));
+
+    world.set_thruster_power(0, 0, 1.0f);
+    world.set_thruster_power(0, 5, 1.0f);
+    world.set_thruster_power(3, 0, 1.0f);
+    CHECK(world.get_boids()[0].thrusters[0].power == 1.0f);
+
+    for (int i = 0; i < 100; i++) {
+        world.step(0.01f);
+    }
+    CHECK(world.get_boids()[0].body.position.y > 0);
+}
+
 TEST_CASE("Toroidal wrapping X axis", "[world]") {
     WorldConfig cfg;
     cfg.width = 100;
@@ -88,3 +111,35 @@ TEST_CASE("Multiple boids update independently", "[world]") {
     CHECK_THAT(world.get_boids()[0].body.position.x, WithinAbs(10.0f, 1e-3f));
     CHECK_THAT(world.get_boids()[1].body.position.y, WithinAbs(-5.0f, 1e-3f));
 }
+
+TEST_CASE("World profile covers every phase only in profiling builds", "[world]") {
+    WorldConfig cfg;
+    cfg.food_max = 20;
+    cfg.food_spawn_rate = 50.0f;
+    World world(cfg);
+
+    for (int i = 0; i < 3; ++i) {
+        Boid b;
+        b.body.mass = 1.0f;
+        b.body.position = {100.0f + 10.0f * i, 100.0f};
+        b.thrusters.push_back({{0, -0.5f}, {0, 1}, 50.0f, 1.0f});
+        world.add_boid(std::move(b));
+    }
+
+    std::mt19937 rng(1);
+    for (int t = 0; t < 10; ++t) world.step(0.01f, &rng);
+
+    const StepProfile& profile = world.profile();
+    if (StepProfile::enabled) {
+        CHECK(profile.steps == 10);
+        CHECK(profile.boid_steps == 30);
+        CHECK(profile.total_ns() > 0);
+        CHECK(profile.phase_ns[static_cast<int>(StepPhase::Integrate)] > 0);
+    } else {
+        CHECK(profile.steps == 0);
+        CHECK(profile.total_ns() == 0);
+    }
+
+    world.reset_profile();
+    CHECK(world.profile().steps == 0);
+}